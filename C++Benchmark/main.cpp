@@ -0,0 +1,357 @@
+#include "Errors.hpp"
+#include "Utilities.hpp"
+#include "Quaternions.hpp"
+#include "Waveforms.hpp"
+#include "PNWaveforms.hpp"
+#include "WaveformsAtAPointFT.hpp"
+#include "Scri.hpp"
+#include <sys/time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+using namespace std;
+
+// To build this program, change any necessary paths in the
+// accompanying Makefile, and run 'make'.  Then run
+//
+//   ./benchmark [Filter] [MinSeconds]
+//
+// to time every benchmark whose name contains `Filter` (default: all
+// of them), repeating each one until at least `MinSeconds` (default:
+// 1.0) have passed.
+//
+// NOTE: This program times the core operations of GWFrames on
+// synthetic post-Newtonian data at a few sizes, so that changes to the
+// code can be judged against a fixed baseline.  For each benchmark, it
+// reports the wall-clock time per iteration, the throughput in units
+// given with each benchmark (mostly mode-samples, i.e., NModes*NTimes
+// of the input), and the number and total size of heap allocations
+// per iteration, counted over all threads.  Note that several of
+// these operations modify their inputs, so the iterations also
+// include making a copy of the input Waveform.
+
+
+// Count every heap allocation by replacing the global operator new
+#if __cplusplus >= 201103L
+#define BENCHMARK_THROW_BAD_ALLOC
+#define BENCHMARK_NOTHROW noexcept
+#else
+#define BENCHMARK_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define BENCHMARK_NOTHROW throw()
+#endif
+namespace {
+  volatile long NAllocations = 0;
+  volatile long NBytesAllocated = 0;
+}
+void* operator new(std::size_t size) BENCHMARK_THROW_BAD_ALLOC {
+  __sync_fetch_and_add(&NAllocations, 1L);
+  __sync_fetch_and_add(&NBytesAllocated, long(size));
+  void* p = std::malloc(size==0 ? 1 : size);
+  if(!p) { throw std::bad_alloc(); }
+  return p;
+}
+void operator delete(void* p) BENCHMARK_NOTHROW {
+  std::free(p);
+}
+
+
+namespace {
+
+  double WallTime() {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + 1.e-6*tv.tv_usec;
+  }
+
+  // Each benchmark is a functor whose `Run` does one iteration
+  class Benchmark {
+  public:
+    virtual ~Benchmark() { }
+    virtual void Run() = 0;
+  };
+
+  bool Selected(const string& Name, const string& Filter) {
+    return (Filter.empty() || Name.find(Filter)!=string::npos);
+  }
+
+  // Run the benchmark repeatedly, and print one line of results
+  void Time(const string& Name, Benchmark& B, const double Items, const string& ItemName,
+            const string& Filter, const double MinSeconds) {
+    if(!Selected(Name, Filter)) { return; }
+    B.Run(); // Warm up caches, FFTW plans, etc.
+    const long Allocations0 = NAllocations;
+    const long Bytes0 = NBytesAllocated;
+    const double Start = WallTime();
+    long Iterations = 0;
+    double Elapsed = 0.0;
+    do {
+      B.Run();
+      ++Iterations;
+      Elapsed = WallTime()-Start;
+    } while(Elapsed<MinSeconds);
+    const double PerIteration = Elapsed/Iterations;
+    cout << left << setw(52) << Name << right
+         << setw(12) << setprecision(4) << 1.e3*PerIteration << " ms"
+         << setw(8) << Iterations
+         << setw(12) << setprecision(4) << Items/PerIteration << " " << left << setw(16) << (ItemName+"/s") << right
+         << setw(12) << (NAllocations-Allocations0)/Iterations
+         << setw(12) << setprecision(4) << double(NBytesAllocated-Bytes0)/Iterations/1048576. << " MB"
+         << endl;
+  }
+
+  string SizeName(const string& Name, const unsigned int NTimes, const int ellMax) {
+    stringstream S;
+    S << Name << "/NTimes=" << NTimes << "/ellMax=" << ellMax;
+    return S.str();
+  }
+
+  // A precessing PN waveform, sampled uniformly at NTimes steps
+  GWFrames::Waveform SyntheticWaveform(const unsigned int NTimes, const int ellMax) {
+    vector<double> chi1(3), chi2(3);
+    chi1[0] = 0.1; chi1[1] = 0.2; chi1[2] = 0.3;
+    chi2[0] = -0.2; chi2[1] = 0.1; chi2[2] = -0.3;
+    GWFrames::PNWaveform PN("TaylorT1", 0.2, chi1, chi2, 0.02, -1.0, Quaternions::Quaternion(1,0,0,0), 32, 3.5, 4.0, ellMax);
+    const double t1 = PN.T(0);
+    const double t2 = PN.T(PN.NTimes()-1);
+    vector<double> T(NTimes);
+    for(unsigned int i=0; i<NTimes; ++i) {
+      T[i] = t1 + (t2-t1)*i/(NTimes-1);
+    }
+    return GWFrames::Waveform(PN).Interpolate(T);
+  }
+
+  // The modes of W, with all (ell,m) from ell=0 and the given spin
+  // weight, as needed by the Scri constructor
+  GWFrames::Waveform ScriInput(const GWFrames::Waveform& W, const int SpinWeight) {
+    const int ellMax = W.EllMax();
+    vector<vector<int> > LM;
+    vector<vector<complex<double> > > Data;
+    for(int ell=0; ell<=ellMax; ++ell) {
+      for(int m=-ell; m<=ell; ++m) {
+        vector<int> lm(2);
+        lm[0] = ell;
+        lm[1] = m;
+        LM.push_back(lm);
+        const unsigned int i_m = W.FindModeIndexWithoutError(ell, m);
+        if(ell>=std::abs(SpinWeight) && i_m<W.NModes()) {
+          Data.push_back(W.Data(i_m));
+        } else {
+          Data.push_back(vector<complex<double> >(W.NTimes(), 0.0));
+        }
+      }
+    }
+    GWFrames::Waveform S(W.T(), LM, Data);
+    S.SetSpinWeight(SpinWeight);
+    return S;
+  }
+
+
+  class LoadBenchmark : public Benchmark {
+    const string& FileName;
+  public:
+    LoadBenchmark(const string& fileName) : FileName(fileName) { }
+    void Run() { GWFrames::Waveform W(FileName, "ReIm"); }
+  };
+
+  class InterpolateBenchmark : public Benchmark {
+    const GWFrames::Waveform& W;
+    const vector<double>& NewTime;
+  public:
+    InterpolateBenchmark(const GWFrames::Waveform& w, const vector<double>& newTime) : W(w), NewTime(newTime) { }
+    void Run() { GWFrames::Waveform Interpolated = W.Interpolate(NewTime); }
+  };
+
+  class PointInterpolantBenchmark : public Benchmark {
+    const GWFrames::WaveformPointInterpolant& P;
+    const vector<double>& vartheta;
+    const vector<double>& varphi;
+    const vector<double>& t;
+  public:
+    PointInterpolantBenchmark(const GWFrames::WaveformPointInterpolant& p, const vector<double>& Vartheta,
+                              const vector<double>& Varphi, const vector<double>& T)
+      : P(p), vartheta(Vartheta), varphi(Varphi), t(T) { }
+    void Run() { vector<complex<double> > d = P.Evaluate(vartheta, varphi, t); }
+  };
+
+  class CorotatingBenchmark : public Benchmark {
+    const GWFrames::Waveform& W;
+  public:
+    CorotatingBenchmark(const GWFrames::Waveform& w) : W(w) { }
+    void Run() { GWFrames::Waveform C(W); C.TransformToCorotatingFrame(); }
+  };
+
+  class AlignBenchmark : public Benchmark {
+    const GWFrames::Waveform& W;
+    const double t1, t2;
+  public:
+    AlignBenchmark(const GWFrames::Waveform& w, const double T1, const double T2) : W(w), t1(T1), t2(T2) { }
+    void Run() {
+      GWFrames::Waveform A(W);
+      GWFrames::Waveform B(W);
+      B.RotatePhysicalSystem(Quaternions::Quaternion(0.1, 0.2, 0.3));
+      GWFrames::AlignWaveforms(A, B, t1, t2);
+    }
+  };
+
+  class HybridizeBenchmark : public Benchmark {
+    const GWFrames::Waveform& A;
+    const GWFrames::Waveform& B;
+    const double t1, t2;
+  public:
+    HybridizeBenchmark(const GWFrames::Waveform& a, const GWFrames::Waveform& b, const double T1, const double T2)
+      : A(a), B(b), t1(T1), t2(T2) { }
+    void Run() { GWFrames::Waveform H = A.Hybridize(B, t1, t2); }
+  };
+
+  class FTBenchmark : public Benchmark {
+    const GWFrames::Waveform& W;
+  public:
+    FTBenchmark(const GWFrames::Waveform& w) : W(w) { }
+    void Run() { GWFrames::WaveformAtAPointFT FT(W, W.T(1)-W.T(0), 0.5, 0.7, 40.0); }
+  };
+
+  class MatchBenchmark : public Benchmark {
+    const GWFrames::WaveformAtAPointFT& A;
+    const GWFrames::WaveformAtAPointFT& B;
+    const vector<double>& InversePSD;
+  public:
+    MatchBenchmark(const GWFrames::WaveformAtAPointFT& a, const GWFrames::WaveformAtAPointFT& b, const vector<double>& inversePSD)
+      : A(a), B(b), InversePSD(inversePSD) { }
+    void Run() { volatile double M = A.Match(B, InversePSD); (void)M; }
+  };
+
+  class TranslateBenchmark : public Benchmark {
+    const GWFrames::Waveform& W;
+    const vector<vector<double> >& deltax;
+  public:
+    TranslateBenchmark(const GWFrames::Waveform& w, const vector<vector<double> >& Deltax) : W(w), deltax(Deltax) { }
+    void Run() { GWFrames::Waveform T = W.Translate(deltax); }
+  };
+
+  class BMSBenchmark : public Benchmark {
+    const GWFrames::Scri& S;
+    const vector<double>& u0;
+    const GWFrames::ThreeVector& v;
+    const GWFrames::Modes& delta;
+  public:
+    BMSBenchmark(const GWFrames::Scri& s, const vector<double>& U0, const GWFrames::ThreeVector& V, const GWFrames::Modes& Delta)
+      : S(s), u0(U0), v(V), delta(Delta) { }
+    void Run() { GWFrames::Scri B = S.BMSTransformation(u0, v, delta); }
+  };
+
+}
+
+
+int main(int argc, char* argv[]) {
+  const string Filter = (argc>1 ? argv[1] : "");
+  const double MinSeconds = (argc>2 ? std::atof(argv[2]) : 1.0);
+
+  const unsigned int NTimesValues[] = { 2000, 20000 };
+  const int ellMaxValues[] = { 4, 8 };
+
+  cout << left << setw(52) << "Benchmark" << right
+       << setw(15) << "Time" << setw(8) << "Iters"
+       << setw(29) << "Throughput"
+       << setw(12) << "Allocs"
+       << setw(15) << "Allocated" << endl;
+
+  for(unsigned int i_ell=0; i_ell<sizeof(ellMaxValues)/sizeof(int); ++i_ell) {
+    for(unsigned int i_N=0; i_N<sizeof(NTimesValues)/sizeof(unsigned int); ++i_N) {
+      const unsigned int NTimes = NTimesValues[i_N];
+      const int ellMax = ellMaxValues[i_ell];
+
+      // Set up the inputs (untimed)
+      const GWFrames::Waveform W = SyntheticWaveform(NTimes, ellMax);
+      const double ModeSamples = double(W.NModes())*W.NTimes();
+      const double t1 = W.T(NTimes/4);
+      const double t2 = W.T(NTimes/2);
+      vector<double> NewTime(2*NTimes);
+      for(unsigned int i=0; i<NewTime.size(); ++i) {
+        NewTime[i] = W.T(0) + (W.T(NTimes-1)-W.T(0))*i/(NewTime.size()-1);
+      }
+
+      if(Selected(SizeName("Waveform(FileName)", NTimes, ellMax), Filter)) {
+        stringstream FileName;
+        FileName << "Benchmark_" << NTimes << "_" << ellMax << ".dat";
+        const string Name = FileName.str();
+        W.Output(Name);
+        LoadBenchmark B(Name);
+        Time(SizeName("Waveform(FileName)", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds);
+        std::remove(Name.c_str());
+      }
+
+      { InterpolateBenchmark B(W, NewTime);
+        Time(SizeName("Interpolate", NTimes, ellMax), B, 2*ModeSamples, "samples", Filter, MinSeconds); }
+
+      if(Selected(SizeName("WaveformPointInterpolant::Evaluate", NTimes, ellMax), Filter)) {
+        // Time-delayed arrivals at three sites, as from a detector network
+        const GWFrames::WaveformPointInterpolant P(W);
+        const unsigned int NSites = 3;
+        const unsigned int NPoints = NSites*(NTimes/2);
+        vector<double> vartheta(NPoints), varphi(NPoints), tPoints(NPoints);
+        for(unsigned int i=0; i<NPoints; ++i) {
+          const unsigned int i_site = i%NSites;
+          vartheta[i] = 0.5+0.3*i_site;
+          varphi[i] = 0.7-0.2*i_site;
+          tPoints[i] = W.T(NTimes/4+i/NSites) + 0.01*i_site;
+        }
+        PointInterpolantBenchmark B(P, vartheta, varphi, tPoints);
+        Time(SizeName("WaveformPointInterpolant::Evaluate", NTimes, ellMax), B, NPoints, "points", Filter, MinSeconds);
+      }
+
+      { CorotatingBenchmark B(W);
+        Time(SizeName("TransformToCorotatingFrame", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds); }
+
+      { AlignBenchmark B(W, t1, t2);
+        Time(SizeName("AlignWaveforms", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds); }
+
+      { HybridizeBenchmark B(W, W, t1, t2);
+        Time(SizeName("Hybridize", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds); }
+
+      { FTBenchmark B(W);
+        Time(SizeName("WaveformAtAPointFT", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds); }
+
+      if(Selected(SizeName("Match", NTimes, ellMax), Filter)) {
+        const GWFrames::WaveformAtAPointFT A(W, W.T(1)-W.T(0), 0.5, 0.7, 40.0);
+        const GWFrames::WaveformAtAPointFT C(W, W.T(1)-W.T(0), 0.6, 0.8, 40.0);
+        const vector<double> InversePSD = A.InversePSD();
+        MatchBenchmark B(A, C, InversePSD);
+        Time(SizeName("Match", NTimes, ellMax), B, A.NFreq(), "frequencies", Filter, MinSeconds);
+      }
+
+      {
+        vector<vector<double> > deltax(NTimes, vector<double>(3, 0.0));
+        for(unsigned int i=0; i<NTimes; ++i) {
+          deltax[i][0] = 0.1;
+          deltax[i][2] = 0.05;
+        }
+        TranslateBenchmark B(W, deltax);
+        Time(SizeName("Translate", NTimes, ellMax), B, ModeSamples, "samples", Filter, MinSeconds);
+      }
+
+      if(Selected(SizeName("Scri::BMSTransformation", NTimes, ellMax), Filter)) {
+        const GWFrames::Scri S(ScriInput(W, 2), ScriInput(W, 1), ScriInput(W, 0),
+                               ScriInput(W, -1), ScriInput(W, -2), ScriInput(W, 2));
+        const unsigned int NSlices = 16;
+        vector<double> u0(NSlices);
+        for(unsigned int i=0; i<NSlices; ++i) {
+          u0[i] = t1 + (t2-t1)*i/(NSlices-1);
+        }
+        GWFrames::ThreeVector v(3, 0.0);
+        v[0] = 0.01;
+        v[1] = -0.02;
+        const GWFrames::Modes delta(0, vector<complex<double> >(4, 0.0));
+        BMSBenchmark B(S, u0, v, delta);
+        Time(SizeName("Scri::BMSTransformation", NTimes, ellMax), B, NSlices, "slices", Filter, MinSeconds);
+      }
+
+    }
+  }
+
+  return 0;
+}
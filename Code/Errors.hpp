@@ -11,7 +11,7 @@
 #define GWFrames_FailedSystemCall 1
 #define GWFrames_BadFileName 2
 #define GWFrames_FailedGSLCall 3
-// #define GWFrames_ 4
+#define GWFrames_UnknownException 4 // Any exception other than these codes, caught and passed on
 // #define GWFrames_ 5
 // #define GWFrames_ 6
 // #define GWFrames_ 7
@@ -291,12 +291,11 @@ def Extrapolate(**kwargs) :
           from the outermost extraction radius (which is -1).
 
         UseOmega                 False
-          Whether or not to extrapolate as a function of lambda/r =
-          1/(r*m*omega), where omega is the instantaneous angular
-          frequency of rotation.  If this is True, the extrapolation
-          will usually not converge for high N; if this is False, SVD
-          will generally cause the convergence to appear to fall to
-          roundoff, though the accuracy presumably is not so great.
+          Deprecated, and ignored.  This used to choose extrapolation
+          as a function of lambda/r = 1/(r*m*omega), where omega is
+          the instantaneous angular frequency of rotation, but scaling
+          the radii at each instant does not change the extrapolated
+          values.
 
         OutputFrame              GWFrames.Inertial
           Transform to this frame before comparison and output.
@@ -347,7 +346,7 @@ def Extrapolate(**kwargs) :
     from os.path import exists, basename, dirname
     from sys import stdout, stderr
     from textwrap import dedent
-    from numpy import sqrt, abs, fmod, pi, transpose, array
+    from numpy import abs, fmod, pi, transpose, array
     from scipy.interpolate import splev, splrep
     from GWFrames import Inertial, Corotating, Waveform
 
@@ -381,6 +380,8 @@ def Extrapolate(**kwargs) :
     if(ChMass==0.0) :
         print("WARNING: ChMass is being automatically determined from the data, rather than metadata.txt.")
         ChMass = PickChMass(HorizonsFile)
+    if(UseOmega) :
+        print("WARNING: UseOmega is deprecated and ignored; it does not change the extrapolated values.")
     # AlignmentTime is reset properly once the data are read in, if necessary.
     # The reasonableness of ExtrapolationOrder is checked below.
 
@@ -466,12 +467,6 @@ def Extrapolate(**kwargs) :
                    AlignmentTime = AlignmentTime)
     InputArguments = dedent(InputArguments)
 
-    # If required, figure out the orbital frequencies
-    if(UseOmega) :
-        Omegas = [sqrt(sum([c**2 for c in o])) for o in W_outer.AngularVelocityVectorRelativeToInertial([2])]
-    else :
-        Omegas = []
-
     # Transform W_outer into its smoothed corotating frame, and align modes with frame at given instant
     stdout.write("Rotating into common (outer) frame...\n"); stdout.flush()
     if(W_outer.FrameType() != Inertial) :
@@ -503,7 +498,12 @@ def Extrapolate(**kwargs) :
     #     print("Yep"); stdout.flush()
     # print([i for i in range(1)]); stdout.flush()
     # ExtrapolatedWaveforms = [ExtrapolatedWaveformsObject.GetWaveform(i) for i in range(ExtrapolatedWaveformsObject.size())]
-    ExtrapolatedWaveforms = _Extrapolate(Ws, Radii, ExtrapolationOrders, Omegas)
+    # The fits are done in C++ by `GWFrames.Extrapolate`, which gives
+    # the same results as `_Extrapolate` below.
+    from GWFrames import _vectorW
+    from GWFrames import Extrapolate as _ExtrapolateCpp
+    ExtrapolatedWaveforms = [Waveform(W) for W in
+                             _ExtrapolateCpp(_vectorW(Ws), [list(R) for R in Radii], [int(N) for N in ExtrapolationOrders])]
 
     NExtrapolations = len(ExtrapolationOrders)
     for i,ExtrapolationOrder in enumerate(ExtrapolationOrders) :
@@ -0,0 +1,216 @@
+// Copyright (c) 2014, Michael Boyle
+// See LICENSE file for details
+
+#include "Instrumentation.hpp"
+
+#include <sys/time.h>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <map>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "Errors.hpp"
+
+using std::vector;
+using std::string;
+using std::map;
+using std::cerr;
+using std::endl;
+
+volatile bool GWFrames::InstrumentationIsEnabled = false;
+volatile bool GWFrames::InstrumentationIsTracing = false;
+
+#ifndef DOXYGEN
+namespace {
+
+  // Stats are allocated once and never freed, so the pointers held by
+  // each instrumented site stay valid for the life of the program
+  map<string, GWFrames::InstrumentationStat*>& Registry() {
+    static map<string, GWFrames::InstrumentationStat*> Stats;
+    return Stats;
+  }
+
+  struct TraceEvent {
+    const GWFrames::InstrumentationStat* stat;
+    long long start, duration;
+    int thread;
+  };
+  vector<TraceEvent> TraceEvents;
+  const unsigned int MaxTraceEvents = 1000000;
+  long long TraceStart = 0;
+
+  // Sort by total time, then by count
+  struct StatIsLarger {
+    bool operator()(const GWFrames::InstrumentationStat* a, const GWFrames::InstrumentationStat* b) const {
+      if(a->microseconds!=b->microseconds) { return a->microseconds>b->microseconds; }
+      return a->count>b->count;
+    }
+  };
+
+}
+#endif // DOXYGEN
+
+/// Turn the library's timers and counters on or off
+void GWFrames::EnableInstrumentation(const bool Enable, const bool Trace) {
+  /// \param Enable If true, timers and counters accumulate [default: true]
+  /// \param Trace If true, every timed scope is also recorded as an event [default: false]
+  ///
+  /// Instrumentation is off by default, in which case each
+  /// instrumented site costs a single branch.  When it is on, the
+  /// major entry points (interpolation, frame transformations,
+  /// alignment, hybridization, translations and boosts, BMS
+  /// transformations, Fourier transforms and matches, and reading and
+  /// writing files) are timed, and the numbers of spline
+  /// initializations, spinsfast transforms, FFTs, and `MatrixC`
+  /// allocations are counted.  Totals are returned by
+  /// `InstrumentationSnapshot` and `InstrumentationReport` (or
+  /// `GWFrames.InstrumentationStats()` from python).
+  ///
+  /// With `Trace`, each timed scope is also recorded (up to a million
+  /// events) with its start time and thread, and can be written with
+  /// `OutputInstrumentationTrace`.
+  ///
+  /// \sa ResetInstrumentation
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    if(Trace && !InstrumentationIsTracing) { TraceStart = InstrumentationMicroseconds(); }
+    InstrumentationIsTracing = (Enable && Trace);
+    InstrumentationIsEnabled = Enable;
+  }
+}
+
+/// Return true if the timers and counters are accumulating
+bool GWFrames::InstrumentationEnabled() {
+  return InstrumentationIsEnabled;
+}
+
+/// Set all timers and counters to zero, and discard the trace
+void GWFrames::ResetInstrumentation() {
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    for(map<string, InstrumentationStat*>::iterator it=Registry().begin(); it!=Registry().end(); ++it) {
+      it->second->count = 0;
+      it->second->microseconds = 0;
+    }
+    vector<TraceEvent>().swap(TraceEvents);
+    TraceStart = InstrumentationMicroseconds();
+  }
+}
+
+/// Find (or create) the stat with the given name
+GWFrames::InstrumentationStat* GWFrames::InstrumentationRegister(const char* Name) {
+  InstrumentationStat* Stat = 0;
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    map<string, InstrumentationStat*>::iterator it = Registry().find(Name);
+    if(it==Registry().end()) {
+      it = Registry().insert(std::make_pair(string(Name), new InstrumentationStat())).first;
+      it->second->name = it->first.c_str();
+      it->second->count = 0;
+      it->second->microseconds = 0;
+    }
+    Stat = it->second;
+  }
+  return Stat;
+}
+
+/// Wall-clock time in microseconds
+long long GWFrames::InstrumentationMicroseconds() {
+  timeval now;
+  gettimeofday(&now, NULL);
+  return (long long)(now.tv_sec)*1000000 + now.tv_usec;
+}
+
+/// Add one event to the trace
+void GWFrames::InstrumentationRecordEvent(const InstrumentationStat* Stat, const long long Start, const long long Duration) {
+  TraceEvent Event;
+  Event.stat = Stat;
+  Event.start = Start;
+  Event.duration = Duration;
+  #ifdef _OPENMP
+  Event.thread = omp_get_thread_num();
+  #else
+  Event.thread = 0;
+  #endif
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    if(TraceEvents.size()<MaxTraceEvents) { TraceEvents.push_back(Event); }
+  }
+}
+
+/// Copy the current totals of every timer and counter
+void GWFrames::InstrumentationSnapshot(std::vector<std::string>& Names, std::vector<long>& Counts, std::vector<double>& Seconds) {
+  /// \param Names On output, the name of each stat, sorted by decreasing total time
+  /// \param Counts On output, the number of times each was timed, or the total of each counter
+  /// \param Seconds On output, the total time for each (zero for counters)
+  vector<InstrumentationStat*> Stats;
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    for(map<string, InstrumentationStat*>::iterator it=Registry().begin(); it!=Registry().end(); ++it) {
+      Stats.push_back(it->second);
+    }
+  }
+  std::stable_sort(Stats.begin(), Stats.end(), StatIsLarger());
+  Names.resize(Stats.size());
+  Counts.resize(Stats.size());
+  Seconds.resize(Stats.size());
+  for(unsigned int i=0; i<Stats.size(); ++i) {
+    Names[i] = Stats[i]->name;
+    Counts[i] = Stats[i]->count;
+    Seconds[i] = 1.e-6*Stats[i]->microseconds;
+  }
+}
+
+/// Return a table of the current totals
+std::string GWFrames::InstrumentationReport() {
+  vector<string> Names;
+  vector<long> Counts;
+  vector<double> Seconds;
+  InstrumentationSnapshot(Names, Counts, Seconds);
+  std::stringstream Report;
+  Report << std::left << std::setw(48) << "# Name" << std::right << std::setw(14) << "Count" << std::setw(14) << "Seconds" << "\n";
+  for(unsigned int i=0; i<Names.size(); ++i) {
+    if(Counts[i]==0) { continue; }
+    Report << std::left << std::setw(48) << Names[i] << std::right << std::setw(14) << Counts[i]
+           << std::setw(14) << std::setprecision(6) << Seconds[i] << "\n";
+  }
+  return Report.str();
+}
+
+/// Write the recorded events as a Chrome trace-event file
+void GWFrames::OutputInstrumentationTrace(const std::string& FileName) {
+  /// \param FileName Relative path to the output file
+  ///
+  /// The file is in the JSON "trace event" format, which can be
+  /// viewed in chrome://tracing or https://ui.perfetto.dev, with one
+  /// track for each OpenMP thread.  Events are only recorded while
+  /// instrumentation is enabled with `Trace=true`.
+  vector<TraceEvent> Events;
+  long long Start = 0;
+  #pragma omp critical(GWFrames_Instrumentation)
+  {
+    Events = TraceEvents;
+    Start = TraceStart;
+  }
+  FILE* fp = std::fopen(FileName.c_str(), "w");
+  if(!fp) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "' for writing." << endl;
+    throw(GWFrames_BadFileName);
+  }
+  std::fprintf(fp, "{\"traceEvents\":[\n");
+  for(unsigned int i=0; i<Events.size(); ++i) {
+    std::fprintf(fp, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":0,\"tid\":%d}%s\n",
+                 Events[i].stat->name, Events[i].start-Start, Events[i].duration, Events[i].thread,
+                 (i+1<Events.size() ? "," : ""));
+  }
+  std::fprintf(fp, "]}\n");
+  const bool Failed = std::ferror(fp);
+  if(std::fclose(fp)!=0 || Failed) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed to write '" << FileName << "'." << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+}
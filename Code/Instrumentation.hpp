@@ -0,0 +1,85 @@
+// Copyright (c) 2014, Michael Boyle
+// See LICENSE file for details
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <string>
+#include <vector>
+
+namespace GWFrames {
+
+  // Run-time control of the timers and counters
+  void EnableInstrumentation(const bool Enable=true, const bool Trace=false);
+  bool InstrumentationEnabled();
+  void ResetInstrumentation();
+  void InstrumentationSnapshot(std::vector<std::string>& Names, std::vector<long>& Counts, std::vector<double>& Seconds);
+  std::string InstrumentationReport();
+  void OutputInstrumentationTrace(const std::string& FileName);
+
+  #ifndef DOXYGEN
+  // Totals for one name, shared by every site using that name
+  struct InstrumentationStat {
+    const char* name;
+    volatile long count;
+    volatile long long microseconds;
+  };
+  extern volatile bool InstrumentationIsEnabled;
+  extern volatile bool InstrumentationIsTracing;
+  InstrumentationStat* InstrumentationRegister(const char* Name);
+  long long InstrumentationMicroseconds();
+  void InstrumentationRecordEvent(const InstrumentationStat* Stat, const long long Start, const long long Duration);
+
+  // Adds the time from construction to destruction to its stat
+  class InstrumentationTimer {
+  private:
+    InstrumentationStat* stat;
+    long long start;
+    InstrumentationTimer(const InstrumentationTimer&);
+    InstrumentationTimer& operator=(const InstrumentationTimer&);
+  public:
+    InstrumentationTimer(InstrumentationStat* Stat)
+      : stat(InstrumentationIsEnabled ? Stat : 0), start(stat ? InstrumentationMicroseconds() : 0) { }
+    ~InstrumentationTimer() {
+      if(stat) {
+        const long long duration = InstrumentationMicroseconds()-start;
+        __sync_fetch_and_add(&stat->count, 1L);
+        __sync_fetch_and_add(&stat->microseconds, duration);
+        if(InstrumentationIsTracing) { InstrumentationRecordEvent(stat, start, duration); }
+      }
+    }
+  };
+
+  inline void InstrumentationCount(InstrumentationStat* Stat, const long N) {
+    if(InstrumentationIsEnabled) { __sync_fetch_and_add(&Stat->count, N); }
+  }
+  #endif // DOXYGEN
+
+} // namespace GWFrames
+
+// These macros are the only way the rest of the code touches the
+// instrumentation.  `GWFrames_INSTRUMENT_SCOPE("Name")` times the
+// rest of the enclosing block, and `GWFrames_INSTRUMENT_COUNT("Name",
+// N)` adds N to a counter.  Each site looks up its stat only once.
+// Compiling with -DGWFrames_DISABLE_INSTRUMENTATION removes them
+// entirely; otherwise, each costs one branch while instrumentation is
+// disabled at run time (the default).
+#ifdef GWFrames_DISABLE_INSTRUMENTATION
+#define GWFrames_INSTRUMENT_SCOPE(Name)
+#define GWFrames_INSTRUMENT_COUNT(Name, N)
+#else
+#define GWFrames_INSTRUMENT_CONCAT2(a,b) a##b
+#define GWFrames_INSTRUMENT_CONCAT(a,b) GWFrames_INSTRUMENT_CONCAT2(a,b)
+#define GWFrames_INSTRUMENT_SCOPE(Name)                                 \
+  static GWFrames::InstrumentationStat* const GWFrames_INSTRUMENT_CONCAT(GWFrames_InstrumentationStat_,__LINE__) \
+    = GWFrames::InstrumentationRegister(Name);                          \
+  GWFrames::InstrumentationTimer GWFrames_INSTRUMENT_CONCAT(GWFrames_InstrumentationTimer_,__LINE__) \
+    (GWFrames_INSTRUMENT_CONCAT(GWFrames_InstrumentationStat_,__LINE__))
+#define GWFrames_INSTRUMENT_COUNT(Name, N)                              \
+  do {                                                                  \
+    static GWFrames::InstrumentationStat* const GWFrames_InstrumentationStat_Count = GWFrames::InstrumentationRegister(Name); \
+    GWFrames::InstrumentationCount(GWFrames_InstrumentationStat_Count, (N)); \
+  } while(0)
+#endif
+
+#endif // INSTRUMENTATION_HPP
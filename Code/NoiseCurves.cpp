@@ -4,6 +4,10 @@
 #include "Errors.hpp"
 #include "Interpolate.hpp"
 #include <limits>
+#include <map>
+#include <cmath>
+#include <fstream>
+#include <sstream>
 
 namespace WU = WaveformUtilities;
 using std::vector;
@@ -19,95 +23,332 @@ using GWFrames::log;
 using GWFrames::pow;
 using GWFrames::operator*;
 
-vector<double> AdvLIGO_NSNSOptimal(const vector<double>& F, const bool Invert=false, const double NoiseFloor=0.0) {
-  const double FMin = max(NoiseFloor, WU::AdvLIGOSeismicWall);
-  const double FMax = 8192;
-  vector<double> PSD(F.size(), 0.0);
-  if(Invert) {
-    for(unsigned int i=0; i<F.size(); ++i) {
-      if(fabs(F[i])<FMin || fabs(F[i])>FMax) { PSD[i] = 0.0; }
-      else {
-	PSD[i] = 1.0e49 / (pow(10, -4*(fabs(F[i])-7.9)*(fabs(F[i])-7.9)+16)
-			+ 2.4e-62*pow(fabs(F[i])/215.0,-50)
-			+ 0.08*pow(fabs(F[i])/215.0,-4.69)
-			+ 123.35*(1.0 - 0.23*(fabs(F[i])/215)*(fabs(F[i])/215) + 0.0764*(fabs(F[i])/215)*(fabs(F[i])/215)*(fabs(F[i])/215)*(fabs(F[i])/215)) / (1.0 + 0.17*(fabs(F[i])/215)*(fabs(F[i])/215)) );
+#ifndef DOXYGEN
+namespace {
+
+  // Each detector noise model evaluates the PSD (or its inverse) at
+  // every frequency in F.  PSD need not have the right size on input.
+  class NoiseModel {
+  public:
+    virtual ~NoiseModel() { }
+    virtual void Evaluate(const vector<double>& F, const bool Invert, const double NoiseFloor, vector<double>& PSD) const = 0;
+  };
+
+  // An analytic fit, which is evaluated over the whole array in one
+  // branch-free loop, so that the compiler can inline (and, where its
+  // math library allows, vectorize) the fit.  Outside the band
+  // [max(NoiseFloor,SeismicWall), FMax], the PSD is infinite.
+  template <class Fit>
+  class AnalyticNoiseModel : public NoiseModel {
+  public:
+    void Evaluate(const vector<double>& F, const bool Invert, const double NoiseFloor, vector<double>& PSD) const {
+      const double FMin = max(NoiseFloor, Fit::SeismicWall());
+      const double FMax = Fit::FMax();
+      const double OutOfBand = (Invert ? 0.0 : numeric_limits<double>::infinity());
+      const int N = F.size();
+      PSD.resize(N);
+      if(Invert) {
+        for(int i=0; i<N; ++i) {
+          const double f = std::fabs(F[i]);
+          const bool InBand = !(f<FMin || f>FMax);
+          const double Value = Fit::InversePSD(InBand ? f : FMax);
+          PSD[i] = (InBand ? Value : OutOfBand);
+        }
+      } else {
+        for(int i=0; i<N; ++i) {
+          const double f = std::fabs(F[i]);
+          const bool InBand = !(f<FMin || f>FMax);
+          const double Value = Fit::PSD(InBand ? f : FMax);
+          PSD[i] = (InBand ? Value : OutOfBand);
+        }
       }
     }
-  } else {
-    for(unsigned int i=0; i<F.size(); ++i) {
-      if(fabs(F[i])<FMin || fabs(F[i])>FMax) { PSD[i] = numeric_limits<double>::infinity(); }
-      else {
-	PSD[i] = 1.0e-49*(pow(10, -4*(fabs(F[i])-7.9)*(fabs(F[i])-7.9)+16)
-			  + 2.4e-62*pow(fabs(F[i])/215.0,-50)
-			  + 0.08*pow(fabs(F[i])/215.0,-4.69)
-			  + 123.35*(1.0-0.23*(fabs(F[i])/215)*(fabs(F[i])/215)+ 0.0764*(fabs(F[i])/215)*(fabs(F[i])/215)*(fabs(F[i])/215)*(fabs(F[i])/215)) / (1.0 +0.17*(fabs(F[i])/215)*(fabs(F[i])/215)));
-      }
+  };
+
+  // Collin Capano's fit for the NS-NS optimized noise curve
+  struct AdvLIGO_NSNSOptimal {
+    static double SeismicWall() { return WU::AdvLIGOSeismicWall; }
+    static double FMax() { return 8192; }
+    static double PSD(const double f) {
+      return 1.0e-49*(pow(10, -4*(f-7.9)*(f-7.9)+16)
+                      + 2.4e-62*pow(f/215.0,-50)
+                      + 0.08*pow(f/215.0,-4.69)
+                      + 123.35*(1.0-0.23*(f/215)*(f/215)+ 0.0764*(f/215)*(f/215)*(f/215)*(f/215)) / (1.0 +0.17*(f/215)*(f/215)));
     }
-  }
-  return PSD;
-}
+    static double InversePSD(const double f) {
+      return 1.0e49 / (pow(10, -4*(f-7.9)*(f-7.9)+16)
+                       + 2.4e-62*pow(f/215.0,-50)
+                       + 0.08*pow(f/215.0,-4.69)
+                       + 123.35*(1.0 - 0.23*(f/215)*(f/215) + 0.0764*(f/215)*(f/215)*(f/215)*(f/215)) / (1.0 + 0.17*(f/215)*(f/215)) );
+    }
+  };
 
-vector<double> AdvLIGO_ZeroDet_HighP(const vector<double>& F, const bool Invert=false, const double NoiseFloor=0.0) {
-  #include "NoiseCurves/AdvLIGO_ZeroDet_HighP.ipp"
-  vector<double> LogPSD;
-  LogPSD = WU::Interpolate(ZERO_DET_high_PLogF, ZERO_DET_high_PLogPSD, log(fabs(F)));
-  const double MinFreq(max(NoiseFloor, WU::AdvLIGOSeismicWall));
-  for(unsigned int i=0; i<LogPSD.size(); ++i) if(fabs(F[i])<MinFreq) { LogPSD[i] = 500.0; }
-  if(Invert) { return exp(-1.0*LogPSD); }
-  return exp(LogPSD);
-}
-vector<double> AdvLIGO_ZeroDet_LowP(const vector<double>& F, const bool Invert=false, const double NoiseFloor=0.0) {
-  #include "NoiseCurves/AdvLIGO_ZeroDet_LowP.ipp"
-  vector<double> LogPSD(WU::Interpolate(ZERO_DET_low_PLogF, ZERO_DET_low_PLogPSD, log(fabs(F))));
-  const double MinFreq(max(NoiseFloor, WU::AdvLIGOSeismicWall));
-  for(unsigned int i=0; i<LogPSD.size(); ++i) if(fabs(F[i])<MinFreq) { LogPSD[i] = 500.0; }
-  if(Invert) { return exp(-1.0*LogPSD); }
-  return exp(LogPSD);
-}
+  // The Initial LIGO design goal
+  struct IniLIGO_Approx {
+    static double SeismicWall() { return WU::IniLIGOSeismicWall; }
+    static double FMax() { return WU::IniLIGOSamplingFreq; }
+    static double PSD(const double f) {
+      const double x = f / 150.0;
+      //return 9e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52); // Table IV of PRD 63 044023
+      return 3.136e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52); // Eq. (10) of CQG 26 (2009) 114006
+    }
+    static double InversePSD(const double f) {
+      const double x = f / 150.0;
+      return 1.0 / (3.136e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52));
+    }
+  };
 
-vector<double> IniLIGO_Approx(const vector<double>& F, const bool Invert=false, const double NoiseFloor=0.0) {
-  const double FMin = max(NoiseFloor, WU::IniLIGOSeismicWall);
-  const double FMax = WU::IniLIGOSamplingFreq;
-  vector<double> PSD(F.size(), 0.0);
-  if(Invert) {
-    for(unsigned int i=0; i<F.size(); ++i) {
-      const double f = fabs(F[i]);
-      if(f<FMin || f>FMax) { PSD[i] = 0.0; }
-      else {
- 	const double x = f / 150.0;
-	//PSD[i] = 1.0 / (9e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52)); // Table IV of PRD 63 044023
-	PSD[i] = 1.0 / (3.136e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52)); // Eq. (10) of CQG 26 (2009) 114006
+  // A tabulated curve, interpolated in log-log space with a natural
+  // cubic spline.  The table is stored on a uniform grid in log(f),
+  // so the interval containing each frequency is found directly from
+  // its logarithm, rather than by searching; the spline itself is
+  // the same as that of `WU::Interpolate`.  Below
+  // max(NoiseFloor,SeismicWall), log(PSD) is taken to be 500.
+  class TabulatedNoiseModel : public NoiseModel {
+  private:
+    vector<double> LogF, LogPSD, y2;
+    double LogF0, InverseDLogF, SeismicWall;
+  public:
+    TabulatedNoiseModel(const vector<double>& logF, const vector<double>& logPSD, const double seismicWall)
+      : LogF(logF), LogPSD(logPSD), y2(logF.size()), LogF0(0.0), InverseDLogF(0.0), SeismicWall(seismicWall)
+    {
+      const int N = LogF.size();
+      // Resample onto a uniform grid in log(f), if necessary
+      const double dLogF = (LogF[N-1]-LogF[0])/double(N-1);
+      bool Uniform = true;
+      for(int i=1; i<N; ++i) {
+        if(std::fabs((LogF[i]-LogF[i-1])-dLogF) > 1.e-8*dLogF) { Uniform = false; break; }
+      }
+      if(!Uniform) {
+        vector<double> UniformLogF(N);
+        for(int i=0; i<N; ++i) {
+          UniformLogF[i] = LogF[0] + i*dLogF;
+        }
+        UniformLogF[N-1] = LogF[N-1];
+        LogPSD = WU::Interpolate(LogF, LogPSD, UniformLogF);
+        LogF.swap(UniformLogF);
+      }
+      LogF0 = LogF[0];
+      InverseDLogF = 1.0/dLogF;
+      // Second derivatives for the natural spline, exactly as in
+      // `WU::SplineInterpolator::sety2`
+      vector<double> u(N-1);
+      y2[0] = u[0] = 0.0;
+      for(int i=1; i<N-1; ++i) {
+        const double sig = (LogF[i]-LogF[i-1])/(LogF[i+1]-LogF[i-1]);
+        const double p = sig*y2[i-1]+2.0;
+        y2[i] = (sig-1.0)/p;
+        u[i] = (LogPSD[i+1]-LogPSD[i])/(LogF[i+1]-LogF[i]) - (LogPSD[i]-LogPSD[i-1])/(LogF[i]-LogF[i-1]);
+        u[i] = (6.0*u[i]/(LogF[i+1]-LogF[i-1])-sig*u[i-1])/p;
+      }
+      y2[N-1] = 0.0;
+      for(int k=N-2; k>=0; --k) {
+        y2[k] = y2[k]*y2[k+1]+u[k];
       }
     }
-  } else {
-    for(unsigned int i=0; i<F.size(); ++i) {
-      const double f = fabs(F[i]);
-      if(f<FMin || f>FMax) { PSD[i] = numeric_limits<double>::infinity(); }
-      else {
- 	const double x = f / 150.0;
-	//PSD[i] = 9e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52); // Table IV of PRD 63 044023
-	PSD[i] = 3.136e-46 * (pow(4.49*x, -56) + 0.16*pow(x, -4.52) + 0.32*pow(x,2) + 0.52); // Eq. (10) of CQG 26 (2009) 114006
+    void Evaluate(const vector<double>& F, const bool Invert, const double NoiseFloor, vector<double>& PSD) const {
+      const double MinFreq = max(NoiseFloor, SeismicWall);
+      const int N = F.size();
+      const int NTable = LogF.size();
+      PSD.resize(N);
+      for(int i=0; i<N; ++i) {
+        const double f = std::fabs(F[i]);
+        double logPSD = 500.0;
+        if(!(f<MinFreq)) {
+          const double x = std::log(f);
+          // The interval with LogF[k] <= x < LogF[k+1], clamped to the
+          // end intervals; the direct guess can be off by one only
+          // because of roundoff
+          int k = int(std::min(std::max((x-LogF0)*InverseDLogF, 0.0), double(NTable-2)));
+          while(k>0 && x<LogF[k]) { --k; }
+          while(k<NTable-2 && x>=LogF[k+1]) { ++k; }
+          const double h = LogF[k+1]-LogF[k];
+          const double a = (LogF[k+1]-x)/h;
+          const double b = (x-LogF[k])/h;
+          logPSD = a*LogPSD[k]+b*LogPSD[k+1]+((a*a*a-a)*y2[k]+(b*b*b-b)*y2[k+1])*(h*h)/6.0;
+        }
+        PSD[i] = std::exp(Invert ? -1.0*logPSD : logPSD);
       }
     }
+  };
+
+  NoiseModel* AdvLIGO_ZeroDet_HighP() {
+    #include "NoiseCurves/AdvLIGO_ZeroDet_HighP.ipp"
+    return new TabulatedNoiseModel(ZERO_DET_high_PLogF, ZERO_DET_high_PLogPSD, WU::AdvLIGOSeismicWall);
   }
-  return PSD;
+  NoiseModel* AdvLIGO_ZeroDet_LowP() {
+    #include "NoiseCurves/AdvLIGO_ZeroDet_LowP.ipp"
+    return new TabulatedNoiseModel(ZERO_DET_low_PLogF, ZERO_DET_low_PLogPSD, WU::AdvLIGOSeismicWall);
+  }
+
+  // The registry of noise models by name, which starts with the
+  // compiled-in models.  Models are never deleted (even when replaced
+  // by `LoadNoiseCurve`), so pointers to them stay valid while other
+  // threads are evaluating them.  Access only within
+  // `critical(GWFrames_NoiseCurveRegistry)`.
+  std::map<string, const NoiseModel*>& NoiseModelRegistry() {
+    static std::map<string, const NoiseModel*> Registry;
+    if(Registry.empty()) {
+      Registry["AdvLIGO_NSNSOptimal"] = new AnalyticNoiseModel<AdvLIGO_NSNSOptimal>();
+      Registry["AdvLIGO_ZeroDet_HighP"] = AdvLIGO_ZeroDet_HighP();
+      Registry["AdvLIGO_ZeroDet_LowP"] = AdvLIGO_ZeroDet_LowP();
+      Registry["IniLIGO_Approx"] = new AnalyticNoiseModel<IniLIGO_Approx>();
+    }
+    return Registry;
+  }
+
+  const NoiseModel* FindNoiseModel(const string& Detector) {
+    const NoiseModel* Model = 0;
+    #pragma omp critical(GWFrames_NoiseCurveRegistry)
+    {
+      std::map<string, const NoiseModel*>::const_iterator it = NoiseModelRegistry().find(Detector);
+      if(it!=NoiseModelRegistry().end()) { Model = it->second; }
+    }
+    return Model;
+  }
+
 }
+#endif // DOXYGEN
 
 vector<double> WU::NoiseCurve(const vector<double>& F, const string& Detector, const bool Invert, const double NoiseFloor) {
-  if(Detector.compare("AdvLIGO_NSNSOptimal")==0) {
-    return AdvLIGO_NSNSOptimal(F, Invert, NoiseFloor);
-  } else if(Detector.compare("AdvLIGO_ZeroDet_HighP")==0) {
-    return AdvLIGO_ZeroDet_HighP(F, Invert, NoiseFloor);
-  } else if(Detector.compare("AdvLIGO_ZeroDet_LowP")==0) {
-    return AdvLIGO_ZeroDet_LowP(F, Invert, NoiseFloor);
-  } else if(Detector.compare("IniLIGO_Approx")==0) {
-    return IniLIGO_Approx(F, Invert, NoiseFloor);
-  } else {
+  const NoiseModel* Model = FindNoiseModel(Detector);
+  if(!Model) {
     cerr << "\nUnknown Detector type: '" << Detector << "'" << endl;
     throw(GWFrames_UnknownDetector);
   }
+  vector<double> PSD;
+  Model->Evaluate(F, Invert, NoiseFloor, PSD);
+  return PSD;
 }
 
 vector<double> WU::InverseNoiseCurve(const vector<double>& F, const string& Detector, const double NoiseFloor) {
   return NoiseCurve(F, Detector, true, NoiseFloor);
 }
+
+#ifndef DOXYGEN
+namespace {
+
+  struct NoiseCurveKey {
+    std::string Detector;
+    double df;
+    unsigned int NFreq;
+    double NoiseFloor;
+    NoiseCurveKey(const std::string& detector, const double DF, const unsigned int nfreq, const double noisefloor)
+      : Detector(detector), df(DF), NFreq(nfreq), NoiseFloor(noisefloor) { }
+    bool operator<(const NoiseCurveKey& b) const {
+      if(NFreq!=b.NFreq) { return NFreq<b.NFreq; }
+      if(df!=b.df) { return df<b.df; }
+      if(NoiseFloor!=b.NoiseFloor) { return NoiseFloor<b.NoiseFloor; }
+      return Detector<b.Detector;
+    }
+  };
+
+  // References to elements of a std::map remain valid as other
+  // elements are inserted, so it is safe to hand them out
+  std::map<NoiseCurveKey, vector<double> > InverseNoiseCurveCache;
+
+}
+#endif // DOXYGEN
+
+const vector<double>& WU::CachedInverseNoiseCurve(const double df, const unsigned int NFreq, const string& Detector, const double NoiseFloor) {
+  const NoiseCurveKey Key(Detector, df, NFreq, NoiseFloor);
+  const vector<double>* InversePSD = 0;
+  int ErrorCode = 0;
+  #pragma omp critical(GWFrames_NoiseCurveCache)
+  {
+    std::map<NoiseCurveKey, vector<double> >::const_iterator it = InverseNoiseCurveCache.find(Key);
+    if(it!=InverseNoiseCurveCache.end()) {
+      InversePSD = &(it->second);
+    } else {
+      vector<double> F(NFreq);
+      for(unsigned int i=0; i<NFreq; ++i) {
+        F[i] = i*df;
+      }
+      // Exceptions can't escape the critical section, so rethrow below
+      try {
+        vector<double> NewInversePSD = NoiseCurve(F, Detector, true, NoiseFloor);
+        InversePSD = &(InverseNoiseCurveCache[Key]);
+        InverseNoiseCurveCache[Key].swap(NewInversePSD);
+      } catch(int e) {
+        ErrorCode = e;
+      } catch(...) {
+        ErrorCode = GWFrames_UnknownException;
+      }
+    }
+  }
+  if(!InversePSD) {
+    throw(ErrorCode);
+  }
+  return *InversePSD;
+}
+
+void WU::ClearNoiseCurveCache() {
+  #pragma omp critical(GWFrames_NoiseCurveCache)
+  {
+    InverseNoiseCurveCache.clear();
+  }
+}
+
+/// Add (or replace) a detector noise curve, read from a text file
+void WU::LoadNoiseCurve(const std::string& Detector, const std::string& FileName, const double SeismicWall) {
+  /// \param Detector Name by which the curve will be known to `NoiseCurve`, etc.
+  /// \param FileName Path to a file with columns of frequency (in Hz) and square-root PSD
+  /// \param SeismicWall Frequency (in Hz) below which the PSD is effectively infinite
+  ///
+  /// The file format is that of the files in the `NoiseCurves`
+  /// directory: two whitespace-separated columns, with strictly
+  /// increasing frequencies.  Blank lines and lines starting with `#`
+  /// are ignored.  The curve is interpolated in log-log space, like
+  /// the compiled AdvLIGO curves; if the frequencies are not evenly
+  /// spaced in log(f), the data are first resampled so that they
+  /// are.  Any cached curves with this name are discarded, so this
+  /// must not be called while other threads are using the
+  /// `CachedInverseNoiseCurve` results for this detector.
+  std::ifstream File(FileName.c_str());
+  if(!File) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "'." << endl;
+    throw(GWFrames_BadFileName);
+  }
+  vector<double> LogF, LogPSD;
+  string Line;
+  while(std::getline(File, Line)) {
+    const std::size_t First = Line.find_first_not_of(" \t\r");
+    if(First==string::npos || Line[First]=='#') { continue; }
+    std::istringstream Columns(Line);
+    double f, ASD;
+    if(!(Columns >> f >> ASD) || !(f>0.0) || !(ASD>0.0) || (LogF.size()>0 && !(std::log(f)>LogF.back()))) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Bad line in '" << FileName << "':\n" << Line
+           << "\nExpected positive, increasing frequencies and positive square-root PSD values." << endl;
+      throw(GWFrames_ValueError);
+    }
+    LogF.push_back(std::log(f));
+    LogPSD.push_back(2.0*std::log(ASD));
+  }
+  if(LogF.size()<3) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Found only " << LogF.size() << " points in '" << FileName << "'." << endl;
+    throw(GWFrames_ValueError);
+  }
+  const NoiseModel* Model = new TabulatedNoiseModel(LogF, LogPSD, SeismicWall);
+  #pragma omp critical(GWFrames_NoiseCurveRegistry)
+  {
+    NoiseModelRegistry()[Detector] = Model;
+  }
+  #pragma omp critical(GWFrames_NoiseCurveCache)
+  {
+    for(std::map<NoiseCurveKey, vector<double> >::iterator it=InverseNoiseCurveCache.begin(); it!=InverseNoiseCurveCache.end(); ) {
+      if(it->first.Detector==Detector) { InverseNoiseCurveCache.erase(it++); } else { ++it; }
+    }
+  }
+}
+
+/// Return the names of all the available detector noise curves
+std::vector<std::string> WU::NoiseCurveNames() {
+  vector<string> Names;
+  #pragma omp critical(GWFrames_NoiseCurveRegistry)
+  {
+    for(std::map<string, const NoiseModel*>::const_iterator it=NoiseModelRegistry().begin(); it!=NoiseModelRegistry().end(); ++it) {
+      Names.push_back(it->first);
+    }
+  }
+  return Names;
+}
@@ -21,6 +21,19 @@ namespace WaveformUtilities {
                                         const std::string& Detector="AdvLIGO_ZeroDet_HighP",
                                         const double NoiseFloor=0.0);
 
+  /// This returns the inverse noise curve on the uniform grid of
+  /// frequencies F[i]=i*df for i=0,...,NFreq-1 (as returned by
+  /// TimeToPositiveFrequencies), computing it only the first time a
+  /// given (Detector, df, NFreq, NoiseFloor) is requested.  The
+  /// returned reference remains valid until ClearNoiseCurveCache is
+  /// called, which must not happen while other threads are using the
+  /// cache.
+  const std::vector<double>& CachedInverseNoiseCurve(const double df,
+                                                     const unsigned int NFreq,
+                                                     const std::string& Detector="AdvLIGO_ZeroDet_HighP",
+                                                     const double NoiseFloor=0.0);
+  void ClearNoiseCurveCache();
+
   /// These constants are reported in the Advanced LIGO design study http://www.ligo.caltech.edu/docs/T/T010075-00.pdf
   /// Note that the sampling rate is frequently cut down by data analysts to 1/2 or 1/4 before any data is processed.
   /// Also note that a more realistic seismic wall early in Adv. LIGO's life will be more like 20Hz.
@@ -33,6 +46,13 @@ namespace WaveformUtilities {
   const double VirgoSeismicWall = 10.0; // Units of Hz
   const double VirgoSamplingFreq = 16384.0; // Units of Hz
 
+  /// Detectors are looked up by name in a registry, which starts with
+  /// the curves listed above.  Others (e.g., the remaining files in
+  /// the NoiseCurves directory) may be added at run time.
+  void LoadNoiseCurve(const std::string& Detector, const std::string& FileName,
+                      const double SeismicWall=AdvLIGOSeismicWall);
+  std::vector<std::string> NoiseCurveNames();
+
 }
 
 #endif // NOISECURVES_HPP
@@ -6,11 +6,14 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
+#include <utility>
 #include <gsl/gsl_odeiv2.h>
 #include "PNWaveforms.hpp"
 #include "PostNewtonian/C++/PNEvolution.hpp"
 #include "PostNewtonian/C++/PNWaveformModes.hpp"
 #include "Quaternions.hpp"
+#include "SphericalFunctions/SWSHs.hpp"
 #include "Utilities.hpp"
 #include "Errors.hpp"
 
@@ -40,13 +43,14 @@ inline double dotproduct(const double* a, const double* b) {
 
 /// Default constructor for an empty object
 GWFrames::PNWaveform::PNWaveform() :
-  Waveform(), mchi1(0), mchi2(0), mOmega_orb(0), mOmega_prec(0), mL(0), mPhi_orb(0)
+  Waveform(), mchi1(0), mchi2(0), mOmega_orb(0), mOmega_prec(0), mL(0), mPhi_orb(0),
+  mv(0), mdelta(0.0), mPNWaveformModeOrder(0.0)
 {
   SetFrameType(GWFrames::Coorbital);
   SetDataType(GWFrames::h);
   SetRIsScaledOut(true);
   SetMIsScaledOut(true);
-  { // Overwrite the history from Waveform
+  if(recordHistory) { // Overwrite the history from Waveform
     char path[MAXPATHLEN];
     char* result = getcwd(path, MAXPATHLEN);
     if(!result) {
@@ -59,9 +63,11 @@ GWFrames::PNWaveform::PNWaveform() :
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history.str("");
-    history.clear();
+    ResetHistoryStream();
     history << "### Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << std::endl
             << "### pwd = " << pwd << std::endl
             << "### hostname = " << hostname << std::endl
@@ -72,21 +78,48 @@ GWFrames::PNWaveform::PNWaveform() :
 
 /// Copy constructor
 GWFrames::PNWaveform::PNWaveform(const PNWaveform& a) :
-  Waveform(a), mchi1(a.mchi1), mchi2(a.mchi2), mOmega_orb(a.mOmega_orb), mOmega_prec(a.mOmega_prec), mL(a.mL), mPhi_orb(a.mPhi_orb)
+  Waveform(a), mchi1(a.mchi1), mchi2(a.mchi2), mOmega_orb(a.mOmega_orb), mOmega_prec(a.mOmega_prec), mL(a.mL), mPhi_orb(a.mPhi_orb),
+  mv(a.mv), mdelta(a.mdelta), mPNWaveformModeOrder(a.mPNWaveformModeOrder)
 {
   /// Simply copies all fields in the input object to the constructed
   /// object, including history
   history.seekp(0, std::ios_base::end);
 }
 
+#if __cplusplus >= 201103L
+/// Move constructor
+GWFrames::PNWaveform::PNWaveform(PNWaveform&& a) noexcept :
+  Waveform(std::move(a)), mchi1(), mchi2(), mOmega_orb(), mOmega_prec(), mL(), mPhi_orb(),
+  mv(), mdelta(a.mdelta), mPNWaveformModeOrder(a.mPNWaveformModeOrder)
+{
+  /// As with `Waveform`, the data are taken from the input object
+  /// without being copied.
+  mchi1.swap(a.mchi1);
+  mchi2.swap(a.mchi2);
+  mOmega_orb.swap(a.mOmega_orb);
+  mOmega_prec.swap(a.mOmega_prec);
+  mL.swap(a.mL);
+  mPhi_orb.swap(a.mPhi_orb);
+  mv.swap(a.mv);
+}
+
+/// Move assignment operator
+GWFrames::PNWaveform& GWFrames::PNWaveform::operator=(PNWaveform&& a) noexcept {
+  swap(a);
+  return *this;
+}
+#endif // __cplusplus >= 201103L
+
 
 /// Constructor of PN waveform from parameters
 GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double delta,
                                  const std::vector<double>& chi1_i, const std::vector<double>& chi2_i,
                                  const double Omega_orb_i, double Omega_orb_0,
                                  const Quaternions::Quaternion& R_frame_i, const unsigned int MinStepsPerOrbit,
-                                 const double PNWaveformModeOrder, const double PNOrbitalEvolutionOrder) :
-  Waveform(), mchi1(0), mchi2(0), mOmega_orb(0), mOmega_prec(0), mL(0), mPhi_orb(0)
+                                 const double PNWaveformModeOrder, const double PNOrbitalEvolutionOrder,
+                                 const int ellMax) :
+  Waveform(), mchi1(0), mchi2(0), mOmega_orb(0), mOmega_prec(0), mL(0), mPhi_orb(0),
+  mv(0), mdelta(delta), mPNWaveformModeOrder(PNWaveformModeOrder)
 {
   /// See GWFrames/Code/SWIG/Extensions.py for the docstring for this object
 
@@ -100,7 +133,7 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
   SetRIsScaledOut(true);
   SetMIsScaledOut(true);
 
-  { // Overwrite the history from Waveform
+  if(recordHistory) { // Overwrite the history from Waveform
     char path[MAXPATHLEN];
     char* result = getcwd(path, MAXPATHLEN);
     if(!result) {
@@ -113,27 +146,71 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history.str("");
-    history.clear();
+    ResetHistoryStream();
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << std::endl
             << "# pwd = " << pwd << std::endl
             << "# hostname = " << hostname << std::endl
             << "# date = " << date // comes with a newline
             << "W = PNWaveform(" << Approximant << ", " << delta << ", " << VectorStringForm(chi1_i) << ", " << VectorStringForm(chi2_i)
             << ", " << Omega_orb_i << ", " << Omega_orb_0 << ", " << R_frame_i << ", " << MinStepsPerOrbit
-            << ", " << PNWaveformModeOrder << ", " << PNOrbitalEvolutionOrder << ");" << std::endl;
+            << ", " << PNWaveformModeOrder << ", " << PNOrbitalEvolutionOrder << ", " << ellMax << ");" << std::endl;
   }
 
-  vector<double> v;
-
   PostNewtonian::EvolvePN_Q(Approximant, PNOrbitalEvolutionOrder, v_0, v_i, m1, m2, chi1_i, chi2_i, R_frame_i,
-                            t, v, mchi1, mchi2, frame, mPhi_orb, mL,
+                            t, mv, mchi1, mchi2, frame, mPhi_orb, mL,
                             MinStepsPerOrbit);
 
-  mOmega_orb = GWFrames::pow(v,3)*PostNewtonian::ellHat(frame);
+  mOmega_orb = GWFrames::pow(mv,3)*PostNewtonian::ellHat(frame);
   mOmega_prec = Quaternions::vec(Quaternions::FrameAngularVelocity(frame, t)) - mOmega_orb;
 
+  SetModes(ellMax);
+
+} // end PN constructor
+
+/// Constructor of PN waveform from a parameter object
+GWFrames::PNWaveform::PNWaveform(const GWFrames::PNWaveformParameters& P) :
+  Waveform(), mchi1(0), mchi2(0), mOmega_orb(0), mOmega_prec(0), mL(0), mPhi_orb(0),
+  mv(0), mdelta(0.0), mPNWaveformModeOrder(0.0)
+{
+  PNWaveform W(P.Approximant, P.delta, P.chi1_i, P.chi2_i, P.Omega_orb_i, P.Omega_orb_0, P.R_frame_i,
+               P.MinStepsPerOrbit, P.PNWaveformModeOrder, P.PNOrbitalEvolutionOrder, P.ellMax);
+  this->swap(W);
+}
+
+/// Efficiently swap data between two PNWaveform objects
+void GWFrames::PNWaveform::swap(GWFrames::PNWaveform& b) {
+  this->Waveform::swap(b);
+  mchi1.swap(b.mchi1);
+  mchi2.swap(b.mchi2);
+  mOmega_orb.swap(b.mOmega_orb);
+  mOmega_prec.swap(b.mOmega_prec);
+  mL.swap(b.mL);
+  mPhi_orb.swap(b.mPhi_orb);
+  mv.swap(b.mv);
+  std::swap(mdelta, b.mdelta);
+  std::swap(mPNWaveformModeOrder, b.mPNWaveformModeOrder);
+  return;
+}
+
+/// Evaluate the waveform modes from the stored orbital evolution
+void GWFrames::PNWaveform::SetModes(const int ellMax) {
+  if(ellMax<2) {
+    lm.clear();
+    data = MatrixC();
+    return;
+  }
+  if(ellMax>PNWaveforms_ellMax) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": ellMax=" << ellMax
+         << " is larger than the largest ell available from PN, " << PNWaveforms_ellMax << "." << endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  const double m1 = (1.0+mdelta)/2.0;
+  const double m2 = (1.0-mdelta)/2.0;
+
   // Set up the (ell,m) data
   // We need (2*ell+1) coefficients for each value of ell from 2 up to
   // ellMax_PNWaveforms.  That's a total of
@@ -145,10 +222,11 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
   // done by taking the element of the array with index
   //   >>> summation(2*ell+1, (ell, 2, ell-1)) + ell + m
   //   ell**2 + ell + m - 4
-  lm.resize(PNWaveforms_ellMax*(PNWaveforms_ellMax+2)-3, vector<int>(2,0));
+  const unsigned int NModes = ellMax*(ellMax+2)-3;
+  lm.resize(NModes, vector<int>(2,0));
   {
     unsigned int i=0;
-    for(int ell=2; ell<=PNWaveforms_ellMax; ++ell) {
+    for(int ell=2; ell<=ellMax; ++ell) {
       for(int m=-ell; m<=ell; ++m) {
         lm[i][0] = ell;
         lm[i][1] = m;
@@ -156,6 +234,7 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
       }
     }
   }
+  IndexModes();
 
   // Evaluate the waveform data itself, noting that we always use the
   // frame in standard position (BHs on the x axis, with angular
@@ -167,12 +246,41 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
   // vectors are given in the inertial frame, but are needed in the
   // co-orbital frame.  Thus, we rotate with the inverse (conjugate)
   // rotor in the following.
-  data = MatrixC(PostNewtonian::WaveformModes(m1, m2, v,
-                                              Quaternions::vec(Quaternions::conjugate(frame)*Quaternions::QuaternionArray(mchi1)*frame),
-                                              Quaternions::vec(Quaternions::conjugate(frame)*Quaternions::QuaternionArray(mchi2)*frame),
-                                              PNWaveformModeOrder));
+  //
+  // The PN library always returns every mode up to
+  // PNWaveforms_ellMax, ordered by ell, so the modes with larger ell
+  // are simply dropped.
+  std::vector<std::vector<std::complex<double> > > Modes =
+    PostNewtonian::WaveformModes(m1, m2, mv,
+                                 Quaternions::vec(Quaternions::conjugate(frame)*Quaternions::QuaternionArray(mchi1)*frame),
+                                 Quaternions::vec(Quaternions::conjugate(frame)*Quaternions::QuaternionArray(mchi2)*frame),
+                                 mPNWaveformModeOrder);
+  Modes.resize(NModes);
+  data = MatrixC(Modes);
+  return;
+}
 
-} // end PN constructor
+/// (Re)compute the waveform modes up to the given ell
+GWFrames::PNWaveform& GWFrames::PNWaveform::ComputeModes(const int ellMax) {
+  ///
+  /// \param ellMax Largest ell mode to include [default: PNWaveforms_ellMax]
+  ///
+  /// The orbital evolution is stored by the constructor, so the mode
+  /// data can be evaluated (or re-evaluated with a different
+  /// `ellMax`) at any time, as long as the Waveform is still in the
+  /// coorbital frame in which it was constructed.  A PNWaveform
+  /// constructed with `ellMax=0` has no modes, which is useful when
+  /// only the orbital evolution is needed, or when the modes will be
+  /// computed later for only a few values of ell.
+  if(FrameType()!=GWFrames::Coorbital || mv.size()!=NTimes()) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": PNWaveform modes can only be computed in the original "
+         << GWFrames::WaveformFrameNames[GWFrames::Coorbital] << " frame, not " << FrameTypeString() << "." << endl;
+    throw(GWFrames_WrongFrameType);
+  }
+  history << "this->ComputeModes(" << ellMax << ");" << std::endl;
+  SetModes(ellMax);
+  return *this;
+}
 
 
 /// Total angular velocity of PN binary at an instant of time
@@ -233,3 +341,144 @@ std::vector<double> GWFrames::PNWaveform::LMag() const {
   }
   return Mag;
 }
+
+
+/// Default values for PNWaveform parameters
+GWFrames::PNWaveformParameters::PNWaveformParameters()
+  : Approximant("TaylorT1"), delta(0.0), chi1_i(3, 0.0), chi2_i(3, 0.0), Omega_orb_i(0.0), Omega_orb_0(-1.0),
+    R_frame_i(1,0,0,0), MinStepsPerOrbit(32), PNWaveformModeOrder(3.5), PNOrbitalEvolutionOrder(4.0),
+    ellMax(PNWaveforms_ellMax)
+{ }
+
+/// Construct many PNWaveforms, concurrently
+std::vector<GWFrames::PNWaveform> GWFrames::ConstructPNWaveforms(const std::vector<GWFrames::PNWaveformParameters>& Parameters) {
+  ///
+  /// \param Parameters Arguments for each PNWaveform
+  ///
+  /// The waveforms are independent, so they are integrated (and
+  /// their modes evaluated up to each `ellMax`) in parallel, one per
+  /// thread.  If any one fails, the others are still completed, and
+  /// then the error code of a failed one is thrown.
+  const int N = Parameters.size();
+  vector<PNWaveform> PNs(N);
+  int ErrorCode = 0;
+  #pragma omp parallel for schedule(dynamic,1)
+  for(int i=0; i<N; ++i) {
+    try {
+      PNWaveform W(Parameters[i]);
+      PNs[i].swap(W);
+    } catch(int e) {
+      #pragma omp critical(GWFrames_ConstructPNWaveformsError)
+      {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Construction of PNWaveform " << i << " failed with error " << e << "." << endl;
+        ErrorCode = e;
+      }
+    } catch(...) {
+      #pragma omp critical(GWFrames_ConstructPNWaveformsError)
+      {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Construction of PNWaveform " << i << " failed with an unknown exception." << endl;
+        ErrorCode = GWFrames_UnknownException;
+      }
+    }
+  }
+  if(ErrorCode) { throw(ErrorCode); }
+  return PNs;
+}
+
+/// Default values for hybridization parameters
+GWFrames::PNHybridizationParameters::PNHybridizationParameters()
+  : PNWaveformParameters(), t_i(0.0), t1(0.0), t2(0.0), InitialEvaluations(0), ShiftMergerToZero(false),
+    HybridFileName("")
+{ }
+
+/// Hybridize many NR waveforms with PN, concurrently
+std::vector<GWFrames::Waveform> GWFrames::HybridizeWithPN(const std::vector<GWFrames::Waveform>& NR,
+                                                          const std::vector<GWFrames::PNHybridizationParameters>& Parameters) {
+  ///
+  /// \param NR Numerical-relativity waveforms
+  /// \param Parameters PN and hybridization parameters for each NR waveform
+  ///
+  /// For each NR waveform, this constructs the PN waveform described
+  /// by the corresponding parameters, shifts it to start at `t_i`,
+  /// transforms both to their corotating frames, aligns them over
+  /// `(t1, t2)` with `AlignWaveforms`, hybridizes them with
+  /// `Waveform::Hybridize`, and transforms the hybrid to the inertial
+  /// frame.
+  ///
+  /// Code/Scripts/HybridizeOneWaveform.py also shifts the NR time so
+  /// that the merger (the peak of the norm) is at t=0.  This is only
+  /// done here if `ShiftMergerToZero` is set, in which case `t_i`,
+  /// `t1`, and `t2` are shifted along with the NR time, so they are
+  /// still given in the original NR time, and the hybrid has the
+  /// merger at t=0.  Unlike the script, this never writes NRAR-style
+  /// files.
+  ///
+  /// The systems are independent, so they are processed concurrently,
+  /// one per thread.  The input waveforms are only read (each worker
+  /// copies the one it is working on), and the PN waveform and other
+  /// intermediates exist only while a system is being processed.  If
+  /// `HybridFileName` is set for a system, its hybrid is written to
+  /// that file with `OutputBinary`, and an empty Waveform is returned
+  /// in its place, so that only a few hybrids need to be held in
+  /// memory at once.
+  ///
+  /// If any system fails, the others are still completed, and then
+  /// the error code of a failed system is thrown.
+
+  if(NR.size() != Parameters.size()) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": NR.size()=" << NR.size()
+         << " != Parameters.size()=" << Parameters.size() << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  const int N = NR.size();
+  vector<Waveform> Hybrids(N);
+
+  // Make sure the singletons used by the rotations and SWSHs are
+  // constructed before any threads need them
+  { SphericalFunctions::SWSH Y(0, Quaternion(1.0, 0.0, 0.0, 0.0)); }
+  { SphericalFunctions::WignerDMatrix D(Quaternion(1.0, 0.0, 0.0, 0.0)); }
+
+  int ErrorCode = 0;
+  #pragma omp parallel for schedule(dynamic,1)
+  for(int i=0; i<N; ++i) {
+    try {
+      const PNHybridizationParameters& P = Parameters[i];
+      Waveform W_NR(NR[i]); // AlignWaveforms transforms this to its corotating frame
+      PNWaveform W_PN(P);
+      double t0 = 0.0;
+      {
+        using namespace GWFrames; // To add double to vector<double> below
+        if(P.ShiftMergerToZero) {
+          t0 = -W_NR.MaxNormTime();
+          W_NR.SetTime(W_NR.T()+t0);
+        }
+        W_PN.SetTime(W_PN.T()+(P.t_i+t0));
+      }
+      W_PN.TransformToCorotatingFrame();
+      AlignWaveforms(W_NR, W_PN, P.t1+t0, P.t2+t0, P.InitialEvaluations);
+      Waveform W_hyb = W_PN.Hybridize(W_NR, P.t1+t0, P.t2+t0);
+      W_hyb.TransformToInertialFrame();
+      if(P.HybridFileName.size()>0) {
+        W_hyb.OutputBinary(P.HybridFileName);
+      } else {
+        Hybrids[i].swap(W_hyb);
+      }
+    } catch(int e) {
+      #pragma omp critical(GWFrames_HybridizeWithPNError)
+      {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Hybridization of system " << i << " failed with error " << e << "." << endl;
+        ErrorCode = e;
+      }
+    } catch(...) {
+      #pragma omp critical(GWFrames_HybridizeWithPNError)
+      {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Hybridization of system " << i << " failed with an unknown exception." << endl;
+        ErrorCode = GWFrames_UnknownException;
+      }
+    }
+  }
+  if(ErrorCode) { throw(ErrorCode); }
+
+  return Hybrids;
+}
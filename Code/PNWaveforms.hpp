@@ -10,6 +10,24 @@
 
 namespace GWFrames {
 
+  /// Arguments for constructing a PNWaveform; see `ConstructPNWaveforms`
+  class PNWaveformParameters {
+  public:
+    std::string Approximant;
+    double delta;
+    std::vector<double> chi1_i;
+    std::vector<double> chi2_i;
+    double Omega_orb_i;
+    double Omega_orb_0;
+    Quaternions::Quaternion R_frame_i;
+    unsigned int MinStepsPerOrbit;
+    double PNWaveformModeOrder;
+    double PNOrbitalEvolutionOrder;
+    int ellMax; // Largest ell for which modes are computed; less than 2 means none
+  public:
+    PNWaveformParameters();
+  }; // class PNWaveformParameters
+
   /// Object for calculating a post-Newtonian Waveform with (optional) precession
   class PNWaveform : public Waveform {
 
@@ -18,8 +36,17 @@ namespace GWFrames {
     PNWaveform(const PNWaveform& W);
     PNWaveform(const std::string& Approximant, const double delta, const std::vector<double>& chi1_i, const std::vector<double>& chi2_i,
                const double Omega_orb_i, double Omega_orb_0=-1.0, const Quaternions::Quaternion& R_frame_i=Quaternions::Quaternion(1,0,0,0),
-               const unsigned int MinStepsPerOrbit=32, const double PNWaveformModeOrder=3.5, const double PNOrbitalEvolutionOrder=4.0);
+               const unsigned int MinStepsPerOrbit=32, const double PNWaveformModeOrder=3.5, const double PNOrbitalEvolutionOrder=4.0,
+               const int ellMax=PNWaveforms_ellMax);
+    PNWaveform(const PNWaveformParameters& Parameters);
+    #if __cplusplus >= 201103L
+    PNWaveform(PNWaveform&& W) noexcept;
+    PNWaveform& operator=(const PNWaveform& W) = default;
+    PNWaveform& operator=(PNWaveform&& W) noexcept;
+    #endif
     ~PNWaveform() { }
+    using Waveform::swap;
+    void swap(PNWaveform& b);
 
   private:  // Member data
     // std::stringstream history;           // inherited from Waveform
@@ -33,6 +60,15 @@ namespace GWFrames {
     std::vector<std::vector<double> > mOmega_prec;
     std::vector<std::vector<double> > mL;
     std::vector<double> mPhi_orb;
+    std::vector<double> mv; // PN parameter v at each time, kept for `ComputeModes`
+    double mdelta;
+    double mPNWaveformModeOrder;
+
+  private:
+    void SetModes(const int ellMax);
+
+  public:  // Mode evaluation
+    PNWaveform& ComputeModes(const int ellMax=PNWaveforms_ellMax);
 
   public:  // Data access functions
     // Vector a specific time index
@@ -81,6 +117,27 @@ namespace GWFrames {
 
   }; // class PNWaveform
 
+  std::vector<PNWaveform> ConstructPNWaveforms(const std::vector<PNWaveformParameters>& Parameters);
+
+  /// Description of one NR system to be hybridized with PN by `HybridizeWithPN`
+  class PNHybridizationParameters : public PNWaveformParameters {
+  public:
+    // NR time at which the PN initial data are given
+    double t_i;
+    // Arguments for AlignWaveforms and Hybridize
+    double t1;
+    double t2;
+    unsigned int InitialEvaluations;
+    // If true, shift the NR merger to t=0 first; t_i, t1, and t2 are still given in the original NR time
+    bool ShiftMergerToZero;
+    // If nonempty, the hybrid is written here (with OutputBinary) instead of being returned
+    std::string HybridFileName;
+  public:
+    PNHybridizationParameters();
+  }; // class PNHybridizationParameters
+
+  std::vector<Waveform> HybridizeWithPN(const std::vector<Waveform>& NR, const std::vector<PNHybridizationParameters>& Parameters);
+
 } // namespace GWFrames
 
 #endif // PNWAVEFORMS_HPP
@@ -21,7 +21,9 @@
     #endif
   #endif
   namespace GWFrames {
-    static sigjmp_buf FloatingPointExceptionJumpBuffer;
+    // Each thread needs its own jump buffer, since wrappers that
+    // release the GIL may run simultaneously in several threads
+    static __thread sigjmp_buf FloatingPointExceptionJumpBuffer;
     void FloatingPointExceptionHandler(int sig) {
       siglongjmp(FloatingPointExceptionJumpBuffer, sig);
     }
@@ -52,6 +54,45 @@
     };
   }
 
+  // Release Python's global interpreter lock for the lifetime of
+  // this object.  This is used in wrappers (below and in the other
+  // .i files) for long-running functions that do not touch Python
+  // objects, so that other Python threads can run meanwhile.  The
+  // destructor reacquires the lock, before any Python error is set.
+  //
+  // The C++ code may be called from many threads at once, as long as
+  // no object is modified in one thread while being used in another.
+  // The state shared between calls is safe to use that way:
+  //   * The SphericalFunctions singletons (e.g., the ladder-operator
+  //     factors) are built when the module is loaded, and are only
+  //     read afterwards.
+  //   * All FFTW planning -- for the FFTs in fft.cpp, the cached
+  //     spinsfast workspaces in SphericalTransforms.cpp, and the
+  //     direct calls to spinsfast, which plan internally -- happens
+  //     inside the `GWFrames_FFTWPlanner` critical section;
+  //     executing a plan is thread safe.
+  //   * The caches of spinsfast workspaces, spectral-product tables,
+  //     and noise curves each have their own critical section.
+  //   * The headers of new Waveform histories use the reentrant
+  //     `localtime_r` and `asctime_r`.
+  //   * Waveforms read with 'MappedBinary' share the read-only
+  //     mapping among their copies, with an atomic reference count,
+  //     and functions modifying the data copy them first.
+  // The one global setting, `Waveform::SetRecordHistoryByDefault`,
+  // should not be changed while other threads are running.  The
+  // critical sections are OpenMP locks, which also exclude threads
+  // not created by OpenMP (such as Python's), but only if the code is
+  // compiled with OpenMP, as setup.py does when it can.
+  namespace GWFrames {
+    class ReleaseGIL {
+    private:
+      PyThreadState* State;
+    public:
+      ReleaseGIL() : State(PyEval_SaveThread()) { }
+      ~ReleaseGIL() { PyEval_RestoreThread(State); }
+    };
+  }
+
   // The following allows us to elegantly fail in python from
   // exceptions raised by the c++ code.
   const char* const GWFramesErrors[] = {
@@ -86,7 +127,7 @@
     PyExc_SystemError, // Failed system call
     PyExc_IOError, // Bad file name
     PyExc_RuntimeError, // GSL failed
-    PyExc_RuntimeError, // [empty]
+    PyExc_RuntimeError, // Unknown exception
     PyExc_RuntimeError, // [empty]
     PyExc_RuntimeError, // [empty]
     PyExc_RuntimeError, // [empty]
@@ -133,3 +174,30 @@
     return 0;
   }
 }
+
+// Long-running functions that do not touch Python objects can be
+// wrapped with this instead, to release the GIL while they run, e.g.
+//   GWFrames_ReleaseGIL(GWFrames::HybridizeWithPN)
+// before the function's declaration is parsed.
+%define GWFrames_ReleaseGIL(Function)
+%exception Function {
+  if (!sigsetjmp(GWFrames::FloatingPointExceptionJumpBuffer, 1)) {
+    try {
+      GWFrames::ReleaseGIL Unlocked;
+      $action;
+    } catch(int i) {
+      std::stringstream s;
+      if(i>-1 && i<GWFramesNumberOfErrors) { s << "$fulldecl: " << GWFramesErrors[i]; }
+      else  { s << "$fulldecl: Unknown exception number {" << i << "}"; }
+      PyErr_SetString(GWFramesExceptions[i], s.str().c_str());
+      return 0;
+    } catch(...) {
+      PyErr_SetString(PyExc_RuntimeError, "$fulldecl: Unknown exception; default handler");
+      return 0;
+    }
+  } else {
+    PyErr_SetString(PyExc_RuntimeError, "$fulldecl: Caught a floating-point exception in the c++ code.");
+    return 0;
+  }
+}
+%enddef
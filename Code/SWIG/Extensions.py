@@ -69,10 +69,48 @@ class Waveform(_Waveform):
     """
     __metaclass__ = _MetaWaveform
 
+    def SetData(self, *args) :
+        """Set the mode data
+
+        The arguments may be (i_Mode, i_Time, value), a nested list of
+        complex values for each mode, or a (NModes, NTimes) array.  An
+        array is copied in one pass with `SetDataFromArray`.  This
+        object itself is returned, so that no copy of the data is made.
+
+        """
+        if len(args)==1 and isinstance(args[0], numpy.ndarray) :
+            self.SetDataFromArray(numpy.ascontiguousarray(args[0], dtype=numpy.complex128))
+        else :
+            _Waveform.SetData(self, *args)
+        return self
+
+    def TView(self) :
+        """Return a read-only numpy array sharing memory with the time data
+
+        Unlike `T()`, nothing is copied.  The array keeps this Waveform
+        alive, but becomes invalid if the time data are replaced (e.g.,
+        by `SetTime` or `Interpolate`), so take a new view after that.
+
+        """
+        return _WaveformTView(self)
+
+    def DataView(self) :
+        """Return a read-only (NModes, NTimes) complex numpy array sharing memory with the mode data
+
+        Unlike `Data()`, nothing is copied.  The array keeps this
+        Waveform alive, but becomes invalid if the mode data are
+        replaced or resized (e.g., by `SetData` or any transformation
+        of the data), so take a new view after that.  To change the
+        data, pass a complex array to `SetData`, which copies it in
+        one pass.
+
+        """
+        return _WaveformDataView(self)
+
 _WaveformReturners = ['CopyWithoutData', 'SliceOfTimeIndices', 'SliceOfTimeIndicesWithEll2', 'SliceOfTimeIndicesWithoutModes', 'SliceOfTimes', 'SliceOfTimesWithEll2',
                       'SliceOfTimesWithoutModes', 'Interpolate', 'InterpolateInPlace', 'DropTimesOutside', 'DropEllModes', 'KeepOnlyEllModes', 'KeepOnlyEll2',
                       'SetSpinWeight', 'SetBoostWeight', 'AppendHistory', 'SetHistory', 'SetT', 'SetTime', 'SetFrame', 'SetFrameType', 'SetDataType', 'SetRIsScaledOut',
-                      'SetMIsScaledOut', 'SetLM', 'SetData', 'SetData', 'ResizeData', 'Differentiate', 'RotatePhysicalSystem',
+                      'SetMIsScaledOut', 'SetLM', 'ResizeData', 'Differentiate', 'RotatePhysicalSystem',
                       'RotatePhysicalSystem', 'RotateDecompositionBasis', 'RotateDecompositionBasis', 'TransformToCoprecessingFrame', 'TransformToAngularVelocityFrame',
                       'TransformToCorotatingFrame', 'TransformToInertialFrame', 'AlignDecompositionFrameToModes', 'Compare', 'Hybridize', 'Translate']
 
@@ -118,8 +156,12 @@ class PNWaveform(_PNWaveform):
       MinStepsPerOrbit: Minimum number of time steps at which to evaluate (default: 32)
       PNWaveformModeOrder: PN order at which to compute waveform modes (default: 3.5)
       PNOrbitalEvolutionOrder: PN order at which to compute orbital evolution (default: 4.0)
+      ellMax: Largest ell for which modes are computed; less than 2 skips the modes,
+              which can be computed later with `ComputeModes` (default: 8)
 
-    [There is also a copy constructor.]
+    [There is also a copy constructor, and a constructor from a
+    `PNWaveformParameters` object.  Many PNWaveforms can be
+    constructed in parallel with `ConstructPNWaveforms`.]
 
     The PN system is defined with respect to an inertial basis
     (x,y,z).  The input spin vectors must be defined with respect to
@@ -148,6 +190,11 @@ class PNWaveform(_PNWaveform):
     """
     __metaclass__ = _MetaPNWaveform
 
+# The zero-copy views and bulk SetData work for PNWaveforms too
+PNWaveform.SetData = Waveform.__dict__['SetData']
+PNWaveform.TView = Waveform.__dict__['TView']
+PNWaveform.DataView = Waveform.__dict__['DataView']
+
 
 
 # Now, we just make sure that any Waveform or PNWaveform member that
@@ -29,6 +29,7 @@
   #include "../Waveforms.hpp"
   #include "../PNWaveforms.hpp"
   #include "../WaveformsAtAPointFT.hpp"
+  #include "../Instrumentation.hpp"
 
 %}
 
@@ -98,4 +99,5 @@
 %include "Scri.i"
 %include "Waveforms.i"
 %include "PNWaveforms.i"
+%include "Instrumentation.i"
 %include "Extensions.py"
@@ -0,0 +1,37 @@
+/////////////////////////////////////////
+//// Import the instrumentation code ////
+/////////////////////////////////////////
+//// These are only used by the macros in the C++ code
+%ignore GWFrames::InstrumentationStat;
+%ignore GWFrames::InstrumentationIsEnabled;
+%ignore GWFrames::InstrumentationIsTracing;
+%ignore GWFrames::InstrumentationRegister;
+%ignore GWFrames::InstrumentationMicroseconds;
+%ignore GWFrames::InstrumentationRecordEvent;
+%ignore GWFrames::InstrumentationTimer;
+%ignore GWFrames::InstrumentationCount;
+//// Python gets the dictionary below instead
+%ignore GWFrames::InstrumentationSnapshot;
+//// Parse the header file to generate wrappers
+%include "../Instrumentation.hpp"
+//// Return the totals as {name: {'count': count, 'seconds': seconds}}
+%inline %{
+  PyObject* InstrumentationStats() {
+    std::vector<std::string> Names;
+    std::vector<long> Counts;
+    std::vector<double> Seconds;
+    GWFrames::InstrumentationSnapshot(Names, Counts, Seconds);
+    PyObject* Stats = PyDict_New();
+    if(!Stats) { return NULL; }
+    for(unsigned int i=0; i<Names.size(); ++i) {
+      PyObject* Stat = Py_BuildValue("{s:l,s:d}", "count", Counts[i], "seconds", Seconds[i]);
+      if(!Stat || PyDict_SetItemString(Stats, Names[i].c_str(), Stat)<0) {
+        Py_XDECREF(Stat);
+        Py_DECREF(Stats);
+        return NULL;
+      }
+      Py_DECREF(Stat);
+    }
+    return Stats;
+  }
+%}
@@ -27,5 +27,14 @@
 %feature("pythonappend") GWFrames::PNWaveform::OmegaHat_tot() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 %feature("pythonappend") GWFrames::PNWaveform::LHat() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 #endif
+//// Run batch functions without holding the GIL
+GWFrames_ReleaseGIL(GWFrames::ConstructPNWaveforms)
+GWFrames_ReleaseGIL(GWFrames::HybridizeWithPN)
 //// Parse the header file to generate wrappers
 %include "../PNWaveforms.hpp"
+//// Make sure vectors of PN objects are understood
+namespace std {
+  %template(_vectorPNWaveform) vector<GWFrames::PNWaveform>;
+  %template(_vectorPNWaveformParameters) vector<GWFrames::PNWaveformParameters>;
+  %template(_vectorPNHybridizationParameters) vector<GWFrames::PNHybridizationParameters>;
+};
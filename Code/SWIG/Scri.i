@@ -15,11 +15,17 @@
 #endif // SWIG_BUILTIN
 typedef std::vector<double> ThreeVector;
 typedef std::vector<double> FourVector;
+GWFrames_ReleaseGIL(GWFrames::Scri::BMSTransformation)
+GWFrames_ReleaseGIL(GWFrames::SliceModes::BMSTransformationOnSlice)
 %include "../Scri.hpp"
 namespace GWFrames {
   %template(SliceOfScriGrid) SliceOfScri<DataGrid>;
   %template(SliceOfScriModes) SliceOfScri<Modes>;
 }
+namespace std {
+  %template(_vectorModes) vector<GWFrames::Modes>;
+  %template(_vectorMoreschiConvergence) vector<GWFrames::MoreschiConvergence>;
+};
 %extend GWFrames::DataGrid { // None of the above seem to work, so...
   const std::complex<double> __getitem__(const unsigned int i) const { return $self->operator[](i); }
   void __setitem__(const unsigned int i, const std::complex<double>& a) { $self->operator[](i)=a; }
@@ -3,12 +3,14 @@
 //////////////////////////
 %ignore GWFrames::Matrix::operator=;
 %ignore GWFrames::Matrix::operator[];
+%ignore GWFrames::Array2D::operator[];
 %ignore GWFrames::operator+;
 %ignore GWFrames::operator-;
 %ignore GWFrames::operator*;
 %ignore GWFrames::operator/;
 %ignore GWFrames::abs;
 %ignore GWFrames::pow;
+%ignore GWFrames::SymmetricEigensystem3;
 %include "../Utilities.hpp"
 namespace std {
   %template(_vectorM) vector<GWFrames::Matrix>;
@@ -23,3 +25,11 @@ namespace std {
                        + ['        '+repr([self(r,c) for c in range(self.ncols()) for r in [self.nrows()-1]])+'])'] )
   };
  };
+%extend GWFrames::Array2D {
+  // Convert to a numpy array of the right shape
+  %pythoncode{
+    def ndarray(self):
+        import numpy
+        return numpy.array(self.Flat()).reshape((self.nrows(), self.ncols()))
+  };
+ };
@@ -12,6 +12,7 @@
 //// Ignore things that don't translate well...
 %ignore operator<<;
 %ignore GWFrames::Waveform::operator=;
+%ignore GWFrames::WaveformView::operator();
 %ignore GWFrames::Waveforms::operator[];
 %rename(__getitem__) GWFrames::Waveforms::operator[] const;
 
@@ -35,10 +36,48 @@
 %feature("pythonappend") GWFrames::Waveform::CorotatingFrame() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 %feature("pythonappend") GWFrames::Waveform::PNEquivalentOrbitalAV() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 %feature("pythonappend") GWFrames::Waveform::PNEquivalentPrecessionalAV() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::WaveformView::T() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::WaveformView::Norm() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::WaveformView::LdtVector() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::WaveformPointInterpolant::Evaluate const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+//// Views only point to the parent's data, so keep the parent alive as long as the view
+%feature("pythonappend") GWFrames::Waveform::View() const %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimeIndices %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimeIndicesWithEll2 %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimeIndicesWithoutModes %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimes %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimesWithEll2 %{ val._parent = self %}
+%feature("pythonappend") GWFrames::Waveform::ViewOfTimesWithoutModes %{ val._parent = self %}
 #endif
 
 %apply double& OUTPUT { double& deltat };
 
+//// Let the bulk `SetData` take a complex numpy array directly.  It
+//// gets its own name so that SWIG's overload dispatch cannot send
+//// arrays to the nested-vector version; `Waveform.SetData` in
+//// Extensions.py chooses between them.
+%rename(SetDataFromArray) GWFrames::Waveform::SetData(const std::complex<double>* Data, const int NModes, const int NTimes);
+%numpy_typemaps(std::complex<double>, NPY_CDOUBLE, int)
+%apply (std::complex<double>* IN_ARRAY2, int DIM1, int DIM2) { (const std::complex<double>* Data, const int NModes, const int NTimes) };
+
+//// Release the GIL during long-running calls, so other Python threads can run
+GWFrames_ReleaseGIL(GWFrames::Waveform::Interpolate)
+GWFrames_ReleaseGIL(GWFrames::Waveform::InterpolateInPlace)
+GWFrames_ReleaseGIL(GWFrames::WaveformView::Interpolate)
+GWFrames_ReleaseGIL(GWFrames::WaveformPointInterpolant::Evaluate)
+GWFrames_ReleaseGIL(GWFrames::Waveform::TransformToCoprecessingFrame)
+GWFrames_ReleaseGIL(GWFrames::Waveform::TransformToAngularVelocityFrame)
+GWFrames_ReleaseGIL(GWFrames::Waveform::TransformToCorotatingFrame)
+GWFrames_ReleaseGIL(GWFrames::Waveform::TransformToInertialFrame)
+GWFrames_ReleaseGIL(GWFrames::Waveform::AlignDecompositionFrameToModes)
+GWFrames_ReleaseGIL(GWFrames::Waveform::Compare)
+GWFrames_ReleaseGIL(GWFrames::Waveform::Hybridize)
+GWFrames_ReleaseGIL(GWFrames::Waveform::Output)
+GWFrames_ReleaseGIL(GWFrames::Waveform::OutputBinary)
+GWFrames_ReleaseGIL(GWFrames::AlignWaveforms)
+GWFrames_ReleaseGIL(GWFrames::Extrapolate)
+GWFrames_ReleaseGIL(GWFrames::OutputWaveforms)
+
 //// Parse the header file to generate wrappers
 %include "../Waveforms.hpp"
 
@@ -47,6 +86,51 @@ namespace std {
   %template(_vectorW) vector<GWFrames::Waveform>;
 };
 
+//// Read-only numpy arrays sharing memory with a Waveform's time and
+//// mode data.  The array holds a reference to the Waveform, so the
+//// memory remains valid as long as the array exists -- unless the
+//// Waveform's data are replaced or resized in the meantime (e.g., by
+//// `SetTime`, `SetData`, or `Interpolate`), in which case a new view
+//// must be taken.  These are used by `Waveform.TView` and
+//// `Waveform.DataView` in Extensions.py.
+%{
+  PyObject* GWFrames_ArrayView(PyObject* Owner, const int nd, npy_intp* dims, const int typenum, const void* data) {
+    if(!data) { return PyArray_SimpleNew(nd, dims, typenum); }
+    PyObject* array = PyArray_SimpleNewFromData(nd, dims, typenum, const_cast<void*>(data));
+    if(!array) { return NULL; }
+    PyArray_CLEARFLAGS((PyArrayObject*)array, NPY_ARRAY_WRITEABLE);
+    Py_INCREF(Owner);
+    if(PyArray_SetBaseObject((PyArrayObject*)array, Owner) < 0) {
+      Py_DECREF(array);
+      return NULL;
+    }
+    return array;
+  }
+  const GWFrames::Waveform* GWFrames_WaveformFromPyObject(PyObject* W) {
+    void* ptr = 0;
+    if(!SWIG_IsOK(SWIG_ConvertPtr(W, &ptr, SWIGTYPE_p_GWFrames__Waveform, 0)) || !ptr) {
+      PyErr_SetString(PyExc_TypeError, "Expected a GWFrames.Waveform object");
+      return NULL;
+    }
+    return reinterpret_cast<const GWFrames::Waveform*>(ptr);
+  }
+%}
+%inline %{
+  PyObject* _WaveformTView(PyObject* W) {
+    const GWFrames::Waveform* w = GWFrames_WaveformFromPyObject(W);
+    if(!w) { return NULL; }
+    npy_intp dims[1] = { npy_intp(w->NTimes()) };
+    return GWFrames_ArrayView(W, 1, dims, NPY_DOUBLE, (w->NTimes()>0 ? &(w->T())[0] : NULL));
+  }
+  PyObject* _WaveformDataView(PyObject* W) {
+    const GWFrames::Waveform* w = GWFrames_WaveformFromPyObject(W);
+    if(!w) { return NULL; }
+    npy_intp dims[2] = { npy_intp(w->NModes()), npy_intp(w->NTimes()) };
+    // MatrixC stores all rows in one contiguous block, starting at row 0
+    return GWFrames_ArrayView(W, 2, dims, NPY_CDOUBLE, (w->NModes()>0 && w->NTimes()>0 ? (*w)(0) : NULL));
+  }
+%}
+
 //// Make any additions to the Waveform class here
 %extend GWFrames::Waveform {
   //// This function is called when printing the Waveform object
@@ -107,4 +191,12 @@ namespace std {
 %apply double *INOUT { double& timeOffset };
 %apply double *INOUT { double& phaseOffset };
 %apply double *INOUT { double& match };
+GWFrames_ReleaseGIL(GWFrames::WaveformAtAPointFT::WaveformAtAPointFT)
+GWFrames_ReleaseGIL(GWFrames::WaveformAtAPointFT::Match)
+GWFrames_ReleaseGIL(GWFrames::Matches)
 %include "../WaveformsAtAPointFT.hpp"
+
+//// Make sure vectors of WaveformAtAPointFT are understood
+namespace std {
+  %template(_vectorWaveformAtAPointFT) vector<GWFrames::WaveformAtAPointFT>;
+};
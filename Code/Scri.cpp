@@ -6,6 +6,7 @@
 // #include <omp.h>
 
 #include <algorithm>
+#include <map>
 
 
 // The following are for spinsfast
@@ -30,14 +31,13 @@ namespace GWFrames {
 };
 #endif // DOXYGEN
 
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_spline.h>
-
 #include "Utilities.hpp"
 #include "Quaternions.hpp"
 #include "SphericalFunctions/SWSHs.hpp"
 #include "Waveforms.hpp"
+#include "SphericalTransforms.hpp"
 #include "Errors.hpp"
+#include "Instrumentation.hpp"
 
 using Quaternions::Quaternion;
 using GWFrames::ThreeVector;
@@ -46,7 +46,12 @@ using GWFrames::DataGrid;
 using GWFrames::Modes;
 using GWFrames::SliceOfScri;
 using GWFrames::SliceModes;
+using GWFrames::SliceGrid;
 using GWFrames::Scri;
+using GWFrames::SuperMomenta;
+using GWFrames::MoreschiConvergence;
+using GWFrames::CubicSplineWeights;
+using GWFrames::SpinsfastWorkspaceLease;
 
 using std::string;
 using std::vector;
@@ -80,6 +85,37 @@ namespace {
     const double magv = std::sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
     return acosh(1.0/std::sqrt(1.0-magv*magv));
   }
+
+  /// Returns the (Bondi) four-momentum from the ell=0 and ell=1 modes of the supermomentum
+  FourVector FourMomentumFromSuperMomentum(const Modes& Psi) {
+    FourVector p(4);
+    p[0] = std::real(Psi[0])/sqrt4pi;
+    // The following are divided by 3 relative to what I would naively
+    // expect.  I don't understand why, but this is written into the
+    // definition of the vector l^a, so it must be incorporated each
+    // time that vector appears.
+    p[1] = std::real((Psi[1]-Psi[3]))/(sqrt3*sqrt8pi);
+    p[2] = -std::real(complexi*(Psi[1]+Psi[3]))/(sqrt3*sqrt8pi);
+    p[3] = std::real(Psi[2])/(sqrt3*sqrt4pi);
+    return p;
+  }
+
+  /// Returns the mass of a four-momentum
+  double MassOfFourMomentum(const FourVector& p) {
+    return std::sqrt(p[0]*p[0]-p[1]*p[1]-p[2]*p[2]-p[3]*p[3]);
+  }
+
+  /// Sets the ell<=1 modes of 1/K for the next step of the Moreschi algorithm
+  void MoreschiInverseConformalFactor(Modes& OneOverK, const Modes& Psi, const double M) {
+    /// The ell=1 modes carry the same factor of 3 as in
+    /// `FourMomentumFromSuperMomentum`, and their signs are reversed
+    /// so that the boost will be cancelled out by the next step,
+    /// rather than just reported.
+    OneOverK[0] = Psi[0]/M;
+    OneOverK[1] = -Psi[1]/(3*M);
+    OneOverK[2] = -Psi[2]/(3*M);
+    OneOverK[3] = -Psi[3]/(3*M);
+  }
 }
 #endif
 
@@ -152,12 +188,11 @@ DataGrid::DataGrid(const int Spin, const int N_theta, const int N_phi, const std
   }
 }
 
-DataGrid::DataGrid(Modes M, const int N_theta, const int N_phi)
+DataGrid::DataGrid(const Modes& M, const int N_theta, const int N_phi)
   : s(M.Spin()), n_theta(std::max(N_theta, 2*M.EllMax()+1)), n_phi(std::max(N_phi, 2*M.EllMax()+1)), data(n_phi*n_theta, zero)
 {
-  spinsfast_salm2map(reinterpret_cast<fftw_complex*>(&M[0]),
-                     reinterpret_cast<fftw_complex*>(&data[0]),
-                     M.Spin(), n_theta, n_phi, M.EllMax());
+  SpinsfastWorkspaceLease Workspace(M.EllMax(), n_theta, n_phi);
+  Workspace.salm2map(&M.data[0], &data[0], M.Spin());
 }
 
 DataGrid::DataGrid(const Modes& M, const GWFrames::ThreeVector& v, const int N_theta, const int N_phi)
@@ -316,6 +351,55 @@ DataGrid DataGrid::operator-(const DataGrid& A) const {
   return C;
 }
 
+#ifndef DOXYGEN
+namespace {
+  void CheckSameGridSize(const DataGrid& A, const DataGrid& B, const char* Operation) {
+    if(A.N_theta() != B.N_theta() || A.N_phi() != B.N_phi()) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+                << "\nError: (A.n_theta=" << A.N_theta() << ", A.n_phi=" << A.N_phi()
+                << ") != (B.n_theta=" << B.N_theta() << ", B.n_phi=" << B.N_phi() << ")"
+                << "\n       Cannot " << Operation << " data of different sizes\n"
+                << std::endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+  }
+}
+#endif // DOXYGEN
+
+DataGrid& DataGrid::operator*=(const DataGrid& A) {
+  CheckSameGridSize(*this, A, "multiply");
+  for(unsigned int i=0; i<data.size(); ++i) {
+    data[i] *= A.data[i];
+  }
+  s += A.s;
+  return *this;
+}
+
+DataGrid& DataGrid::operator/=(const DataGrid& A) {
+  CheckSameGridSize(*this, A, "divide");
+  for(unsigned int i=0; i<data.size(); ++i) {
+    data[i] /= A.data[i];
+  }
+  s -= A.s;
+  return *this;
+}
+
+DataGrid& DataGrid::operator+=(const DataGrid& A) {
+  CheckSameGridSize(*this, A, "add");
+  for(unsigned int i=0; i<data.size(); ++i) {
+    data[i] += A.data[i];
+  }
+  return *this;
+}
+
+DataGrid& DataGrid::operator-=(const DataGrid& A) {
+  CheckSameGridSize(*this, A, "subtract");
+  for(unsigned int i=0; i<data.size(); ++i) {
+    data[i] -= A.data[i];
+  }
+  return *this;
+}
+
 DataGrid DataGrid::pow(const int p) const {
   DataGrid c(*this);
   const int N = c.N_theta()*c.N_phi();
@@ -446,12 +530,26 @@ Modes::Modes(const int spin, const std::vector<std::complex<double> >& Data)
   }
 }
 
-Modes::Modes(DataGrid D, const int L)
-  : s(D.Spin()), ellMax(std::max(std::min((D.N_theta()-1)/2, (D.N_phi()-1)/2), L)), data(N_lm(ellMax))
+Modes::Modes(const DataGrid& D, const int L)
+  : s(0), ellMax(0), data()
 {
-  spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&D[0]),
-                     reinterpret_cast<fftw_complex*>(&data[0]),
-                     s, D.N_theta(), D.N_phi(), ellMax);
+  SetFromGrid(D, L);
+}
+
+/// Replace the modes with the decomposition of the grid, reusing this object's storage
+Modes& Modes::SetFromGrid(const DataGrid& D, const int L) {
+  /// \param D Data on the equi-angular grid
+  /// \param L Smallest ellMax of the output [default: -1]
+  ///
+  /// This is the same as assigning `Modes(D, L)`, except that the
+  /// existing storage is reused, so that loops decomposing many grids
+  /// of the same size need not allocate.
+  s = D.Spin();
+  ellMax = std::max(std::min((D.N_theta()-1)/2, (D.N_phi()-1)/2), L);
+  data.resize(N_lm(ellMax));
+  SpinsfastWorkspaceLease Workspace(ellMax, D.N_theta(), D.N_phi());
+  Workspace.map2salm(&D.data[0], &data[0], s);
+  return *this;
 }
 
 GWFrames::Modes& GWFrames::Modes::operator=(const Modes& B) {
@@ -471,16 +569,60 @@ Modes Modes::bar() const {
   return B;
 }
 
+
+#ifndef DOXYGEN
+namespace {
+
+  // Products in which one factor has only a few modes (like the
+  // ell<=1 conformal factors, or a low-order supertranslation) are
+  // done directly in spectral space, rather than through grids of
+  // resolution 2*(L_1+L_2)+1.  This is used when the smaller ellMax
+  // is at most this value.
+  const int SpectralProductEllMax = 3;
+
+  // The product A*B for A with small ellMax, done in spectral space.
+  // The result has ellMax equal to the sum, just like the product
+  // through grids.
+  Modes SpectralProduct(const Modes& A, const Modes& B) {
+    const int ellMaxC = A.EllMax()+B.EllMax();
+    const GWFrames::SpectralProductTable& Table
+      = GWFrames::CachedSpectralProductTable(A.Spin(), A.EllMax(), B.Spin(), B.EllMax(), ellMaxC);
+    Modes C(N_lm(ellMaxC));
+    C.SetSpin(A.Spin()+B.Spin());
+    C.SetEllMax(ellMaxC);
+    const int N_A = N_lm(A.EllMax());
+    for(int i_A=0; i_A<N_A; ++i_A) {
+      const complex<double> a = A[i_A];
+      if(a==zero) { continue; }
+      for(int k=Table.Begin[i_A]; k<Table.Begin[i_A+1]; ++k) {
+        C[Table.IndexC[k]] += (Table.Coefficient[k]*a) * B[Table.IndexB[k]];
+      }
+    }
+    return C;
+  }
+
+}
+#endif // DOXYGEN
+
 Modes Modes::operator*(const Modes& M) const {
+  // When one factor is small, it's faster to work in spectral space
+  if(std::min(EllMax(), M.EllMax())<=SpectralProductEllMax
+     && int(size())==N_lm(EllMax()) && int(M.size())==N_lm(M.EllMax())) {
+    return (EllMax()<=M.EllMax() ? SpectralProduct(*this, M) : SpectralProduct(M, *this));
+  }
   const int L = EllMax() + M.EllMax(); // use sum to account for mode mixing
-  Modes A = Modes(DataGrid(*this,2*L+1,2*L+1) * DataGrid(M,2*L+1,2*L+1), std::max(EllMax(), M.EllMax()));
+  DataGrid Product(*this,2*L+1,2*L+1);
+  Product *= DataGrid(M,2*L+1,2*L+1);
+  Modes A = Modes(Product, std::max(EllMax(), M.EllMax()));
   A.s = s + M.s;
   return A;
 }
 
 Modes Modes::operator/(const Modes& M) const {
   const int L = EllMax() + M.EllMax();
-  Modes A = Modes(DataGrid(*this,2*L+1,2*L+1) / DataGrid(M,2*L+1,2*L+1), std::max(EllMax(), M.EllMax()));
+  DataGrid Quotient(*this,2*L+1,2*L+1);
+  Quotient /= DataGrid(M,2*L+1,2*L+1);
+  Modes A = Modes(Quotient, std::max(EllMax(), M.EllMax()));
   A.s = s - M.s;
   return A;
 }
@@ -748,25 +890,14 @@ int SliceModes::EllMax() const {
 
 /// Calculate the mass of the system from the four-momentum
 double SliceModes::Mass() const {
-  const FourVector p = FourMomentum();
-  return std::sqrt(p[0]*p[0]-p[1]*p[1]-p[2]*p[2]-p[3]*p[3]);
+  return MassOfFourMomentum(FourMomentum());
 }
 
 /// Calculate the four-momentum of the system from the supermomentum
 GWFrames::FourVector SliceModes::FourMomentum() const {
   /// The (Bondi) four-momentum is given by the ell=0 and ell=1 modes
   /// of the supermomentum.
-  const Modes Psi = SuperMomentum();
-  FourVector p(4);
-  p[0] = std::real(Psi[0])/sqrt4pi;
-  // The following are divided by 3 relative to what I would naively
-  // expect.  I don't understand why, but this is written into the
-  // definition of the vector l^a, so it must be incorporated each
-  // time that vector appears.
-  p[1] = std::real((Psi[1]-Psi[3]))/(sqrt3*sqrt8pi);
-  p[2] = -std::real(complexi*(Psi[1]+Psi[3]))/(sqrt3*sqrt8pi);
-  p[3] = std::real(Psi[2])/(sqrt3*sqrt4pi);
-  return p;
+  return FourMomentumFromSuperMomentum(SuperMomentum());
 }
 
 /// Find the Moreschi supermomentum
@@ -785,33 +916,62 @@ GWFrames::SliceGrid SliceModes::BMSTransformationOnSlice(const double u, const T
   /// point, and the change of grid points themselves.  The returned
   /// object is a `DataGrid` object, each point of which can then be
   /// used to interpolate to the supertranslated time.
+  GWFrames_INSTRUMENT_SCOPE("SliceModes::BMSTransformationOnSlice");
 
   const int n_theta = 2*EllMax()+1;
   const int n_phi = n_theta;
 
   // Evaluate the functions we need on the boosted (and appropriately spin-transformed) grid
   const DataGrid oneoverK_g = GWFrames::InverseConformalFactorBoostedGrid(v, n_theta, n_phi);
-  const DataGrid oneoverKcubed_g = oneoverK_g.pow(3);
   const DataGrid ethethdelta_g(delta.edth().edth(), v, n_theta, n_phi);
-  const DataGrid ethupok_g = DataGrid(Modes((u-DataGrid(delta,n_theta,n_phi))/GWFrames::InverseConformalFactorGrid(v, n_theta, n_phi)).edth(),
-                                      v, n_theta, n_phi)*oneoverK_g; // (\eth u') / K
-  const DataGrid psi0_g(psi0, v, n_theta, n_phi);
-  const DataGrid psi1_g(psi1, v, n_theta, n_phi);
-  const DataGrid psi2_g(psi2, v, n_theta, n_phi);
-  const DataGrid psi3_g(psi3, v, n_theta, n_phi);
-  const DataGrid psi4_g(psi4, v, n_theta, n_phi);
-  const DataGrid sigma_g(sigma, v, n_theta, n_phi);
-  const DataGrid sigmadot_g(sigmadot, v, n_theta, n_phi);
-
-  // Construct new data accounting for changes of tetrad
+  DataGrid ethupok_g; // (\eth u') / K
+  {
+    // u' = (u-delta)/K^{-1}, computed in place
+    DataGrid uprime_g(delta, n_theta, n_phi);
+    const DataGrid InverseK_g = GWFrames::InverseConformalFactorGrid(v, n_theta, n_phi);
+    for(unsigned int i=0; i<uprime_g.size(); ++i) {
+      uprime_g[i] = (u-uprime_g[i])/InverseK_g[i];
+    }
+    uprime_g.SetSpin(delta.Spin()-InverseK_g.Spin());
+    DataGrid ethu_g(Modes(uprime_g).edth(), v, n_theta, n_phi);
+    ethupok_g.swap(ethu_g);
+    ethupok_g *= oneoverK_g;
+  }
+
+  // Construct new data accounting for changes of tetrad.  Each grid
+  // is evaluated on the boosted grid and then transformed in place,
+  // all in a single pass over the points, so that no temporary grids
+  // are needed; the results are then swapped into the output.
   SliceGrid Grids;
-  Grids.psi4 = oneoverKcubed_g*(psi4_g);
-  Grids.psi3 = oneoverKcubed_g*(psi3_g - ethupok_g*psi4_g);
-  Grids.psi2 = oneoverKcubed_g*(psi2_g - ethupok_g*(2*psi3_g - ethupok_g*psi4_g));
-  Grids.psi1 = oneoverKcubed_g*(psi1_g - ethupok_g*(3*psi2_g - ethupok_g*(3*psi3_g - ethupok_g*psi4_g)));
-  Grids.psi0 = oneoverKcubed_g*(psi0_g - ethupok_g*(4*psi1_g - ethupok_g*(6*psi2_g - ethupok_g*(4*psi3_g - ethupok_g*psi4_g))));
-  Grids.sigma = oneoverK_g*(sigma_g - ethethdelta_g);
-  Grids.sigmadot = sigmadot_g*(oneoverK_g.pow(2));
+  DataGrid psi0_g(psi0, v, n_theta, n_phi);
+  DataGrid psi1_g(psi1, v, n_theta, n_phi);
+  DataGrid psi2_g(psi2, v, n_theta, n_phi);
+  DataGrid psi3_g(psi3, v, n_theta, n_phi);
+  DataGrid psi4_g(psi4, v, n_theta, n_phi);
+  DataGrid sigma_g(sigma, v, n_theta, n_phi);
+  DataGrid sigmadot_g(sigmadot, v, n_theta, n_phi);
+  const unsigned int N = oneoverK_g.size();
+  for(unsigned int i=0; i<N; ++i) {
+    const std::complex<double> oneoverK = oneoverK_g[i];
+    const std::complex<double> oneoverKcubed = oneoverK*oneoverK*oneoverK;
+    const std::complex<double> e = ethupok_g[i];
+    const std::complex<double> p0 = psi0_g[i], p1 = psi1_g[i], p2 = psi2_g[i], p3 = psi3_g[i], p4 = psi4_g[i];
+    psi4_g[i] = oneoverKcubed*(p4);
+    psi3_g[i] = oneoverKcubed*(p3 - e*p4);
+    psi2_g[i] = oneoverKcubed*(p2 - e*(2.0*p3 - e*p4));
+    psi1_g[i] = oneoverKcubed*(p1 - e*(3.0*p2 - e*(3.0*p3 - e*p4)));
+    psi0_g[i] = oneoverKcubed*(p0 - e*(4.0*p1 - e*(6.0*p2 - e*(4.0*p3 - e*p4))));
+    sigma_g[i] = oneoverK*(sigma_g[i] - ethethdelta_g[i]);
+    sigmadot_g[i] = sigmadot_g[i]*(oneoverK*oneoverK);
+  }
+  // The conformal factor has spin weight 0, so the spins are unchanged
+  Grids.psi0.swap(psi0_g);
+  Grids.psi1.swap(psi1_g);
+  Grids.psi2.swap(psi2_g);
+  Grids.psi3.swap(psi3_g);
+  Grids.psi4.swap(psi4_g);
+  Grids.sigma.swap(sigma_g);
+  Grids.sigmadot.swap(sigmadot_g);
 
   return Grids;
 }
@@ -827,20 +987,32 @@ void SliceModes::MoreschiIteration(GWFrames::Modes& OneOverK_ip1, GWFrames::Mode
   /// that slice and computes the values of \f$K_{i+1}\f$ and
   /// \f$\delta_{i+1}\f$, returning them by reference.
 
+  /// The supertranslation returned is relative to this slice, so
+  /// its ell<2 modes (time and space translations) are zero.  See
+  /// also `SuperMomenta::MoreschiIteration`, which performs the
+  /// transformation as well.
+
   const Modes Psi = SuperMomentum();
-  const double M = Mass();
+  const double M = MassOfFourMomentum(FourMomentumFromSuperMomentum(Psi));
 
   // 1/K is just Psi/M in the first two ell values
   OneOverK_ip1 = Modes(4);
   OneOverK_ip1.SetEllMax(1);
-  OneOverK_ip1[0] = Psi[0]/M;
-  OneOverK_ip1[1] = Psi[1]/M;
-  OneOverK_ip1[2] = Psi[2]/M;
-  OneOverK_ip1[3] = Psi[3]/M;
-
-  //
+  MoreschiInverseConformalFactor(OneOverK_ip1, Psi, M);
+
+  // Since this slice is already transformed, K=1 here, so the
+  // constant M/K^3 term only contributes to ell=0, and the ell>=2
+  // modes of delta come straight from the supermomentum.
+  const int ellMax = EllMax();
+  delta_ip1 = Modes(Psi.size());
+  delta_ip1.SetEllMax(ellMax);
+  for(int i_m=4, ell=2; ell<=ellMax; ++ell) {
+    const double factor = 4.0/((ell-1.0)*(ell)*(ell+1.0)*(ell+2.0));
+    for(int m=-ell; m<=ell; ++m, ++i_m) {
+      delta_ip1[i_m] = factor*Psi[i_m];
+    }
+  }
 
-  throw(GWFrames_NotYetImplemented);
   return;
 }
 
@@ -857,6 +1029,7 @@ Scri::Scri(const GWFrames::Waveform& psi0, const GWFrames::Waveform& psi1,
            const GWFrames::Waveform& psi4, const GWFrames::Waveform& sigma)
   : t(psi0.T()), slices(t.size(), SliceModes(psi0.EllMax()))
 {
+  GWFrames_INSTRUMENT_SCOPE("Scri::Scri");
   // Check that everyone has the same NTimes().  This is a poor man's
   // way of making sure we have all the same times, and is of course
   // only necessary, not sufficient proof that the times are the same.
@@ -908,6 +1081,130 @@ Scri::Scri(const GWFrames::Waveform& psi0, const GWFrames::Waveform& psi1,
   }
 }
 
+/// Construct from a set of slices and their times
+Scri::Scri(const std::vector<double>& T, const std::vector<SliceModes>& Slices)
+  : t(T), slices(Slices)
+{
+  if(t.size()!=slices.size()) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+              << "\nError: (T.size()=" << T.size() << ") != (Slices.size()=" << Slices.size() << ")"
+              << "\n       Each slice needs a time.\n"
+              << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+}
+
+#ifndef DOXYGEN
+namespace {
+
+  // Find the range of input slices needed to interpolate to the times
+  // `u` (step 0 of Scri::BMSTransformation)
+  void BMSTransformationWindow(const vector<double>& t, const DataGrid& u, int& iMin, int& iMax) {
+    const int N = u.N_theta()*u.N_phi();
+    double uMax = std::real(u[0]);
+    double uMin = std::real(u[0]);
+    for(int i=1; i<N; ++i) {
+      const double u_i = std::real(u[i]);
+      if(u_i>uMax) { uMax = u_i; }
+      if(u_i<uMin) { uMin = u_i; }
+    }
+    if(uMin<t[0] || uMax>t.back()) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+                << "\nError: (uMin=" << uMin << ") < (t[0]=" << t[0] << ") or (uMax=" << uMax << ") > (t[-1]=" << t.back() << ")"
+                << "\n       Cannot extrapolate data.\n"
+                << std::endl;
+      throw(GWFrames_ValueError);
+    }
+    iMax = t.size()-1;
+    while(t[iMax]>uMax && iMax>0) { --iMax; } // t[iMax] is now strictly less than uMax
+    iMin = 0;
+    while(t[iMin]<uMin && iMin<int(t.size())-1) { ++iMin; } // t[iMin] is now strictly greater than uMin
+    iMin = std::max(0, iMin-3);
+    iMax = std::min(int(t.size())-1, std::max(iMin+7, iMax+3));
+  }
+
+  // Transform the given input slices onto the grid of the final frame
+  // (step 1 of Scri::BMSTransformation).  The slices are independent,
+  // so they are transformed in parallel.  This makes sure the
+  // singletons used by SWSH are constructed before any threads need
+  // them, and passes any exception out of the parallel region by hand.
+  void TransformSlices(const Scri& scri, const vector<int>& indices, const ThreeVector& v, const Modes& delta,
+                       vector<SliceGrid>& transformedslices) {
+    const int N = indices.size();
+    if(N==0) { return; }
+    const vector<double>& t = scri.T();
+    { SphericalFunctions::SWSH Y(0, Quaternion(1.0, 0.0, 0.0, 0.0)); }
+    int ErrorCode = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for(int j=0; j<N; ++j) {
+      try {
+        const int i = indices[j];
+        SliceGrid Slice = scri[i].BMSTransformationOnSlice(t[i], v, delta);
+        transformedslices[j].swap(Slice);
+      } catch(int e) {
+        #pragma omp critical(GWFrames_BMSTransformationError)
+        {
+          ErrorCode = e;
+        }
+      } catch(...) {
+        #pragma omp critical(GWFrames_BMSTransformationError)
+        {
+          ErrorCode = GWFrames_UnknownException;
+        }
+      }
+    }
+    if(ErrorCode) { throw(ErrorCode); }
+  }
+
+  // Interpolate the transformed slices to the new retarded time at
+  // each point, and transform back to spectral space (steps 2 and 3 of
+  // Scri::BMSTransformation)
+  SliceModes InterpolateTransformedSlices(const vector<const SliceGrid*>& transformedslices, const vector<double>& u_original,
+                                          const DataGrid& u, const int ellMax) {
+    const unsigned int Nslices = transformedslices.size();
+    const int n_theta2 = (*transformedslices[0])[0].N_theta();
+    const int n_phi2 = (*transformedslices[0])[0].N_phi();
+
+    // (2) Interpolate to new retarded time
+    // Create new object to hold the data
+    SliceGrid BMStransformedGrid(n_theta2*n_phi2);
+    // The interpolation weights depend only on u_i at each point, so
+    // they are found once per point and applied to all seven data
+    // types, and to real and imaginary parts together
+    const CubicSplineWeights Weights(u_original);
+    const int N_g = n_theta2*n_phi2;
+    #pragma omp parallel
+    {
+      vector<double> w(Nslices);
+      vector<double> z(Nslices);
+      #pragma omp for schedule(static)
+      for(int i_g=0; i_g<N_g; ++i_g) { // Loop over grid points
+        const double u_i = std::real(u[i_g]); // Interpolate the data at this point to u_i (measured in the current frame)
+        Weights(u_i, w, z);
+        for(int i_D=0; i_D<7; ++i_D) { // Loop over data types
+          complex<double> value(0.0, 0.0);
+          for(unsigned int i_s=0; i_s<Nslices; ++i_s) {
+            value += w[i_s] * (*transformedslices[i_s])[i_D][i_g];
+          }
+          BMStransformedGrid[i_D][i_g] = value;
+        }
+      }
+    }
+
+    // (3) Transform back to spectral space
+    SliceModes BMStransformed(ellMax);
+    #pragma omp parallel for schedule(dynamic)
+    for(int i_D=0; i_D<7; ++i_D) { // Loop over data types
+      Modes M(BMStransformedGrid[i_D]);
+      BMStransformed[i_D].swap(M);
+    }
+
+    return BMStransformed;
+  }
+
+}
+#endif // DOXYGEN
+
 /// Apply a (constant) BMS transformation to data on null infinity
 SliceModes Scri::BMSTransformation(const double& u0, const ThreeVector& v, const GWFrames::Modes& delta) const {
   /// \param u0 Initial time slice to transform
@@ -943,6 +1240,7 @@ SliceModes Scri::BMSTransformation(const double& u0, const ThreeVector& v, const
   /// arbitrarily set \f$u' = 0\f$, because any other choice can be
   /// absorbed into a time- and space-translation.  This does not
   /// matter, of course, because that choice is not stored in any way.
+  GWFrames_INSTRUMENT_SCOPE("Scri::BMSTransformation");
 
   const int n_theta = 2*slices[0].EllMax()+1;
   const int n_phi = n_theta;
@@ -951,79 +1249,93 @@ SliceModes Scri::BMSTransformation(const double& u0, const ThreeVector& v, const
   // to the new time slice
   const DataGrid u = u0 + DataGrid(delta, n_theta, n_phi); // This choice arbitrarily sets u'=0; other choices are degenerate with a space-time translation
   // const DataGrid u = u0/GWFrames::ConformalFactorGrid(v, n_theta, n_phi) + DataGrid(delta, n_theta, n_phi);
-  double uMax = std::real(u[0]);
-  double uMin = std::real(u[0]);
-  for(int i=1; i<n_theta*n_phi; ++i) {
-    const double u_i = std::real(u[i]);
-    if(u_i>uMax) { uMax = u_i; }
-    if(u_i<uMin) { uMin = u_i; }
-  }
-  if(uMin<t[0] || uMax>t.back()) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
-              << "\nError: (uMin=" << uMin << ") < (t[0]=" << t[0] << ") or (uMax=" << uMax << ") > (t[-1]=" << t.back() << ")"
-              << "\n       Cannot extrapolate data.\n"
-              << std::endl;
-    throw(GWFrames_ValueError);
-  }
-  int iMax = t.size()-1;
-  while(t[iMax]>uMax && iMax>0) { --iMax; } // t[iMax] is now strictly less than uMax
-  int iMin = 0;
-  while(t[iMin]<uMin && iMin<int(t.size())-1) { ++iMin; } // t[iMin] is now strictly greater than uMin
-  iMin = std::max(0, iMin-3);
-  iMax = std::min(int(t.size())-1, std::max(iMin+7, iMax+3));
+  int iMin, iMax;
+  BMSTransformationWindow(t, u, iMin, iMax);
 
   // (1) Evaluate BMS-transformed data on equi-angular grids of the final frame at a series of times
   const unsigned int Nslices = iMax-iMin+1;
   vector<SliceGrid> transformedslices(Nslices);
   vector<double> u_original(Nslices);
+  vector<const SliceGrid*> window(Nslices);
+  vector<int> indices(Nslices);
   for(int i=iMin; i<=iMax; ++i) {
     u_original[i-iMin] = t[i];
-    transformedslices[i-iMin] = slices[i].BMSTransformationOnSlice(t[i], v, delta);
+    window[i-iMin] = &transformedslices[i-iMin];
+    indices[i-iMin] = i;
   }
-  const int n_theta2 = transformedslices[0][0].N_theta();
-  const int n_phi2 = transformedslices[0][0].N_phi();
+  TransformSlices(*this, indices, v, delta, transformedslices);
 
-  // (2) Interpolate to new retarded time
-  // Create new object to hold the data
-  SliceGrid BMStransformedGrid(n_theta2*n_phi2);
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, Nslices);
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, Nslices);
-  // Loop through, doing the work
-  for(int i_g=0, i_t=0; i_t<n_theta2; ++i_t) { // Loop over theta points
-    for(int i_p=0; i_p<n_phi2; ++i_p, ++i_g) { // Loop over phi points
-      const double u_i = std::real(u[i_g]); // Interpolate the data at this point to u_i (measured in the current frame)
-      for(int i_D=0; i_D<7; ++i_D) { // Loop over data types
-        // Fill the storage vectors for extrapolation
-        vector<double> re(Nslices);
-        vector<double> im(Nslices);
-        for(unsigned int i_s=0; i_s<Nslices; ++i_s) {
-          re[i_s] = std::real(transformedslices[i_s][i_D][i_g]);
-          im[i_s] = std::imag(transformedslices[i_s][i_D][i_g]);
-        }
-        // Initialize the interpolators for this data set
-        gsl_spline_init(splineRe, &(u_original)[0], &re[0], Nslices);
-        gsl_spline_init(splineIm, &(u_original)[0], &im[0], Nslices);
-        // Extrapolate real and imaginary parts and store data
-        BMStransformedGrid[i_D][i_g] = complex<double>( gsl_spline_eval(splineRe, u_i, accRe), gsl_spline_eval(splineIm, u_i, accIm) );
-      }
+  // (2) Interpolate to new retarded time, and (3) transform back to spectral space
+  return InterpolateTransformedSlices(window, u_original, u, slices[0].EllMax());
+}
+
+/// Execute a BMS transformation, producing data on a series of new time slices
+Scri Scri::BMSTransformation(const std::vector<double>& u0, const ThreeVector& v, const GWFrames::Modes& delta) const {
+  /// \param u0 Increasing sequence of times of the new slices, measured as in the single-slice version
+  /// \param v Three-vector of the boost relative to the current frame
+  /// \param delta Spherical-harmonic modes of the supertranslation
+  ///
+  /// The slice at each time `u0[i]` of the returned object is
+  /// identical to the result of `BMSTransformation(u0[i], v, delta)`.
+  /// However, the per-slice part of the transformation (step 1 of
+  /// that function) only depends on the input slice, not on `u0`, so
+  /// each input slice is transformed just once here, and kept in a
+  /// sliding window for as long as any new slice needs it.  The cost
+  /// is therefore proportional to the number of input slices touched,
+  /// rather than about 8 slice transformations per output time.
+  ///
+  /// \sa BMSTransformation(const double&, const ThreeVector&, const GWFrames::Modes&) const
+  GWFrames_INSTRUMENT_SCOPE("Scri::BMSTransformation (all slices)");
+
+  // Check that the times are increasing, so that the window only moves forward
+  for(unsigned int i=1; i<u0.size(); ++i) {
+    if(u0[i]<=u0[i-1]) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+                << "\nError: (u0[" << i << "]=" << u0[i] << ") <= (u0[" << i-1 << "]=" << u0[i-1] << ")"
+                << "\n       The new times must be strictly increasing.\n"
+                << std::endl;
+      throw(GWFrames_ValueError);
     }
   }
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
 
-  // (3) Transform back to spectral space
-  SliceModes BMStransformed(slices[0].EllMax());
-  for(int i_D=0; i_D<7; ++i_D) { // Loop over data types
-    BMStransformed[i_D] = Modes(BMStransformedGrid[i_D]);
+  const int ellMax = slices[0].EllMax();
+  const int n_theta = 2*ellMax+1;
+  const int n_phi = n_theta;
+  const DataGrid delta_g(delta, n_theta, n_phi);
+
+  vector<SliceModes> NewSlices(u0.size());
+  std::map<int, SliceGrid> Transformed; // The sliding window, indexed by input slice
+  for(unsigned int i_u=0; i_u<u0.size(); ++i_u) {
+    // (0) Find the current time slices we need for this new slice
+    const DataGrid u = u0[i_u] + delta_g;
+    int iMin, iMax;
+    BMSTransformationWindow(t, u, iMin, iMax);
+
+    // (1) Drop slices that have left the window, and transform those that have entered it
+    Transformed.erase(Transformed.begin(), Transformed.lower_bound(iMin));
+    vector<int> indices;
+    for(int i=iMin; i<=iMax; ++i) {
+      if(Transformed.find(i)==Transformed.end()) { indices.push_back(i); }
+    }
+    vector<SliceGrid> newslices(indices.size());
+    TransformSlices(*this, indices, v, delta, newslices);
+    for(unsigned int i=0; i<indices.size(); ++i) {
+      Transformed[indices[i]].swap(newslices[i]);
+    }
+
+    // (2) and (3) Interpolate and transform back to spectral space
+    const unsigned int Nslices = iMax-iMin+1;
+    vector<const SliceGrid*> window(Nslices);
+    vector<double> u_original(Nslices);
+    for(int i=iMin; i<=iMax; ++i) {
+      window[i-iMin] = &Transformed[i];
+      u_original[i-iMin] = t[i];
+    }
+    SliceModes Slice = InterpolateTransformedSlices(window, u_original, u, ellMax);
+    NewSlices[i_u].swap(Slice);
   }
 
-  return BMStransformed;
+  return Scri(u0, NewSlices);
 }
 
 
@@ -1034,7 +1346,8 @@ GWFrames::SuperMomenta::SuperMomenta(const Scri& scri)
 {
   const unsigned int NTimes = scri.NTimes();
   for(unsigned int i_t=0; i_t<NTimes; ++i_t) {
-    Psi[i_t] = scri[i_t].SuperMomentum();
+    Modes Psi_t = scri[i_t].SuperMomentum();
+    Psi[i_t].swap(Psi_t);
   }
 }
 
@@ -1071,13 +1384,34 @@ GWFrames::Modes GWFrames::SuperMomenta::BMSTransform(const GWFrames::Modes& OneO
 
   // (1) Evaluate BMS-transformed data on equi-angular grids of the final frame at a series of times
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  const unsigned int Nslices = iMax-iMin+1;
+  // The pieces that do not depend on the slice are computed once,
+  // and the slices are then transformed in parallel.
+  const int Nslices = iMax-iMin+1;
   vector<DataGrid> transformedslices(Nslices);
   vector<double> u_original(Nslices);
-  for(int i=iMin; i<=iMax; ++i) {
-    u_original[i-iMin] = t[i];
-    transformedslices[i-iMin] = DataGrid((Psi[i] - delta.edth2edthbar2())*OneOverK.pow(3), v, n_theta, n_phi);
+  const Modes edth2edthbar2delta = delta.edth2edthbar2();
+  const Modes OneOverKcubed = OneOverK.pow(3);
+  { SphericalFunctions::SWSH Y(0, Quaternion(1.0, 0.0, 0.0, 0.0)); }
+  int ErrorCode = 0;
+  #pragma omp parallel for schedule(dynamic)
+  for(int i_s=0; i_s<Nslices; ++i_s) {
+    try {
+      u_original[i_s] = t[iMin+i_s];
+      DataGrid Grid((Psi[iMin+i_s] - edth2edthbar2delta)*OneOverKcubed, v, n_theta, n_phi);
+      transformedslices[i_s].swap(Grid);
+    } catch(int e) {
+      #pragma omp critical(GWFrames_BMSTransformationError)
+      {
+        ErrorCode = e;
+      }
+    } catch(...) {
+      #pragma omp critical(GWFrames_BMSTransformationError)
+      {
+        ErrorCode = GWFrames_UnknownException;
+      }
+    }
   }
+  if(ErrorCode) { throw(ErrorCode); }
   const int n_theta2 = transformedslices[0].N_theta();
   const int n_phi2 = transformedslices[0].N_phi();
 
@@ -1085,40 +1419,68 @@ GWFrames::Modes GWFrames::SuperMomenta::BMSTransform(const GWFrames::Modes& OneO
   ///////////////////////////////////////
   // Create new object to hold the data
   DataGrid BMStransformedGrid(n_theta2*n_phi2);
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, Nslices);
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, Nslices);
+  // The interpolation weights at each point depend only on u_i
+  const CubicSplineWeights Weights(u_original);
+  vector<double> w(Nslices);
+  vector<double> z(Nslices);
   // Loop through, doing the work
-  for(int i_g=0, i_t=0; i_t<n_theta2; ++i_t) { // Loop over theta points
-    for(int i_p=0; i_p<n_phi2; ++i_p, ++i_g) { // Loop over phi points
-      const double u_i = std::real(u[i_g]); // Interpolate the data at this point to u_i (measured in the current frame)
-      // Fill the storage vectors for extrapolation
-      vector<double> re(Nslices);
-      vector<double> im(Nslices);
-      for(unsigned int i_s=0; i_s<Nslices; ++i_s) {
-        re[i_s] = std::real(transformedslices[i_s][i_g]);
-        im[i_s] = std::imag(transformedslices[i_s][i_g]);
-      }
-      // Initialize the interpolators for this data set
-      gsl_spline_init(splineRe, &(u_original)[0], &re[0], Nslices);
-      gsl_spline_init(splineIm, &(u_original)[0], &im[0], Nslices);
-      // Extrapolate real and imaginary parts and store data
-      BMStransformedGrid[i_g] = complex<double>( gsl_spline_eval(splineRe, u_i, accRe), gsl_spline_eval(splineIm, u_i, accIm) );
+  for(int i_g=0; i_g<n_theta2*n_phi2; ++i_g) { // Loop over grid points
+    const double u_i = std::real(u[i_g]); // Interpolate the data at this point to u_i (measured in the current frame)
+    Weights(u_i, w, z);
+    complex<double> value(0.0, 0.0);
+    for(int i_s=0; i_s<Nslices; ++i_s) {
+      value += w[i_s] * transformedslices[i_s][i_g];
     }
+    BMStransformedGrid[i_g] = value;
   }
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
 
   // (3) Transform back to spectral space
   ///////////////////////////////////////
   return Modes(BMStransformedGrid);
 }
 
+#ifndef DOXYGEN
+namespace {
+
+  // One step of the Moreschi algorithm for SuperMomenta, returning
+  // the mass measured on the transformed slice
+  double MoreschiStep(const SuperMomenta& S, Modes& OneOverK, Modes& delta) {
+    // Record the values of the supermomentum, four-momentum, and mass on this slice
+    const Modes Psi_i = S.BMSTransform(OneOverK, delta);
+    const double M = MassOfFourMomentum(FourMomentumFromSuperMomentum(Psi_i));
+
+    // Increment the values of delta to the next step
+    const int ellMax = delta.EllMax();
+    const Modes deltaderiv = Psi_i + Modes(M/DataGrid(OneOverK, 7, 7).pow(3));
+    for(int i_m=4, ell=2; ell<=ellMax; ++ell) {
+      const double factor = 4.0/((ell-1.0)*(ell)*(ell+1.0)*(ell+2.0));
+      for(int m=-ell; m<=ell; ++m, ++i_m) {
+        delta[i_m] = factor*deltaderiv[i_m];
+      }
+    }
+
+    // Increment the values of OneOverK to the next step
+    MoreschiInverseConformalFactor(OneOverK, Psi_i, M);
+
+    return M;
+  }
+
+  // The size of the change in the parts of the BMS transformation
+  // updated by the Moreschi algorithm
+  double MoreschiChange(const Modes& OneOverK_i, const Modes& delta_i, const Modes& OneOverK_ip1, const Modes& delta_ip1) {
+    double change = 0.0;
+    for(unsigned int i_m=0; i_m<4 && i_m<OneOverK_i.size(); ++i_m) {
+      change += std::norm(OneOverK_ip1[i_m]-OneOverK_i[i_m]);
+    }
+    for(unsigned int i_m=4; i_m<delta_i.size(); ++i_m) {
+      change += std::norm(delta_ip1[i_m]-delta_i[i_m]);
+    }
+    return std::sqrt(change);
+  }
+
+}
+#endif // DOXYGEN
+
 /// Transform to given slice with given BMS transformation, and return next step in Moreschi algorithm
 void GWFrames::SuperMomenta::MoreschiIteration(GWFrames::Modes& OneOverK, GWFrames::Modes& delta) const {
   /// \param OneOverK Inverse conformal factor (input/output)
@@ -1129,41 +1491,86 @@ void GWFrames::SuperMomenta::MoreschiIteration(GWFrames::Modes& OneOverK, GWFram
   /// then replaces the values of that BMS transformation with the
   /// next step in the Moreschi algorithm.
 
-  // Record the values of the supermomentum, four-momentum, and mass on this slice
-  const Modes Psi_i = BMSTransform(OneOverK, delta);
-  FourVector p(4);
-  p[0] = std::real(Psi_i[0])/sqrt4pi;
-  // The following are divided by 3 relative to what I would naively
-  // expect.  I don't understand why, but this is written into the
-  // definition of the vector l^a, so it must be incorporated each
-  // time that vector appears.
-  p[1] = std::real((Psi_i[1]-Psi_i[3]))/(sqrt3*sqrt8pi);
-  p[2] = -std::real(complexi*(Psi_i[1]+Psi_i[3]))/(sqrt3*sqrt8pi);
-  p[3] = std::real(Psi_i[2])/(sqrt3*sqrt4pi);
-  const double M = std::sqrt(p[0]*p[0]-p[1]*p[1]-p[2]*p[2]-p[3]*p[3]);
-
-  // Increment the values of delta to the next step
-  const int ellMax = delta.EllMax();
-  const Modes deltaderiv = Psi_i + Modes(M/DataGrid(OneOverK, 7, 7).pow(3));
-  for(int i_m=4, ell=2; ell<=ellMax; ++ell) {
-    const double factor = 4.0/((ell-1.0)*(ell)*(ell+1.0)*(ell+2.0));
-    for(int m=-ell; m<=ell; ++m, ++i_m) {
-      delta[i_m] = factor*deltaderiv[i_m];
+  MoreschiStep(*this, OneOverK, delta);
+  return;
+}
+
+/// Iterate the Moreschi algorithm to convergence
+GWFrames::MoreschiConvergence GWFrames::SuperMomenta::MoreschiIterations(GWFrames::Modes& OneOverK, GWFrames::Modes& delta,
+                                                                         const double Tolerance, const int MaxIterations) const {
+  /// \param OneOverK Inverse conformal factor (input/output)
+  /// \param delta Supertranslation (input/output)
+  /// \param Tolerance Stop when the change in the transformation falls below this
+  /// \param MaxIterations Maximum number of steps to take
+  ///
+  /// This repeatedly applies `MoreschiIteration` to the input BMS
+  /// transformation, which is used as the initial guess, until the
+  /// norm of the change in the modes it updates (ell>=2 for delta,
+  /// ell<=1 for OneOverK) is less than `Tolerance`.  The returned
+  /// statistics record the number of iterations, the change at each
+  /// step, and the mass on the final slice.  Failure to converge is
+  /// not an error; it is reported in the returned object, and the
+  /// last iterate is returned by reference.
+  ///
+  /// \sa NiceSections
+
+  MoreschiConvergence Stats;
+  Modes OneOverK_i, delta_i;
+  for(int i=0; i<MaxIterations; ++i) {
+    OneOverK_i = OneOverK;
+    delta_i = delta;
+    Stats.Mass = MoreschiStep(*this, OneOverK, delta);
+    Stats.DeltaChange = MoreschiChange(OneOverK_i, delta_i, OneOverK, delta);
+    Stats.DeltaChanges.push_back(Stats.DeltaChange);
+    Stats.Iterations = i+1;
+    if(Stats.DeltaChange<Tolerance) {
+      Stats.Converged = true;
+      break;
     }
   }
+  return Stats;
+}
 
-  // Increment the values of OneOverK to the next step
-  OneOverK[0] = Psi_i[0]/M;
-  // The following are divided by 3 relative to what I would naively
-  // expect.  I don't understand why, but this is written into the
-  // definition of the vector l^a, so it must be incorporated each
-  // time that vector appears.
-  //
-  // Also note that I reverse the signs of the following, so that the
-  // boost will be cancelled out next time, rather than just reported.
-  OneOverK[1] = -Psi_i[1]/(3*M);
-  OneOverK[2] = -Psi_i[2]/(3*M);
-  OneOverK[3] = -Psi_i[3]/(3*M);
+/// Find the nice sections at a series of times
+std::vector<GWFrames::MoreschiConvergence> GWFrames::SuperMomenta::NiceSections(const std::vector<double>& u0,
+                                                                                const GWFrames::Modes& OneOverK0, const GWFrames::Modes& delta0,
+                                                                                std::vector<GWFrames::Modes>& OneOverKs, std::vector<GWFrames::Modes>& deltas,
+                                                                                const double Tolerance, const int MaxIterations) const {
+  /// \param u0 Times at which to find the nice sections
+  /// \param OneOverK0 Initial guess for the inverse conformal factor at u0[0]
+  /// \param delta0 Initial guess for the supertranslation at u0[0]
+  /// \param OneOverKs Inverse conformal factors found at each time (output)
+  /// \param deltas Supertranslations found at each time (output)
+  /// \param Tolerance Passed to `MoreschiIterations`
+  /// \param MaxIterations Passed to `MoreschiIterations`
+  ///
+  /// The time of each section is given by the ell=0 mode of the
+  /// supertranslation, which the Moreschi algorithm does not change.
+  /// Each time after the first is warm-started from the solution at
+  /// the previous time, with only that mode reset to the new time, so
+  /// that a sweep along a simulation typically needs only a few
+  /// iterations per time.  The ell=1 modes of `delta0` (a spatial
+  /// translation) are carried along unchanged.
+  ///
+  /// \sa MoreschiIterations
 
-  return;
+  if(delta0.size()==0) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+              << "\nError: The initial supertranslation must have at least the ell=0 mode.\n"
+              << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  const int N = u0.size();
+  OneOverKs.resize(N);
+  deltas.resize(N);
+  std::vector<MoreschiConvergence> Stats(N);
+  Modes OneOverK(OneOverK0);
+  Modes delta(delta0);
+  for(int i=0; i<N; ++i) {
+    delta[0] = sqrt4pi*u0[i];
+    Stats[i] = MoreschiIterations(OneOverK, delta, Tolerance, MaxIterations);
+    OneOverKs[i] = OneOverK;
+    deltas[i] = delta;
+  }
+  return Stats;
 }
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <complex>
+#include <algorithm>
 #include "Utilities.hpp"
 #include "Quaternions.hpp"
 #include "Waveforms.hpp"
@@ -36,11 +37,17 @@ namespace GWFrames {
     int n_theta;
     int n_phi;
     std::vector<std::complex<double> > data;
+    friend class Modes;
   public: // Constructors
     DataGrid(const int size=0) : s(0), n_theta(std::sqrt(size)), n_phi(std::sqrt(size)), data(size) { }
     DataGrid(const DataGrid& A) : s(A.s), n_theta(A.n_theta), n_phi(A.n_phi), data(A.data) { }
+    #if __cplusplus >= 201103L
+    DataGrid(DataGrid&& A) noexcept : s(A.s), n_theta(A.n_theta), n_phi(A.n_phi), data() { data.swap(A.data); }
+    DataGrid& operator=(const DataGrid& A) = default;
+    DataGrid& operator=(DataGrid&& A) noexcept { swap(A); return *this; }
+    #endif
     DataGrid(const int Spin, const int N_theta, const int N_phi, const std::vector<std::complex<double> >& D);
-    explicit DataGrid(Modes M, const int N_theta=0, const int N_phi=0); // Can't be const& because of spinsfast design
+    explicit DataGrid(const Modes& M, const int N_theta=0, const int N_phi=0);
     DataGrid(const Modes& M, const GWFrames::ThreeVector& v, const int N_theta=0, const int N_phi=0);
     DataGrid(const int Spin, const int N_theta, const int N_phi, const GWFrames::ThreeVector& v, const ScriFunctor& f);
   public: // Modification
@@ -60,6 +67,12 @@ namespace GWFrames {
     DataGrid operator+(const DataGrid&) const;
     DataGrid operator-(const DataGrid&) const;
     DataGrid pow(const int p) const;
+  public: // In-place operations, which avoid allocating temporaries
+    DataGrid& operator*=(const DataGrid&);
+    DataGrid& operator/=(const DataGrid&);
+    DataGrid& operator+=(const DataGrid&);
+    DataGrid& operator-=(const DataGrid&);
+    inline void swap(DataGrid& B) { std::swap(s, B.s); std::swap(n_theta, B.n_theta); std::swap(n_phi, B.n_phi); data.swap(B.data); }
   }; // class DataGrid
   DataGrid operator*(const double& a, const DataGrid& b);
   DataGrid operator/(const double& a, const DataGrid& b);
@@ -80,15 +93,21 @@ namespace GWFrames {
     int s;
     int ellMax;
     std::vector<std::complex<double> > data;
+    friend class DataGrid;
   public: // Constructors
     Modes(const int size=0): s(0), ellMax(0), data(size) { }
     Modes(const Modes& A) : s(A.s), ellMax(A.ellMax), data(A.data) { }
+    #if __cplusplus >= 201103L
+    Modes(Modes&& A) noexcept : s(A.s), ellMax(A.ellMax), data() { data.swap(A.data); }
+    Modes& operator=(Modes&& B) noexcept { swap(B); return *this; }
+    #endif
     Modes(const int spin, const std::vector<std::complex<double> >& Data);
-    explicit Modes(DataGrid D, const int L=-1); // Can't be const& because of spinsfast design
+    explicit Modes(const DataGrid& D, const int L=-1);
     Modes& operator=(const Modes& B);
   public: // Modification
     inline Modes& SetSpin(const int ess) { s=ess; return *this; }
     inline Modes& SetEllMax(const int ell) { ellMax=ell; return *this; }
+    Modes& SetFromGrid(const DataGrid& D, const int L=-1);
   public: // Access
     inline unsigned int size() const { return data.size(); }
     inline int Spin() const { return s; }
@@ -96,6 +115,7 @@ namespace GWFrames {
     inline std::complex<double> operator[](const unsigned int i) const { return data[i]; }
     inline std::complex<double>& operator[](const unsigned int i) { return data[i]; }
     inline std::vector<std::complex<double> > Data() const { return data; }
+    inline void swap(Modes& B) { std::swap(s, B.s); std::swap(ellMax, B.ellMax); data.swap(B.data); }
   public: // Operations
     Modes pow(const int p) const { return Modes(DataGrid(*this, 2*EllMax()*p+1, 2*EllMax()*p+1).pow(p)); }
     Modes bar() const;
@@ -112,6 +132,7 @@ namespace GWFrames {
   GWFrames::ThreeVector vFromOneOverK(const GWFrames::Modes& OneOverK);
 
 
+
   template <class D>
   class SliceOfScri {
     /// This class holds all the necessary objects needed to
@@ -121,6 +142,15 @@ namespace GWFrames {
   public: // Constructors
     SliceOfScri(const int size=0);
     SliceOfScri(const SliceOfScri& S) : psi0(S.psi0), psi1(S.psi1), psi2(S.psi2), psi3(S.psi3), psi4(S.psi4), sigma(S.sigma), sigmadot(S.sigmadot) { }
+    inline void swap(SliceOfScri& S) {
+      psi0.swap(S.psi0); psi1.swap(S.psi1); psi2.swap(S.psi2); psi3.swap(S.psi3); psi4.swap(S.psi4);
+      sigma.swap(S.sigma); sigmadot.swap(S.sigmadot);
+    }
+    #if __cplusplus >= 201103L
+    SliceOfScri(SliceOfScri&& S) noexcept { swap(S); }
+    SliceOfScri& operator=(const SliceOfScri& S) = default;
+    SliceOfScri& operator=(SliceOfScri&& S) noexcept { swap(S); return *this; }
+    #endif
   public: //Access
     inline const D& operator[](const unsigned int i) const {
       if(i==0) { return psi0; }
@@ -185,17 +215,34 @@ namespace GWFrames {
          const GWFrames::Waveform& psi2, const GWFrames::Waveform& psi3,
          const GWFrames::Waveform& psi4, const GWFrames::Waveform& sigma);
     Scri(const Scri& S) : t(S.t), slices(S.slices) { }
+    Scri(const std::vector<double>& T, const std::vector<SliceModes>& Slices);
   public: // Member functions
     // Transformations
     SliceModes BMSTransformation(const double& u0, const GWFrames::ThreeVector& v, const GWFrames::Modes& delta) const;
+    Scri BMSTransformation(const std::vector<double>& u0, const GWFrames::ThreeVector& v, const GWFrames::Modes& delta) const;
     // Access
     inline int NTimes() const { return t.size(); }
-    inline const std::vector<double> T() const { return t; }
-    inline const SliceModes operator[](const unsigned int i) const { return slices[i]; }
+    inline const std::vector<double>& T() const { return t; }
+    inline const SliceModes& operator[](const unsigned int i) const { return slices[i]; }
     inline SliceModes& operator[](const unsigned int i) { return slices[i]; }
   }; // class Scri
 
 
+  class MoreschiConvergence {
+    /// Statistics reported by the Moreschi iteration for a single
+    /// slice.  `DeltaChanges` records the norm of the change in the
+    /// modes of the supertranslation (ell>=2) and inverse conformal
+    /// factor at each iteration; `DeltaChange` is the last of these.
+  public:
+    int Iterations;
+    bool Converged;
+    double DeltaChange;
+    double Mass;
+    std::vector<double> DeltaChanges;
+    MoreschiConvergence() : Iterations(0), Converged(false), DeltaChange(0.0), Mass(0.0), DeltaChanges() { }
+  }; // class MoreschiConvergence
+
+
   class SuperMomenta {
   private:
     std::vector<double> t;
@@ -208,12 +255,18 @@ namespace GWFrames {
     SuperMomenta(const Scri& scri);
     // Access
     inline int NTimes() const { return t.size(); }
-    inline const std::vector<double> T() const { return t; }
-    inline const Modes operator[](const unsigned int i) const { return Psi[i]; }
+    inline const std::vector<double>& T() const { return t; }
+    inline const Modes& operator[](const unsigned int i) const { return Psi[i]; }
     inline Modes& operator[](const unsigned int i) { return Psi[i]; }
     // Transformations
     Modes BMSTransform(const GWFrames::Modes& OneOverK, const GWFrames::Modes& delta) const;
     void MoreschiIteration(GWFrames::Modes& OneOverK, GWFrames::Modes& delta) const;
+    MoreschiConvergence MoreschiIterations(GWFrames::Modes& OneOverK, GWFrames::Modes& delta,
+                                           const double Tolerance=1e-10, const int MaxIterations=50) const;
+    std::vector<MoreschiConvergence> NiceSections(const std::vector<double>& u0,
+                                                  const GWFrames::Modes& OneOverK0, const GWFrames::Modes& delta0,
+                                                  std::vector<GWFrames::Modes>& OneOverKs, std::vector<GWFrames::Modes>& deltas,
+                                                  const double Tolerance=1e-10, const int MaxIterations=50) const;
   }; // class SuperMomenta
 
 
@@ -0,0 +1,371 @@
+// Copyright (c) 2014, Michael Boyle
+// See LICENSE file for details
+
+#include "SphericalTransforms.hpp"
+
+#include <algorithm>
+#include <map>
+#include <iostream>
+#include <cmath>
+
+// The following are for spinsfast
+#ifndef DOXYGEN
+namespace GWFrames {
+  #ifndef restrict
+  #ifdef __restrict
+  #define restrict __restrict
+  #endif
+  #endif
+  extern "C" {
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <math.h>
+    #include <complex.h>
+    #include "fftw3.h"
+    #include "alm.h"
+    #include "wigner_d_halfpi.h"
+    #include "spinsfast_forward.h"
+    #include "spinsfast_backward.h"
+  }
+};
+#endif // DOXYGEN
+
+#include "Utilities.hpp"
+#include "SphericalFunctions/SWSHs.hpp"
+#include "Errors.hpp"
+#include "Instrumentation.hpp"
+
+using GWFrames::SpinsfastWorkspaceLease;
+using GWFrames::SpectralProductTable;
+
+using std::vector;
+using std::cerr;
+using std::endl;
+using std::complex;
+
+const std::complex<double> zero(0.0,0.0);
+
+
+/////////////////////////
+// Spinsfast workspace //
+/////////////////////////
+
+// The basic spinsfast functions `spinsfast_salm2map` and
+// `spinsfast_map2salm` recompute the Wigner-d recursion tables, the
+// quadrature weights, and the FFTW plans, and reallocate all of their
+// work arrays, on every call.  The workspace below holds all of those
+// for a given (ellMax, n_theta, n_phi) and performs the same steps
+// with them.  Workspaces are kept in a pool for the life of the
+// process; each is only used by one thread at a time, since the
+// Wigner-d tables include scratch space.  The spin only enters the
+// arithmetic, so it is not part of the key.
+#ifndef DOXYGEN
+namespace GWFrames {
+  namespace {
+
+    inline fftw_complex* fc(complex<double>* p) { return reinterpret_cast<fftw_complex*>(p); }
+    inline const fftw_complex* fc(const complex<double>* p) { return reinterpret_cast<const fftw_complex*>(p); }
+    inline complex<double>* AllocateComplex(const int n) { return reinterpret_cast<complex<double>*>(fftw_malloc(std::max(n,1)*sizeof(fftw_complex))); }
+    inline int NegativeOneToThe(const int n) { return ((n & 1) == 0) ? 1 : -1; }
+
+  } // empty namespace
+
+  class SpinsfastWorkspace {
+  private:
+    int lmax, Ntheta, Nphi, wsize, Nm;
+    wdhp_TN_helper* DeltaTN;
+    vector<double> W; // Real parts of the quadrature weights in theta
+    complex<double> *f_in, *fm, *Fm, *F, *Imm, *Jmm, *Gmm;
+    fftw_plan PhiForward, ThetaForward, Backward;
+    SpinsfastWorkspace(const SpinsfastWorkspace&);
+    SpinsfastWorkspace& operator=(const SpinsfastWorkspace&);
+  public:
+    SpinsfastWorkspace(const int LMax, const int N_theta, const int N_phi)
+      : lmax(LMax), Ntheta(N_theta), Nphi(N_phi), wsize(2*(N_theta-1)), Nm(2*LMax+1),
+        DeltaTN(0), W(std::max(wsize,0)), f_in(0), fm(0), Fm(0), F(0), Imm(0), Jmm(0), Gmm(0),
+        PhiForward(0), ThetaForward(0), Backward(0)
+    {
+      // This must be called from inside the FFTW planner's critical section
+      if(lmax<0 || Ntheta<2 || Nphi<1) { return; }
+      if(Nm>Nphi || Nm>wsize) {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": (Ntheta=" << Ntheta << ", Nphi=" << Nphi << ")"
+             << " is too small a grid to represent ellMax=" << lmax << "." << endl;
+        throw(GWFrames_ValueError);
+      }
+      DeltaTN = wdhp_TN_helper_init(lmax);
+      complex<double>* Wc = AllocateComplex(wsize);
+      spinsfast_quadrature_weights(fc(Wc), wsize);
+      for(int i=0; i<wsize; ++i) { W[i] = Wc[i].real(); }
+      fftw_free(Wc);
+      f_in = AllocateComplex(Ntheta*Nphi);
+      fm = AllocateComplex(Ntheta*Nphi);
+      Fm = AllocateComplex(wsize*Nphi);
+      F = AllocateComplex(wsize*Nphi);
+      Imm = AllocateComplex(Nm*Nm);
+      Jmm = AllocateComplex((lmax+1)*Nm);
+      Gmm = AllocateComplex(Nm*Nm);
+      int n = Nphi;
+      PhiForward = fftw_plan_many_dft(1, &n, Ntheta, fc(f_in), &n, 1, Nphi, fc(fm), &n, 1, Nphi, FFTW_FORWARD, FFTW_MEASURE);
+      int nt = wsize;
+      ThetaForward = fftw_plan_many_dft(1, &nt, Nphi, fc(Fm), &nt, Nphi, 1, fc(F), &nt, Nphi, 1, FFTW_FORWARD, FFTW_MEASURE);
+      Backward = fftw_plan_dft_2d(wsize, Nphi, fc(F), fc(F), FFTW_BACKWARD, FFTW_MEASURE);
+    }
+    ~SpinsfastWorkspace() {
+      if(PhiForward) { fftw_destroy_plan(PhiForward); }
+      if(ThetaForward) { fftw_destroy_plan(ThetaForward); }
+      if(Backward) { fftw_destroy_plan(Backward); }
+      if(f_in) { fftw_free(f_in); fftw_free(fm); fftw_free(Fm); fftw_free(F); fftw_free(Imm); fftw_free(Jmm); fftw_free(Gmm); }
+      if(DeltaTN) { wdhp_TN_helper_free(DeltaTN); }
+    }
+    bool ok() const { return (DeltaTN && PhiForward && ThetaForward && Backward); }
+
+    // Equivalent to spinsfast_salm2map, using the stored plans and tables
+    void salm2map(const complex<double>* alm, complex<double>* f, const int s) {
+      spinsfast_backward_Gmm(fc(alm), 1, &s, lmax, fc(Gmm), WDHP_METHOD_TN_PLANE, (void *)DeltaTN);
+      // The following is spinsfast_backward_transform
+      const int NF = wsize*Nphi;
+      for(int i=0; i<NF; ++i) { F[i] = zero; }
+      for(int mp=0; mp<=lmax; ++mp) {
+        for(int m=0; m<=lmax; ++m) {
+          F[ mp * Nphi + m] = Gmm[ mp * Nm + m ];
+          if(m > 0) { F[ mp * Nphi + (Nphi - m) ] = Gmm[ mp * Nm + (Nm - m)]; }
+          if(mp > 0) { F[ (wsize - mp) * Nphi + m ] = Gmm[ (Nm - mp) * Nm + m]; }
+          if( (mp > 0) && (m > 0) ) { F[ (wsize - mp) * Nphi + (Nphi - m) ] = Gmm[ (Nm - mp) * Nm + (Nm - m)]; }
+        }
+      }
+      fftw_execute(Backward);
+      std::copy(F, F+Ntheta*Nphi, f);
+    }
+
+    // Equivalent to spinsfast_map2salm, using the stored plans and tables
+    void map2salm(const complex<double>* f, complex<double>* alm, const int s) {
+      // The following is spinsfast_f_extend_MW
+      std::copy(f, f+Ntheta*Nphi, f_in);
+      fftw_execute(PhiForward);
+      const double norm = M_PI/Nphi/(Ntheta-1); // = 2pi/Nphi/Ntheta_extended
+      const int signs = NegativeOneToThe(s);
+      for(int itheta=0; itheta<Ntheta; ++itheta) {
+        for(int im=0; im<Nphi; ++im) {
+          const int m = (im <= Nphi/2) ? im : (im - Nphi);
+          const int signm = NegativeOneToThe(m);
+          Fm[ itheta * Nphi + im ] = (W[itheta] * norm) * fm[ itheta * Nphi + im ];
+          if(itheta > 0) {
+            Fm[ (wsize - itheta) * Nphi + im] = (signs*signm*W[wsize - itheta] * norm) * fm[itheta * Nphi + im];
+          }
+        }
+      }
+      fftw_execute(ThetaForward);
+      // The following is the rest of spinsfast_forward_multi_Imm
+      const int NImm = Nm*Nm;
+      for(int i=0; i<NImm; ++i) { Imm[i] = zero; }
+      for(int mp=0; mp<=lmax; ++mp) {
+        for(int m=0; m<=lmax; ++m) {
+          Imm[ mp * Nm + m ] = F[ mp * Nphi + m];
+          if(m > 0) { Imm[ mp * Nm + (Nm - m)] = F[ mp * Nphi + (Nphi - m) ]; }
+          if(mp > 0) { Imm[ (Nm - mp) * Nm + m] = F[ (wsize - mp) * Nphi + m ]; }
+          if( (mp > 0) && (m > 0) ) { Imm[ (Nm - mp) * Nm + (Nm - m)] = F[ (wsize - mp) * Nphi + (Nphi - m) ]; }
+        }
+      }
+      // The following is the rest of spinsfast_forward_multi_Jmm
+      const int negtos = NegativeOneToThe(s);
+      for(int mp=0; mp<=lmax; ++mp) {
+        const int mpmod = mp % Nm;
+        const int negmpmod = (Nm - mp) % Nm;
+        for(int m=-lmax; m<=lmax; ++m) {
+          const int mmod = (Nm + m) % Nm;
+          if(mp==0) {
+            Jmm[mp*Nm + mmod] = Imm[mpmod*Nm + mmod];
+          } else {
+            Jmm[mp*Nm + mmod] = Imm[mpmod*Nm + mmod] + double(NegativeOneToThe(m)*negtos)*Imm[negmpmod*Nm + mmod];
+          }
+        }
+      }
+      spinsfast_forward_transform(fc(alm), 1, &s, lmax, fc(Jmm), WDHP_METHOD_TN_PLANE, (void *)DeltaTN);
+    }
+  }; // class SpinsfastWorkspace
+
+  namespace {
+
+    typedef std::pair<int, std::pair<int, int> > SpinsfastKey;
+    std::map<SpinsfastKey, vector<SpinsfastWorkspace*> > SpinsfastWorkspacePool;
+
+  } // empty namespace
+} // namespace GWFrames
+#endif // DOXYGEN
+
+/// Borrow a workspace from the pool, creating one if necessary
+SpinsfastWorkspaceLease::SpinsfastWorkspaceLease(const int LMax, const int N_theta, const int N_phi)
+  : lmax(LMax), ntheta(N_theta), nphi(N_phi), Workspace(0)
+{
+  /// \param LMax Largest ell of the modes
+  /// \param N_theta Number of points in theta, including both poles
+  /// \param N_phi Number of points in phi
+  ///
+  /// The grid must be able to represent every mode, so that
+  /// `2*LMax+1` is at most `N_phi` and `2*(N_theta-1)`; otherwise
+  /// GWFrames_ValueError is thrown.
+  const SpinsfastKey Key(lmax, std::make_pair(ntheta, nphi));
+  #pragma omp critical(GWFrames_SpinsfastWorkspaces)
+  {
+    vector<SpinsfastWorkspace*>& Available = SpinsfastWorkspacePool[Key];
+    if(!Available.empty()) {
+      Workspace = Available.back();
+      Available.pop_back();
+    }
+  }
+  if(!Workspace) {
+    // Exceptions can't leave the critical section, so pass them on afterwards
+    int Error = 0;
+    #pragma omp critical(GWFrames_FFTWPlanner)
+    {
+      try {
+        Workspace = new SpinsfastWorkspace(lmax, ntheta, nphi);
+      } catch(int e) {
+        Error = e;
+      } catch(...) {
+        Error = GWFrames_UnknownException;
+      }
+    }
+    if(Error) { throw(Error); }
+    if(!Workspace->ok()) {
+      #pragma omp critical(GWFrames_FFTWPlanner)
+      {
+        delete Workspace;
+      }
+      Workspace = 0;
+    }
+  }
+}
+
+/// Return the workspace to the pool
+SpinsfastWorkspaceLease::~SpinsfastWorkspaceLease() {
+  if(Workspace) {
+    const SpinsfastKey Key(lmax, std::make_pair(ntheta, nphi));
+    #pragma omp critical(GWFrames_SpinsfastWorkspaces)
+    {
+      SpinsfastWorkspacePool[Key].push_back(Workspace);
+    }
+  }
+}
+
+/// Evaluate the modes `alm` with spin weight `s` on the grid `f`
+void SpinsfastWorkspaceLease::salm2map(const complex<double>* alm, complex<double>* f, const int s) {
+  GWFrames_INSTRUMENT_COUNT("spinsfast transforms", 1);
+  if(Workspace) {
+    Workspace->salm2map(alm, f, s);
+  } else {
+    vector<complex<double> > a(alm, alm+N_lm(lmax));
+    // spinsfast creates FFTW plans, which is not thread safe
+    #pragma omp critical(GWFrames_FFTWPlanner)
+    spinsfast_salm2map(reinterpret_cast<fftw_complex*>(&a[0]),
+                       reinterpret_cast<fftw_complex*>(f),
+                       s, ntheta, nphi, lmax);
+  }
+}
+
+/// Decompose the grid `f` with spin weight `s` into the modes `alm`
+void SpinsfastWorkspaceLease::map2salm(const complex<double>* f, complex<double>* alm, const int s) {
+  GWFrames_INSTRUMENT_COUNT("spinsfast transforms", 1);
+  if(Workspace) {
+    Workspace->map2salm(f, alm, s);
+  } else {
+    vector<complex<double> > g(f, f+ntheta*nphi);
+    // spinsfast creates FFTW plans, which is not thread safe
+    #pragma omp critical(GWFrames_FFTWPlanner)
+    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&g[0]),
+                       reinterpret_cast<fftw_complex*>(alm),
+                       s, ntheta, nphi, lmax);
+  }
+}
+
+
+////////////////////////////
+// Spectral product table //
+////////////////////////////
+
+/// Find the coupling coefficients for the product of two factors
+SpectralProductTable::SpectralProductTable(const int sA, const int ellMaxA, const int sB, const int ellMaxB, const int ellMaxC)
+  : Begin(N_lm(ellMaxA)+1, 0)
+{
+  /// \param sA Spin weight of the first factor
+  /// \param ellMaxA Largest ell of the first factor
+  /// \param sB Spin weight of the second factor
+  /// \param ellMaxB Largest ell of the second factor
+  /// \param ellMaxC Largest ell of the product that is kept
+  ///
+  /// The coefficients come from
+  /// \f[
+  ///   {}_{s_1}Y_{l_1,m_1}\, {}_{s_2}Y_{l_2,m_2}
+  ///     = \sum_L (-1)^{s_1+s_2+m_1+m_2} \sqrt{\frac{(2l_1+1)(2l_2+1)(2L+1)}{4\pi}}
+  ///       \left( \begin{array}{ccc} l_1 & l_2 & L \\ m_1 & m_2 & -m_1-m_2 \end{array} \right)
+  ///       \left( \begin{array}{ccc} l_1 & l_2 & L \\ -s_1 & -s_2 & s_1+s_2 \end{array} \right)
+  ///       {}_{s_1+s_2}Y_{L,m_1+m_2}.
+  /// \f]
+  /// Use `ellMaxC=ellMaxA+ellMaxB` to keep every mode of the product.
+  const int sC = sA+sB;
+  for(int i_A=0, lA=0; lA<=ellMaxA; ++lA) {
+    for(int mA=-lA; mA<=lA; ++mA, ++i_A) {
+      if(lA>=std::abs(sA)) {
+        for(int lB=std::abs(sB); lB<=ellMaxB; ++lB) {
+          for(int mB=-lB; mB<=lB; ++mB) {
+            const int mC = mA+mB;
+            const int lCMin = std::max(std::abs(lA-lB), std::max(std::abs(mC), std::abs(sC)));
+            const int lCMax = std::min(lA+lB, ellMaxC);
+            for(int lC=lCMin; lC<=lCMax; ++lC) {
+              const double c = SphericalFunctions::Wigner3j(lA, lB, lC, mA, mB, -mC)
+                * SphericalFunctions::Wigner3j(lA, lB, lC, -sA, -sB, sC);
+              if(c==0.0) { continue; }
+              const double sign = (((sC+mC)&1)==0 ? 1.0 : -1.0);
+              IndexB.push_back(lB*(lB+1)+mB);
+              IndexC.push_back(lC*(lC+1)+mC);
+              Coefficient.push_back(sign*c*std::sqrt((2*lA+1)*(2*lB+1)*(2*lC+1)/(4*M_PI)));
+            }
+          }
+        }
+      }
+      Begin[i_A+1] = Coefficient.size();
+    }
+  }
+}
+
+#ifndef DOXYGEN
+namespace {
+
+  struct SpectralProductKey {
+    int sA, ellMaxA, sB, ellMaxB, ellMaxC;
+    SpectralProductKey(const int sa, const int ellmaxa, const int sb, const int ellmaxb, const int ellmaxc)
+      : sA(sa), ellMaxA(ellmaxa), sB(sb), ellMaxB(ellmaxb), ellMaxC(ellmaxc) { }
+    bool operator<(const SpectralProductKey& b) const {
+      if(sA!=b.sA) { return sA<b.sA; }
+      if(ellMaxA!=b.ellMaxA) { return ellMaxA<b.ellMaxA; }
+      if(sB!=b.sB) { return sB<b.sB; }
+      if(ellMaxB!=b.ellMaxB) { return ellMaxB<b.ellMaxB; }
+      return ellMaxC<b.ellMaxC;
+    }
+  };
+
+}
+#endif // DOXYGEN
+
+/// Return the coupling coefficients for the product of two factors, building them only once
+const GWFrames::SpectralProductTable& GWFrames::CachedSpectralProductTable(const int sA, const int ellMaxA, const int sB, const int ellMaxB,
+                                                                           const int ellMaxC) {
+  /// The tables are built once for each combination of spins and
+  /// ellMax values, and kept for the life of the program.  Entries of
+  /// a std::map are never moved, so the returned reference stays
+  /// valid after the critical section.
+  ///
+  /// \sa SpectralProductTable
+  static std::map<SpectralProductKey, SpectralProductTable> Tables;
+  const SpectralProductTable* Table = 0;
+  #pragma omp critical(GWFrames_SpectralProductTables)
+  {
+    const SpectralProductKey Key(sA, ellMaxA, sB, ellMaxB, ellMaxC);
+    std::map<SpectralProductKey, SpectralProductTable>::iterator it = Tables.find(Key);
+    if(it==Tables.end()) {
+      it = Tables.insert(std::make_pair(Key, SpectralProductTable(sA, ellMaxA, sB, ellMaxB, ellMaxC))).first;
+    }
+    Table = &(it->second);
+  }
+  return *Table;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2014, Michael Boyle
+// See LICENSE file for details
+
+#ifndef SPHERICALTRANSFORMS_HPP
+#define SPHERICALTRANSFORMS_HPP
+
+#include <vector>
+#include <complex>
+
+namespace GWFrames {
+
+  #ifndef DOXYGEN
+  class SpinsfastWorkspace;
+  #endif // DOXYGEN
+
+  /// Transformations between modes and an equi-angular grid, reusing spinsfast plans and tables
+  class SpinsfastWorkspaceLease {
+    /// Constructing an object of this class borrows a workspace for
+    /// the given (ellMax, n_theta, n_phi) from a pool kept for the
+    /// life of the process (creating one if necessary), and
+    /// destroying it returns the workspace.  Each object must only be
+    /// used by one thread at a time, so parallel loops should make
+    /// one per thread, outside the loop.  Modes are in the order used
+    /// by spinsfast, starting from (ell,m)=(0,0), and the grid is
+    /// stored with phi varying fastest.  If the transform cannot be
+    /// planned, the basic spinsfast functions are used instead.
+  private:
+    int lmax, ntheta, nphi;
+    SpinsfastWorkspace* Workspace;
+    SpinsfastWorkspaceLease(const SpinsfastWorkspaceLease&);
+    SpinsfastWorkspaceLease& operator=(const SpinsfastWorkspaceLease&);
+  public:
+    SpinsfastWorkspaceLease(const int LMax, const int N_theta, const int N_phi);
+    ~SpinsfastWorkspaceLease();
+    void salm2map(const std::complex<double>* alm, std::complex<double>* f, const int s);
+    void map2salm(const std::complex<double>* f, std::complex<double>* alm, const int s);
+  }; // class SpinsfastWorkspaceLease
+
+  /// Coupling coefficients for products of spin-weighted functions in spectral space
+  class SpectralProductTable {
+    /// This holds the nonzero coefficients with which the product of
+    /// each mode of a factor A (with spin sA, up to ellMaxA) and each
+    /// mode of a factor B (with spin sB, up to ellMaxB) contributes to
+    /// the modes of the product up to ellMaxC.  Modes are numbered as
+    /// in `Modes`, by \f$\ell(\ell+1)+m\f$, and the entries are grouped
+    /// by the mode of A, so that zero or missing modes of A can be
+    /// skipped.  This is used for products of both `Modes` and
+    /// `Waveform` objects.
+  public:
+    std::vector<int> Begin; // The entries for mode i_A of A are Begin[i_A] <= k < Begin[i_A+1]
+    std::vector<int> IndexB, IndexC;
+    std::vector<double> Coefficient;
+    SpectralProductTable(const int sA, const int ellMaxA, const int sB, const int ellMaxB, const int ellMaxC);
+  }; // class SpectralProductTable
+  const SpectralProductTable& CachedSpectralProductTable(const int sA, const int ellMaxA, const int sB, const int ellMaxB,
+                                                         const int ellMaxC);
+
+} // namespace GWFrames
+
+#endif // SPHERICALTRANSFORMS_HPP
@@ -3,6 +3,11 @@
 
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "Utilities.hpp"
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_eigen.h>
@@ -10,6 +15,8 @@
 #include <gsl/gsl_cblas.h>
 #include "Quaternions.hpp"
 #include "Errors.hpp"
+#include "Instrumentation.hpp"
+using GWFrames::Array2D;
 using GWFrames::Matrix;
 using GWFrames::MatrixC;
 using Quaternions::Quaternion;
@@ -290,6 +297,75 @@ double GWFrames::CumulativeScalarIntegral(const std::vector<double>& fdot, const
 
 inline double SQR(const double a) { return a*a; }
 
+#ifndef DOXYGEN
+namespace {
+
+  // Relative tolerance on the variation of time steps for which the
+  // constant-coefficient derivative stencil is used
+  const double UniformSpacingTolerance = 1.0e-10;
+
+  // Return true if the time steps of t are all equal (to within
+  // UniformSpacingTolerance), and set h to the step size
+  bool UniformSpacing(const std::vector<double>& t, double& h) {
+    const unsigned int N = t.size();
+    if(N<2) { return false; }
+    h = (t[N-1]-t[0])/double(N-1);
+    const double tol = UniformSpacingTolerance*std::fabs(h);
+    for(unsigned int i=1; i<N; ++i) {
+      if(std::fabs((t[i]-t[i-1])-h)>tol) { return false; }
+    }
+    return true;
+  }
+
+  // Fourth-order finite differences on a uniform grid with step h;
+  // these are the Bowen-Smith formulas evaluated for equal steps.
+  // Requires N>=5.
+  template <typename T>
+  void UniformDerivative(const T* f, T* D, const int N, const double h) {
+    const double c = 1.0/(12.0*h);
+    const int i_f = N-1;
+    D[0] = (-25.0*f[0] + 48.0*f[1] - 36.0*f[2] + 16.0*f[3] - 3.0*f[4]) * c;
+    D[1] = (-3.0*f[0] - 10.0*f[1] + 18.0*f[2] - 6.0*f[3] + f[4]) * c;
+    for(int i=2; i<i_f-1; ++i) {
+      D[i] = ((f[i-2] - f[i+2]) + 8.0*(f[i+1] - f[i-1])) * c;
+    }
+    D[i_f-1] = (3.0*f[i_f] + 10.0*f[i_f-1] - 18.0*f[i_f-2] + 6.0*f[i_f-3] - f[i_f-4]) * c;
+    D[i_f] = (25.0*f[i_f] - 48.0*f[i_f-1] + 36.0*f[i_f-2] - 16.0*f[i_f-3] + 3.0*f[i_f-4]) * c;
+  }
+
+  // Weights of Bowen-Smith Eq. (A 5b) for the derivative at x, using
+  // the five points x[0..4]
+  void BowenSmithWeights(const double* X, const double x, double* w) {
+    const double h1 = X[0] - x;
+    const double h2 = X[1] - x;
+    const double h3 = X[2] - x;
+    const double h4 = X[3] - x;
+    const double h5 = X[4] - x;
+    const double h12 = X[0] - X[1];
+    const double h13 = X[0] - X[2];
+    const double h14 = X[0] - X[3];
+    const double h15 = X[0] - X[4];
+    const double h23 = X[1] - X[2];
+    const double h24 = X[1] - X[3];
+    const double h25 = X[1] - X[4];
+    const double h34 = X[2] - X[3];
+    const double h35 = X[2] - X[4];
+    const double h45 = X[3] - X[4];
+    w[0] = -(h2*h3*h4 + h2*h3*h5 + h2*h4*h5 + h3*h4*h5)/(h12*h13*h14*h15);
+    w[1] =  (h1*h3*h4 + h1*h3*h5 + h1*h4*h5 + h3*h4*h5)/(h12*h23*h24*h25);
+    w[2] = -(h1*h2*h4 + h1*h2*h5 + h1*h4*h5 + h2*h4*h5)/(h13*h23*h34*h35);
+    w[3] =  (h1*h2*h3 + h1*h2*h5 + h1*h3*h5 + h2*h3*h5)/(h14*h24*h34*h45);
+    w[4] = -(h1*h2*h3 + h1*h2*h4 + h1*h3*h4 + h2*h3*h4)/(h15*h25*h35*h45);
+  }
+
+  // First index of the five-point stencil used at point i of N
+  inline int DerivativeStencilStart(const int i, const int N) {
+    return (i<2 ? 0 : (i>N-3 ? N-5 : i-2));
+  }
+
+}
+#endif // DOXYGEN
+
 /// Five-point finite-differencing of vector of doubles.
 std::vector<double> GWFrames::ScalarDerivative(const std::vector<double>& f, const std::vector<double>& t) {
   ///
@@ -305,6 +381,9 @@ std::vector<double> GWFrames::ScalarDerivative(const std::vector<double>& f, con
   /// simpler formulas.  If there are fewer than two points, or there
   /// are different numbers of points in the two input vectors, an
   /// exception is thrown.
+  ///
+  /// If the time steps are uniform, the same formula reduces to the
+  /// standard constant-coefficient stencil, which is used directly.
 
   if(f.size() != t.size()) {
     cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": f.size()=" << f.size() << " != t.size()=" << t.size() << endl;
@@ -341,6 +420,12 @@ std::vector<double> GWFrames::ScalarDerivative(const std::vector<double>& f, con
     return D;
   }
 
+  double h;
+  if(UniformSpacing(t, h)) {
+    UniformDerivative(&f[0], &D[0], f.size(), h);
+    return D;
+  }
+
   for(unsigned int i=0; i<2; ++i) {
     const double x = t[i];
     const double& f1 = f[0];
@@ -459,6 +544,9 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
   /// simpler formulas.  If there are fewer than two points, or there
   /// are different numbers of points in the two input vectors, an
   /// exception is thrown.
+  ///
+  /// If the time steps are uniform, the same formula reduces to the
+  /// standard constant-coefficient stencil, which is used directly.
 
   if(f.size() != t.size()) {
     cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": f.size()=" << f.size() << " != t.size()=" << t.size() << endl;
@@ -495,6 +583,12 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
     return D;
   }
 
+  double h;
+  if(UniformSpacing(t, h)) {
+    UniformDerivative(&f[0], &D[0], f.size(), h);
+    return D;
+  }
+
   for(unsigned int i=0; i<2; ++i) {
     const double x = t[i];
     const std::complex<double>& f1 = f[0];
@@ -599,6 +693,63 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
 
 }
 
+/// Five-point finite-differencing of each row of a MatrixC.
+GWFrames::MatrixC GWFrames::ComplexDerivative(const GWFrames::MatrixC& f, const std::vector<double>& t) {
+  ///
+  /// \param f MatrixC whose rows are functions of time
+  /// \param t Vector of corresponding time steps
+  ///
+  /// This returns the derivative of each row of `f`, using the same
+  /// formulas as the vector version of this function.  The check for
+  /// uniform time steps is done once, and (for non-uniform steps) the
+  /// stencil coefficients are computed once and applied to every
+  /// row.  Rows are processed in parallel.
+
+  if(f.ncols() != int(t.size())) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": f.ncols()=" << f.ncols() << " != t.size()=" << t.size() << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  if(f.ncols()<2) { cerr << "\n" << __FILE__ << ":" << __LINE__ << ": size=" << f.ncols() << endl; throw(GWFrames_NotEnoughPointsForDerivative); }
+
+  const int NRows = f.nrows();
+  const int N = f.ncols();
+  MatrixC D(NRows, N);
+
+  if(N<5) {
+    for(int i_r=0; i_r<NRows; ++i_r) {
+      const vector<complex<double> > Di = ComplexDerivative(vector<complex<double> >(f[i_r], f[i_r]+N), t);
+      std::copy(Di.begin(), Di.end(), D[i_r]);
+    }
+    return D;
+  }
+
+  double h;
+  if(UniformSpacing(t, h)) {
+    #pragma omp parallel for schedule(static)
+    for(int i_r=0; i_r<NRows; ++i_r) {
+      UniformDerivative(f[i_r], D[i_r], N, h);
+    }
+    return D;
+  }
+
+  vector<double> W(5*N);
+  for(int i=0; i<N; ++i) {
+    const int j = DerivativeStencilStart(i, N);
+    BowenSmithWeights(&t[j], t[i], &W[5*i]);
+  }
+  #pragma omp parallel for schedule(static)
+  for(int i_r=0; i_r<NRows; ++i_r) {
+    const complex<double>* fi = f[i_r];
+    complex<double>* Di = D[i_r];
+    for(int i=0; i<N; ++i) {
+      const complex<double>* fj = fi+DerivativeStencilStart(i, N);
+      const double* w = &W[5*i];
+      Di[i] = w[0]*fj[0] + w[1]*fj[1] + w[2]*fj[2] + w[3]*fj[3] + w[4]*fj[4];
+    }
+  }
+  return D;
+}
+
 
 /// Integrate vector function by simple trapezoidal rule.
 std::vector<std::vector<double> > GWFrames::VectorIntegral(const std::vector<std::vector<double> >& fdot, const std::vector<double>& t) {
@@ -701,6 +852,79 @@ std::vector<double> GWFrames::Intersection(const std::vector<double>& t1, const
   return t;
 }
 
+/// Factor the spline system for the given points
+GWFrames::CubicSplineWeights::CubicSplineWeights(const std::vector<double>& X)
+  : x(X), h(X.size()>1 ? X.size()-1 : 0), cprime(X.size()>2 ? X.size()-2 : 0), denom(X.size()>2 ? X.size()-2 : 0)
+{
+  /// \param X Strictly increasing points at which the data will be given
+  const int N = x.size();
+  if(N<3) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__
+              << "\nError: Need at least 3 points for cubic-spline interpolation; got " << N << "."
+              << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  for(int j=0; j<N-1; ++j) {
+    h[j] = x[j+1]-x[j];
+  }
+  // Forward elimination of the system for the interior second
+  // derivatives c_1, ..., c_{N-2}, with rows
+  //   h_{i-1} c_{i-1} + 2(h_{i-1}+h_i) c_i + h_i c_{i+1} = r_i
+  for(int i=0; i<N-2; ++i) {
+    const double diag = 2*(h[i]+h[i+1]);
+    denom[i] = (i==0 ? diag : diag - h[i]*cprime[i-1]);
+    cprime[i] = h[i+1]/denom[i];
+  }
+}
+
+/// Find the weights of the spline at the point xi
+void GWFrames::CubicSplineWeights::operator()(const double xi, std::vector<double>& w, std::vector<double>& z) const {
+  /// \param xi Point at which the spline is to be evaluated
+  /// \param w On output, the weight of each data point
+  /// \param z Workspace
+  ///
+  /// Both `w` and `z` must have `size()` elements.  Points outside
+  /// the range of `X` are extrapolated from the end intervals.  This
+  /// may be called from multiple threads, as long as each has its own
+  /// `w` and `z`.
+  const int N = x.size();
+  // Find the interval containing xi, clamped to the end intervals
+  int k = int(std::upper_bound(x.begin(), x.end(), xi) - x.begin()) - 1;
+  if(k<0) { k = 0; }
+  if(k>N-2) { k = N-2; }
+  const double hk = h[k];
+  const double dx = xi-x[k];
+  // The spline on interval k is
+  //   y_k + dx*(b_k + dx*(c_k + dx*d_k)),
+  // with b_k and d_k linear in y_k, y_{k+1}, c_k, c_{k+1}
+  for(int j=0; j<N; ++j) { w[j] = 0.0; }
+  w[k] = 1.0 - dx/hk;
+  w[k+1] = dx/hk;
+  const double gamma_k = dx*(dx - 2*hk/3.0 - dx*dx/(3*hk));
+  const double gamma_kp1 = dx*(dx*dx/(3*hk) - hk/3.0);
+  // Solve for the adjoint vector: T z = (gamma_k e_k + gamma_{k+1}
+  // e_{k+1}), restricted to the interior points 1..N-2 (c_0=c_{N-1}=0
+  // for the natural spline).  T is symmetric, so the factorization
+  // above serves for both.
+  for(int i=0; i<N-2; ++i) {
+    double g = 0.0;
+    if(i+1==k) { g = gamma_k; } else if(i+1==k+1) { g = gamma_kp1; }
+    z[i] = (i==0 ? g : g - h[i]*z[i-1]) / denom[i];
+  }
+  for(int i=N-4; i>=0; --i) {
+    z[i] -= cprime[i]*z[i+1];
+  }
+  // Add the contributions through r_i = 3*[(y_{i+1}-y_i)/h_i - (y_i-y_{i-1})/h_{i-1}]
+  for(int i=0; i<N-2; ++i) {
+    const double a = 3*z[i]/h[i];
+    const double b = 3*z[i]/h[i+1];
+    w[i] += a;
+    w[i+1] -= a+b;
+    w[i+2] += b;
+  }
+  return;
+}
+
 /// Return the union of two time sequences.
 std::vector<double> GWFrames::Union(const std::vector<double>& t1, const std::vector<double>& t2, const double MinStep) {
   /// On the overlap between the two sequences, the time is built up
@@ -762,6 +986,59 @@ std::vector<double> GWFrames::Union(const std::vector<double>& t1, const std::ve
 }
 
 
+Array2D::Array2D(const std::vector<std::vector<double> >& DataIn)
+  : nr(DataIn.size()), nc(DataIn.size()==0 ? 0 : DataIn[0].size()), d(nr*nc)
+{
+  for(unsigned int r=0; r<nr; ++r) {
+    if(DataIn[r].size() != nc) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": DataIn[" << r << "].size()=" << DataIn[r].size()
+           << "; DataIn[0].size()=" << nc << endl;
+      throw(GWFrames_MatrixSizeMismatch);
+    }
+    std::copy(DataIn[r].begin(), DataIn[r].end(), d.begin()+r*nc);
+  }
+}
+
+/// Copy of one row of the array
+std::vector<double> Array2D::Row(const unsigned int row) const {
+  return vector<double>(d.begin()+row*nc, d.begin()+(row+1)*nc);
+}
+
+/// Copy of one column of the array
+std::vector<double> Array2D::Column(const unsigned int col) const {
+  vector<double> c(nr);
+  for(unsigned int r=0; r<nr; ++r) {
+    c[r] = d[r*nc+col];
+  }
+  return c;
+}
+
+/// Copy of the data as a vector of rows
+std::vector<std::vector<double> > Array2D::Nested() const {
+  vector<vector<double> > n(nr);
+  for(unsigned int r=0; r<nr; ++r) {
+    n[r] = vector<double>(d.begin()+r*nc, d.begin()+(r+1)*nc);
+  }
+  return n;
+}
+
+// / \@cond
+void Array2D::resize(const unsigned int rows, const unsigned int cols, const double a) {
+  nr = rows;
+  nc = cols;
+  d.assign(rows*cols, a);
+  return;
+}
+// / \@endcond
+
+void Array2D::swap(Array2D& b) {
+  std::swap(nr, b.nr);
+  std::swap(nc, b.nc);
+  d.swap(b.d);
+  return;
+}
+
+
 Matrix::Matrix()
   : m(NULL)
 { }
@@ -915,10 +1192,10 @@ std::vector<double> GWFrames::DominantPrincipalValue(std::vector<Matrix>& M) {
   gsl_eigen_symmv_workspace * w = gsl_eigen_symmv_alloc (3);
   for(unsigned int i=0; i<M.size(); ++i) {
     gsl_eigen_symmv(M[i].gslobj(), eval, evec, w); // Do the work
-    gsl_eigen_symmv_free(w);
     gsl_eigen_symmv_sort(eval, evec, GSL_EIGEN_SORT_VAL_DESC); // Sort by eigenvalue magnitude
     Result[i] = gsl_vector_get(eval, 0);
   }
+  gsl_eigen_symmv_free(w);
   gsl_vector_free(eval);
   gsl_matrix_free(evec);
   return Result;
@@ -1054,6 +1331,74 @@ std::vector<double> GWFrames::Eigensystem(Matrix& M) {
   return Result;
 }
 
+/// Eigenvalues and eigenvectors of a real symmetric 3x3 matrix, without allocating
+void GWFrames::SymmetricEigensystem3(const double* M, double* Values, double* Vectors) {
+  /// \param M Pointer to the 9 elements of the matrix, in row-major order
+  /// \param Values On output, the 3 eigenvalues in descending order
+  /// \param Vectors On output, the corresponding unit eigenvectors as the columns of a row-major 3x3 matrix
+  ///
+  /// This uses cyclic Jacobi rotations, which converge in a handful
+  /// of sweeps for 3x3 matrices, and are accurate even when
+  /// eigenvalues are nearly degenerate.  Only the upper triangle of
+  /// `M` is read.  The layout of `Vectors` matches that of GSL's
+  /// `evec` matrix in `Eigenvectors`, though the sign of each vector
+  /// is arbitrary in both cases.  Nothing is allocated, so this can
+  /// be called at each time step from multiple threads.
+  ///
+  /// \sa Eigensystem
+  double a[3][3] = { { M[0], M[1], M[2] }, { M[1], M[4], M[5] }, { M[2], M[5], M[8] } };
+  double v[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+  for(int sweep=0; sweep<32; ++sweep) {
+    bool Rotated = false;
+    for(int p=0; p<2; ++p) {
+      for(int q=p+1; q<3; ++q) {
+        // Skip elements that are negligible compared to roundoff in the diagonal
+        if(std::fabs(a[p][q]) <= 1.e-18*(std::fabs(a[p][p])+std::fabs(a[q][q]))) { continue; }
+        Rotated = true;
+        // Rotate by the angle that zeroes a[p][q]: cot(2*phi) = theta, t = tan(phi)
+        const double theta = 0.5*(a[q][q]-a[p][p])/a[p][q];
+        const double t = (theta>=0.0 ? 1.0 : -1.0) / (std::fabs(theta)+std::sqrt(theta*theta+1.0));
+        const double c = 1.0/std::sqrt(t*t+1.0);
+        const double s = t*c;
+        for(int k=0; k<3; ++k) {
+          const double akp = a[k][p];
+          const double akq = a[k][q];
+          a[k][p] = c*akp - s*akq;
+          a[k][q] = s*akp + c*akq;
+        }
+        for(int k=0; k<3; ++k) {
+          const double apk = a[p][k];
+          const double aqk = a[q][k];
+          a[p][k] = c*apk - s*aqk;
+          a[q][k] = s*apk + c*aqk;
+        }
+        for(int k=0; k<3; ++k) {
+          const double vkp = v[k][p];
+          const double vkq = v[k][q];
+          v[k][p] = c*vkp - s*vkq;
+          v[k][q] = s*vkp + c*vkq;
+        }
+        a[p][q] = a[q][p] = 0.0;
+      }
+    }
+    if(!Rotated) { break; }
+  }
+  // Sort by eigenvalue, in descending order
+  int Order[3] = { 0, 1, 2 };
+  for(int i=0; i<2; ++i) {
+    for(int j=i+1; j<3; ++j) {
+      if(a[Order[j]][Order[j]] > a[Order[i]][Order[i]]) { std::swap(Order[i], Order[j]); }
+    }
+  }
+  for(int j=0; j<3; ++j) {
+    Values[j] = a[Order[j]][Order[j]];
+    for(int i=0; i<3; ++i) {
+      Vectors[3*i+j] = v[i][Order[j]];
+    }
+  }
+  return;
+}
+
 double GWFrames::Determinant(Matrix& M) {
   if(M.nrows()!=3 || M.ncols()!=3) {
     cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": M.nrows()=" << M.nrows() << "; M.ncols()=" << M.ncols() << endl;
@@ -1069,68 +1414,90 @@ double GWFrames::Determinant(Matrix& M) {
 
 ////////////////////////////////////////////////////////////////
 
+#ifndef DOXYGEN
+namespace {
+  // Every allocation of MatrixC data goes through here, so that it
+  // can be counted by the instrumentation
+  std::complex<double>* NewMatrixCData(const int nel) {
+    if(nel<=0) { return NULL; }
+    GWFrames_INSTRUMENT_COUNT("MatrixC allocations", 1);
+    GWFrames_INSTRUMENT_COUNT("MatrixC bytes allocated", long(nel)*long(sizeof(std::complex<double>)));
+    return new std::complex<double>[nel];
+  }
+}
+#endif // DOXYGEN
+
 MatrixC::MatrixC()
-  : nn(0), mm(0), v(NULL)
+  : nn(0), mm(0), v(NULL), mapping(NULL)
 { }
 
 MatrixC::MatrixC(int n, int m)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL), mapping(NULL)
 {
   const int nel=m*n;
-  if(v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+  if(v) v[0] = NewMatrixCData(nel);
   for(int i=1;i<n;i++) {
     v[i] = v[i-1] + m;
   }
 }
 
 MatrixC::MatrixC(int n, int m, const std::complex<double> &a)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL), mapping(NULL)
 {
   const int nel=m*n;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+  if (v) v[0] = NewMatrixCData(nel);
   for (int i=1; i< n; i++) v[i] = v[i-1] + m;
   for (int i=0; i< n; i++) for (int j=0; j<m; j++) v[i][j] = a;
 }
 
 MatrixC::MatrixC(int n, int m, const std::complex<double> *a)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL), mapping(NULL)
 {
   const int nel=m*n;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+  if (v) v[0] = NewMatrixCData(nel);
   for (int i=1; i<n; i++) v[i] = v[i-1] + m;
   for (int i=0; i<n; i++) for (int j=0; j<m; j++) v[i][j] = *a++;
 }
 
 MatrixC::MatrixC(const MatrixC &rhs)
-  : nn(rhs.nn), mm(rhs.mm), v(nn>0 ? new std::complex<double>*[nn] : NULL)
+  : nn(rhs.nn), mm(rhs.mm), v(nn>0 ? new std::complex<double>*[nn] : NULL), mapping(rhs.mapping)
 {
+  if(mapping) {
+    // Share the read-only mapping; copies may be made and destroyed
+    // on different threads, so the count is changed atomically
+    __sync_fetch_and_add(&mapping->refcount, 1);
+    for (int i=0; i<nn; i++) v[i] = rhs.v[i];
+    return;
+  }
   const int nel=mm*nn;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+  if (v) v[0] = NewMatrixCData(nel);
   for (int i=1; i<nn; i++) v[i] = v[i-1] + mm;
   for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
 }
 
 MatrixC::MatrixC(const std::vector<std::vector<std::complex<double> > >& rhs)
-  : nn(rhs.size()), mm(nn>0 ? rhs[0].size() : 0), v(nn>0 ? new std::complex<double>*[nn] : NULL)
+  : nn(rhs.size()), mm(nn>0 ? rhs[0].size() : 0), v(nn>0 ? new std::complex<double>*[nn] : NULL), mapping(NULL)
 {
   const int nel=mm*nn;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+  if (v) v[0] = NewMatrixCData(nel);
   for (int i=1; i<nn; i++) v[i] = v[i-1] + mm;
   for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
 }
 
 MatrixC & MatrixC::operator=(const MatrixC &rhs) {
   if (this != &rhs) {
+    if (mapping || rhs.mapping) {
+      MatrixC tmp(rhs);
+      swap(tmp);
+      return *this;
+    }
     if (nn != rhs.nn || mm != rhs.mm) {
-      if (v != NULL) {
-        delete[] (v[0]);
-        delete[] (v);
-      }
+      release();
       nn=rhs.nn;
       mm=rhs.mm;
       v = nn>0 ? new std::complex<double>*[nn] : NULL;
       const int nel = mm*nn;
-      if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
+      if (v) v[0] = NewMatrixCData(nel);
       for (int i=1; i< nn; i++) v[i] = v[i-1] + mm;
     }
     for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
@@ -1138,25 +1505,51 @@ MatrixC & MatrixC::operator=(const MatrixC &rhs) {
   return *this;
 }
 
+#if __cplusplus >= 201103L
+// The data (or the mapping) of rhs are simply taken over, leaving it
+// empty, so returning a MatrixC by value never copies the elements
+MatrixC::MatrixC(MatrixC&& rhs) noexcept
+  : nn(rhs.nn), mm(rhs.mm), v(rhs.v), mapping(rhs.mapping)
+{
+  rhs.nn = 0;
+  rhs.mm = 0;
+  rhs.v = NULL;
+  rhs.mapping = NULL;
+}
+
+MatrixC& MatrixC::operator=(MatrixC&& rhs) {
+  if (this != &rhs) {
+    release();
+    nn = rhs.nn;
+    mm = rhs.mm;
+    v = rhs.v;
+    mapping = rhs.mapping;
+    rhs.nn = 0;
+    rhs.mm = 0;
+    rhs.v = NULL;
+    rhs.mapping = NULL;
+  }
+  return *this;
+}
+#endif // __cplusplus >= 201103L
+
 void MatrixC::swap(MatrixC& b) {
   { const int n = b.nn; b.nn=nn; nn=n; }
   { const int m = b.mm; b.mm=mm; mm=m; }
   { std::complex<double>** vv=b.v; b.v=v; v=vv; }
+  { Mapping* mp=b.mapping; b.mapping=mapping; mapping=mp; }
   return;
 }
 
 // / \@cond
 void MatrixC::resize(int newn, int newm) {
-  if (newn != nn || newm != mm) {
-    if (v != NULL) {
-      delete[] (v[0]);
-      delete[] (v);
-    }
+  if (newn != nn || newm != mm || mapping) {
+    release();
     nn = newn;
     mm = newm;
     v = nn>0 ? new std::complex<double>*[nn] : NULL;
     const int nel = mm*nn;
-    if (v) { v[0] = nel>0 ? new std::complex<double>[nel] : NULL; }
+    if (v) { v[0] = NewMatrixCData(nel); }
     for(int i=1; i< nn; i++) {
       v[i] = v[i-1] + mm;
     }
@@ -1165,16 +1558,13 @@ void MatrixC::resize(int newn, int newm) {
 // / \@endcond
 
 void MatrixC::assign(int newn, int newm, const std::complex<double>& a) {
-  if (newn != nn || newm != mm) {
-    if (v != NULL) {
-      delete[] (v[0]);
-      delete[] (v);
-    }
+  if (newn != nn || newm != mm || mapping) {
+    release();
     nn = newn;
     mm = newm;
     v = nn>0 ? new std::complex<double>*[nn] : NULL;
     const int nel = mm*nn;
-    if(v) { v[0] = nel>0 ? new std::complex<double>[nel] : NULL; }
+    if(v) { v[0] = NewMatrixCData(nel); }
     for(int i=1; i< nn; i++) {
       v[i] = v[i-1] + mm;
     }
@@ -1186,12 +1576,100 @@ void MatrixC::assign(int newn, int newm, const std::complex<double>& a) {
   }
 }
 
-MatrixC::~MatrixC()
-{
-  if (v != NULL) {
+/// Replace the data with a read-only memory map of a file
+void MatrixC::mapfile(const std::string& FileName, const std::size_t offset, int newn, int newm) {
+  ///
+  /// \param FileName Relative path to data file
+  /// \param offset Position in bytes of the first element in the file
+  /// \param newn Number of rows
+  /// \param newm Number of columns
+  ///
+  /// The file must hold the `newn*newm` elements contiguously, row
+  /// by row, as `complex<double>` in native byte order.  The data are
+  /// paged in by the operating system only as they are accessed, and
+  /// copies of this object share the same mapping.  The mapping is
+  /// read-only, so `detach` must be called to copy the data into
+  /// ordinary memory before modifying them; the file itself is never
+  /// modified.
+  ///
+  release();
+  nn = newn;
+  mm = newm;
+  const std::size_t nel = std::size_t(nn)*std::size_t(mm);
+  if(nel==0) {
+    nn = mm = 0;
+    resize(newn, newm);
+    return;
+  }
+  const int fd = open(FileName.c_str(), O_RDONLY);
+  if(fd<0) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "'" << endl;
+    nn = mm = 0;
+    throw(GWFrames_BadFileName);
+  }
+  const std::size_t length = offset + nel*sizeof(std::complex<double>);
+  struct stat st;
+  if(fstat(fd, &st)!=0 || std::size_t(st.st_size)<length) {
+    close(fd);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' is too small to hold the requested data" << endl;
+    nn = mm = 0;
+    throw(GWFrames_BadWaveformInformation);
+  }
+  void* addr = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr==MAP_FAILED) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": mmap of '" << FileName << "' failed" << endl;
+    nn = mm = 0;
+    throw(GWFrames_FailedSystemCall);
+  }
+  mapping = new Mapping;
+  mapping->addr = addr;
+  mapping->length = length;
+  mapping->refcount = 1;
+  v = new std::complex<double>*[nn];
+  v[0] = reinterpret_cast<std::complex<double>*>(static_cast<char*>(addr) + offset);
+  for(int i=1; i<nn; i++) {
+    v[i] = v[i-1] + mm;
+  }
+}
+
+/// Copy mapped data (if any) into memory owned by this object
+void MatrixC::detach() {
+  /// This must be called before writing to the data of a mapped
+  /// object.  It is not thread safe for a single object, so it should
+  /// be called before, not inside, a parallel region writing to the
+  /// data.  Other copies sharing the mapping are unaffected.
+  if(!mapping) { return; }
+  const int nel = mm*nn;
+  std::complex<double>* data = NewMatrixCData(nel);
+  std::copy(v[0], v[0]+nel, data);
+  release();
+  v = new std::complex<double>*[nn];
+  v[0] = data;
+  for(int i=1; i<nn; i++) {
+    v[i] = v[i-1] + mm;
+  }
+}
+
+// Free the storage, without changing nn or mm
+void MatrixC::release() {
+  if (mapping != NULL) {
+    if(__sync_sub_and_fetch(&mapping->refcount, 1)==0) {
+      munmap(mapping->addr, mapping->length);
+      delete mapping;
+    }
+    mapping = NULL;
+    delete[] (v);
+  } else if (v != NULL) {
     delete[] (v[0]);
     delete[] (v);
   }
+  v = NULL;
+}
+
+MatrixC::~MatrixC()
+{
+  release();
 }
 
 
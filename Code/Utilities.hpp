@@ -6,6 +6,8 @@
 
 #include <vector>
 #include <complex>
+#include <string>
+#include <cstddef>
 #include <iostream>
 #include <gsl/gsl_matrix.h>
 
@@ -46,11 +48,60 @@ namespace GWFrames {
   std::vector<std::vector<double> > VectorIntegral(const std::vector<std::vector<double> >& fdot, const std::vector<double>& t);
   std::vector<double> CumulativeVectorIntegral(const std::vector<std::vector<double> >& fdot, const std::vector<double>& t);
 
+  /// Weights of a natural cubic spline at a point, for reuse across data sets
+  class CubicSplineWeights {
+    /// The value of a natural cubic spline through the points
+    /// \f$(x_j,y_j)\f$, evaluated at a fixed point \f$x_i\f$, is
+    /// linear in the \f$y_j\f$.  This object factors the
+    /// (tridiagonal) spline system for a given set of \f$x_j\f$ once,
+    /// so that the weights \f$w_j\f$ with \f$\mathrm{spline}(x_i) =
+    /// \sum_j w_j y_j\f$ can be found in \f$O(N)\f$ per point, and
+    /// then applied to any number of data sets (real or complex)
+    /// sampled at the same \f$x_j\f$.  The result is identical to
+    /// GSL's `gsl_interp_cspline` up to roundoff.
+  private:
+    std::vector<double> x, h, cprime, denom;
+  public:
+    CubicSplineWeights(const std::vector<double>& X);
+    inline unsigned int size() const { return x.size(); }
+    void operator()(const double xi, std::vector<double>& w, std::vector<double>& z) const;
+  }; // class CubicSplineWeights
+
   // Common-time functions
   std::vector<double> Intersection(const std::vector<double>& t1, const std::vector<double>& t2,
                                    const double MinStep=0.005, const double MinTime=-1e300, const double MaxTime=1e300);
   std::vector<double> Union(const std::vector<double>& t1, const std::vector<double>& t2, const double MinStep=0.005);
 
+  /// Contiguous, row-major 2-D array of doubles
+  class Array2D {
+    /// All the data are held in a single block, so an array with one
+    /// row per time step costs one allocation, rather than one per
+    /// row as with `std::vector<std::vector<double> >`.  Rows are
+    /// contiguous; elements of a column are separated by a stride of
+    /// `ncols()`.
+  private:
+    unsigned int nr, nc;
+    std::vector<double> d;
+  public:
+    Array2D() : nr(0), nc(0), d() { }
+    Array2D(const unsigned int rows, const unsigned int cols, const double a=0.0) : nr(rows), nc(cols), d(rows*cols, a) { }
+    Array2D(const std::vector<std::vector<double> >& DataIn);
+    inline unsigned int nrows() const { return nr; }
+    inline unsigned int ncols() const { return nc; }
+    inline unsigned int size() const { return d.size(); }
+    inline double operator()(const unsigned int row, const unsigned int col) const { return d[row*nc+col]; }
+    inline double& operator()(const unsigned int row, const unsigned int col) { return d[row*nc+col]; }
+    inline const double* operator[](const unsigned int row) const { return &d[row*nc]; }
+    inline double* operator[](const unsigned int row) { return &d[row*nc]; }
+    inline const std::vector<double>& Flat() const { return d; }
+    inline std::vector<double>& Flat() { return d; }
+    std::vector<double> Row(const unsigned int row) const;
+    std::vector<double> Column(const unsigned int col) const;
+    std::vector<std::vector<double> > Nested() const;
+    void resize(const unsigned int rows, const unsigned int cols, const double a=0.0);
+    void swap(Array2D& b);
+  }; // class Array2D
+
   /// 3x3 object wrapping GSL matrix; probably not needed directly
   class Matrix {
   private:
@@ -91,14 +142,23 @@ namespace GWFrames {
   std::vector<double> Eigenvalues(Matrix& M);
   std::vector<double> Eigenvectors(Matrix& M);
   std::vector<double> Eigensystem(Matrix& M);
+  void SymmetricEigensystem3(const double* M, double* Values, double* Vectors);
   double Determinant(Matrix& M);
 
   /// Rectangular array of complex data; probably not needed directly
   class MatrixC {
+    /// If the data are mapped from a file (see `mapfile`), they are
+    /// read-only and shared by all copies, so `detach` must be called
+    /// before writing to them; non-const access does not do so
+    /// implicitly.  Mutating code should call `detach` once, before
+    /// any parallel region that writes to the data.
   private:
+    struct Mapping { void* addr; std::size_t length; volatile int refcount; };
     int nn;
     int mm;
     std::complex<double> **v;
+    Mapping* mapping; // Non-NULL if the data are a read-only mmap of a file, shared among copies
+    void release();
   public:
     MatrixC();
     MatrixC(int n, int m);			// Zero-based array
@@ -107,6 +167,10 @@ namespace GWFrames {
     MatrixC(const std::vector<std::vector<std::complex<double> > >& DataIn);
     MatrixC(const MatrixC &rhs);		// Copy constructor
     MatrixC& operator=(const MatrixC &rhs);	//assignment
+    #if __cplusplus >= 201103L
+    MatrixC(MatrixC&& rhs) noexcept;  // Move constructor; takes the data of rhs
+    MatrixC& operator=(MatrixC&& rhs);  // Move assignment
+    #endif
     void swap(MatrixC& b);
     inline std::complex<double>* operator[](const int i) { return v[i]; }
     inline const std::complex<double>* operator[](const int i) const { return v[i]; }
@@ -116,8 +180,12 @@ namespace GWFrames {
     void resize(int newn, int newm); // resize (contents not preserved)
     // / \@endcond
     void assign(int newn, int newm, const std::complex<double> &a); // resize and assign a constant value
+    void mapfile(const std::string& FileName, const std::size_t offset, int newn, int newm); // read-only view of file data
+    void detach(); // copy mapped data into owned memory
+    inline bool ismapped() const { return mapping!=NULL; }
     ~MatrixC();
   };
+  MatrixC ComplexDerivative(const MatrixC& f, const std::vector<double>& t);
 
   std::ostream& operator<<(std::ostream& out, const std::vector<double>& v);
   std::ostream& operator<<(std::ostream& out, const std::vector<int>& v);
@@ -3,20 +3,26 @@
 
 #include <unistd.h>
 #include <sys/param.h>
+#include <sys/stat.h>
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
 #include <climits>
+#include <limits>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
 
-#include <sys/time.h>
 #include <ctime>
 
 #include <functional>
 #include <algorithm>
+#include <map>
 #include <complex>
+#include <utility>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_spline.h>
 #include <gsl/gsl_linalg.h>
@@ -28,11 +34,13 @@
 #pragma clang diagnostic pop
 #include "Waveforms.hpp"
 #include "Utilities.hpp"
+#include "SphericalTransforms.hpp"
 #include "Quaternions.hpp"
 #include "Quaternions/QuaternionUtilities.hpp"
 #include "IntegrateAngularVelocity.hpp"
 #include "SphericalFunctions/SWSHs.hpp"
 #include "Errors.hpp"
+#include "Instrumentation.hpp"
 
 using Quaternions::Quaternion;
 using Quaternions::QuaternionArray;
@@ -40,6 +48,7 @@ using GWFrames::Matrix;
 using SphericalFunctions::LadderOperatorFactorSingleton;
 using SphericalFunctions::Wigner3j;
 using GWFrames::abs;
+using GWFrames::SpinsfastWorkspaceLease;
 using Quaternions::PrescribedRotation;
 using Quaternions::FrameFromZ;
 using std::string;
@@ -68,6 +77,14 @@ const complex<double> ImaginaryI(0.0,1.0);
 
 const LadderOperatorFactorSingleton& LadderOperatorFactor = LadderOperatorFactorSingleton::Instance();
 
+#ifndef DOXYGEN
+namespace {
+  // Whether newly constructed Waveforms record their history; see
+  // `Waveform::SetRecordHistoryByDefault`
+  bool WaveformsRecordHistory = true;
+}
+#endif // DOXYGEN
+
 std::string tolower(const std::string& A) {
   string B = A;
   string::iterator it;
@@ -90,10 +107,11 @@ std::string StringForm(const std::vector<int>& Lmodes) {
 
 /// Default constructor for an empty object
 GWFrames::Waveform::Waveform() :
-  spinweight(-2), boostweight(-1), history(""), t(0),frame(0), frameType(GWFrames::UnknownFrameType),
+  spinweight(-2), boostweight(-1), history(""), recordHistory(WaveformsRecordHistory), t(0),frame(0), frameType(GWFrames::UnknownFrameType),
   dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), data()
 {
-  {
+  ResetHistoryStream();
+  if(recordHistory) {
     char path[MAXPATHLEN];
     char* result = getcwd(path, MAXPATHLEN);
     if(!result) {
@@ -106,7 +124,9 @@ GWFrames::Waveform::Waveform() :
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << endl
             << "# pwd = " << pwd << endl
             << "# hostname = " << hostname << endl
@@ -117,30 +137,68 @@ GWFrames::Waveform::Waveform() :
 
 /// Copy constructor
 GWFrames::Waveform::Waveform(const GWFrames::Waveform& a) :
-  spinweight(a.spinweight), boostweight(a.boostweight), history(a.history.str()), t(a.t), frame(a.frame), frameType(a.frameType),
-  dataType(a.dataType), rIsScaledOut(a.rIsScaledOut), mIsScaledOut(a.mIsScaledOut), lm(a.lm), data(a.data)
+  spinweight(a.spinweight), boostweight(a.boostweight), history(a.history.str()), recordHistory(a.recordHistory), t(a.t), frame(a.frame), frameType(a.frameType),
+  dataType(a.dataType), rIsScaledOut(a.rIsScaledOut), mIsScaledOut(a.mIsScaledOut), lm(a.lm), lmIndex(a.lmIndex), data(a.data)
 {
   /// Simply copies all fields in the input object to the constructed
   /// object, including history
-  history.seekp(0, ios_base::end);
+  ResetHistoryStream();
+}
+
+#if __cplusplus >= 201103L
+/// Move constructor
+GWFrames::Waveform::Waveform(GWFrames::Waveform&& a) noexcept :
+  spinweight(a.spinweight), boostweight(a.boostweight), history(std::move(a.history)), recordHistory(a.recordHistory), t(), frame(), frameType(a.frameType),
+  dataType(a.dataType), rIsScaledOut(a.rIsScaledOut), mIsScaledOut(a.mIsScaledOut), lm(), data()
+{
+  /// The history, time, frame, mode, and data arrays are taken from
+  /// the input object without being copied, leaving it empty.  This is used
+  /// automatically when a Waveform is returned by value (e.g., from
+  /// `Interpolate` or `operator+`), so chained expressions do not
+  /// copy the data at each step.
+  ResetHistoryStream();
+  t.swap(a.t);
+  frame.swap(a.frame);
+  lm.swap(a.lm);
+  lmIndex.swap(a.lmIndex);
+  data.swap(a.data);
 }
 
+/// Move assignment operator
+GWFrames::Waveform& GWFrames::Waveform::operator=(GWFrames::Waveform&& a) noexcept {
+  swap(a);
+  return *this;
+}
+#endif // __cplusplus >= 201103L
+
 /// Constructor from data file
 GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& DataFormat) :
-  spinweight(-2), boostweight(-1), history(""), t(0), frame(0), frameType(GWFrames::UnknownFrameType),
+  spinweight(-2), boostweight(-1), history(""), recordHistory(WaveformsRecordHistory), t(0), frame(0), frameType(GWFrames::UnknownFrameType),
   dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), data()
 {
   ///
   /// \param FileName Relative path to data file
-  /// \param DataFormat Either 'ReIm' or 'MagArg'
-  ///
-  /// NOTE: This function assumes that the data are stored as (ell,m)
-  /// modes, starting with (2,-2), incrementing m, then incrementing
-  /// ell and starting again at m=-ell.  If this is not how the modes
-  /// are stored, the 'lm' data of this object needs to be reset or
-  /// bad things will happen when trying to find the angular-momentum
-  /// vector or rotate the waveform.
-  {
+  /// \param DataFormat One of 'ReIm', 'MagArg', 'Binary', or 'MappedBinary'
+  ///
+  /// NOTE: For the text formats, this function assumes that the data
+  /// are stored as (ell,m) modes, starting with (2,-2), incrementing
+  /// m, then incrementing ell and starting again at m=-ell.  If this
+  /// is not how the modes are stored, the 'lm' data of this object
+  /// needs to be reset or bad things will happen when trying to find
+  /// the angular-momentum vector or rotate the waveform.
+  ///
+  /// The 'Binary' format is the one written by `OutputBinary`, and
+  /// stores all the information in the Waveform (including `lm`,
+  /// frame, and history), so no assumptions are needed.  It is read
+  /// directly into memory without any parsing, which is much faster
+  /// than the text formats for long waveforms.  The 'MappedBinary'
+  /// format reads the same files, but maps the mode data into memory
+  /// read-only instead of copying them; the data are copied only
+  /// when a function modifies them in place.  This is useful when scanning very many
+  /// waveforms without altering them.
+  GWFrames_INSTRUMENT_SCOPE("Waveform(FileName)");
+  ResetHistoryStream();
+  if(recordHistory) {
     char path[MAXPATHLEN];
     char* result = getcwd(path, MAXPATHLEN);
     if(!result) {
@@ -153,7 +211,9 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << endl
             << "# pwd = " << pwd << endl
             << "# hostname = " << hostname << endl
@@ -161,6 +221,12 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
             << "Waveform(" << FileName << ", " << DataFormat << "); // Constructor from data file" << endl;
   }
 
+  // The binary format is handled separately, with no text parsing
+  if(tolower(DataFormat).find("bin")!=string::npos) {
+    ReadBinary(FileName, tolower(DataFormat).find("map")!=string::npos);
+    return;
+  }
+
   // Get the number of lines in the file
   char LengthChar[9];
   FILE* fp = popen(("wc -l " + FileName).c_str(), "r");
@@ -260,6 +326,7 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
       }
     }
   }
+  IndexModes();
 }
 
 /// Assignment operator
@@ -267,8 +334,8 @@ GWFrames::Waveform& GWFrames::Waveform::operator=(const GWFrames::Waveform& a) {
   spinweight = a.spinweight;
   boostweight = a.boostweight;
   history.str(a.history.str());
-  history.clear();
-  history.seekp(0, ios_base::end);
+  recordHistory = a.recordHistory;
+  ResetHistoryStream();
   t = a.t;
   frame = a.frame;
   frameType = a.frameType;
@@ -276,6 +343,7 @@ GWFrames::Waveform& GWFrames::Waveform::operator=(const GWFrames::Waveform& a) {
   rIsScaledOut = a.rIsScaledOut;
   mIsScaledOut = a.mIsScaledOut;
   lm = a.lm;
+  lmIndex = a.lmIndex;
   data = a.data;
   return *this;
 }
@@ -286,8 +354,8 @@ GWFrames::Waveform GWFrames::Waveform::CopyWithoutData() const {
   that.spinweight = (*this).spinweight;
   that.boostweight = (*this).boostweight;
   that.history.str((*this).history.str());
-  that.history.clear();
-  that.history.seekp(0, ios_base::end);
+  that.recordHistory = (*this).recordHistory;
+  that.ResetHistoryStream();
   that.frameType = (*this).frameType;
   that.dataType = (*this).dataType;
   that.rIsScaledOut = (*this).rIsScaledOut;
@@ -325,6 +393,7 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndices(const unsigned int i_t
   Waveform Slice = this->CopyWithoutData();
   Slice.history << "this->SliceOfTimeIndices(" << i_t_a << ", " << i_t_b << ");" << std::endl;
   Slice.lm = lm;
+  Slice.lmIndex = lmIndex;
   const unsigned int ntimes = i_t_b-i_t_a;
   const unsigned int nmodes = NModes();
   Slice.data.resize(nmodes, ntimes);
@@ -384,6 +453,7 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndicesWithEll2(const unsigned
       Slice.data[m+2][i_t] = data[i_m][i_t+i_t_a];
     }
   }
+  Slice.IndexModes();
   if(frame.size() == NTimes()) {
     Slice.frame = vector<Quaternion>(frame.begin()+i_t_a, frame.begin()+i_t_b);
   } else if(frame.size()==1) {
@@ -414,6 +484,7 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndicesWithoutModes(const unsi
     i_t_b = i_t_a+1;
   }
   Slice.lm = vector<vector<int> >(0, vector<int>(2));
+  Slice.lmIndex.clear();
   const unsigned int ntimes = i_t_b-i_t_a;
   const unsigned int nmodes = 0;
   Slice.data.resize(nmodes, ntimes);
@@ -431,6 +502,161 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimesWithoutModes(const double t_a
   return this->SliceOfTimeIndicesWithoutModes(i_t_a, i_t_b);
 }
 
+/// Non-owning view of all times and modes of the Waveform
+GWFrames::WaveformView GWFrames::Waveform::View() const {
+  /// \sa WaveformView
+  vector<unsigned int> Modes(NModes());
+  for(unsigned int i_m=0; i_m<Modes.size(); ++i_m) {
+    Modes[i_m] = i_m;
+  }
+  return WaveformView(*this, 0, NTimes(), Modes);
+}
+
+/// Non-owning view of the Waveform between indices i_t_a and i_t_b
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimeIndices(const unsigned int i_t_a, unsigned int i_t_b) const {
+  ///
+  /// \param i_t_a Index of initial time
+  /// \param i_t_b Index just beyond final time
+  ///
+  /// This is the non-copying counterpart of `SliceOfTimeIndices`; the
+  /// arguments have the same meaning.
+  ///
+  /// \sa WaveformView
+  if(i_t_b==0) {
+    i_t_b = i_t_a+1;
+  }
+  vector<unsigned int> Modes(NModes());
+  for(unsigned int i_m=0; i_m<Modes.size(); ++i_m) {
+    Modes[i_m] = i_m;
+  }
+  std::stringstream Description;
+  Description << "ViewOfTimeIndices(" << i_t_a << ", " << i_t_b << ")";
+  return WaveformView(*this, i_t_a, i_t_b, Modes, Description.str());
+}
+
+/// Non-owning view of the Waveform between t_a and t_b
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimes(const double t_a, const double t_b) const {
+  const unsigned int i_t_a = Quaternions::hunt(t, t_a);
+  const unsigned int i_t_b = Quaternions::huntRight(t, t_b, i_t_a);
+  return this->ViewOfTimeIndices(i_t_a, i_t_b);
+}
+
+/// Non-owning view of the Waveform between indices i_t_a and i_t_b, only ell=2 modes
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimeIndicesWithEll2(const unsigned int i_t_a, unsigned int i_t_b) const {
+  /// The modes are ordered as (2,-2), ..., (2,2), as in
+  /// `SliceOfTimeIndicesWithEll2`.
+  if(i_t_b==0) {
+    i_t_b = i_t_a+1;
+  }
+  vector<unsigned int> Modes(5);
+  for(int m=-2; m<3; ++m) {
+    Modes[m+2] = FindModeIndex(2, m);
+  }
+  std::stringstream Description;
+  Description << "ViewOfTimeIndicesWithEll2(" << i_t_a << ", " << i_t_b << ")";
+  return WaveformView(*this, i_t_a, i_t_b, Modes, Description.str());
+}
+
+/// Non-owning view of the Waveform between t_a and t_b, only ell=2 modes
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimesWithEll2(const double t_a, const double t_b) const {
+  const unsigned int i_t_a = Quaternions::hunt(t, t_a);
+  const unsigned int i_t_b = Quaternions::huntRight(t, t_b, i_t_a);
+  return this->ViewOfTimeIndicesWithEll2(i_t_a, i_t_b);
+}
+
+/// Non-owning view of the Waveform between indices i_t_a and i_t_b without mode data
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimeIndicesWithoutModes(const unsigned int i_t_a, unsigned int i_t_b) const {
+  if(i_t_b==0) {
+    i_t_b = i_t_a+1;
+  }
+  std::stringstream Description;
+  Description << "ViewOfTimeIndicesWithoutModes(" << i_t_a << ", " << i_t_b << ")";
+  return WaveformView(*this, i_t_a, i_t_b, vector<unsigned int>(0), Description.str());
+}
+
+/// Non-owning view of the Waveform between t_a and t_b without mode data
+GWFrames::WaveformView GWFrames::Waveform::ViewOfTimesWithoutModes(const double t_a, const double t_b) const {
+  const unsigned int i_t_a = Quaternions::hunt(t, t_a);
+  const unsigned int i_t_b = Quaternions::huntRight(t, t_b, i_t_a);
+  return this->ViewOfTimeIndicesWithoutModes(i_t_a, i_t_b);
+}
+
+
+/// Construct a view of the given range of times and modes of a Waveform
+GWFrames::WaveformView::WaveformView(const GWFrames::Waveform& Parent, const unsigned int I_t_a, const unsigned int I_t_b,
+                                     const std::vector<unsigned int>& Modes, const std::string& Description)
+  : W(&Parent), i_t_a(I_t_a), i_t_b(I_t_b), modes(Modes), description(Description)
+{
+  ///
+  /// \param Parent Waveform whose data will be viewed
+  /// \param I_t_a Index of initial time
+  /// \param I_t_b Index just beyond final time
+  /// \param Modes Indices (in `Parent`) of the modes to include, in order
+  /// \param Description Optional string used to describe the view in histories
+  ///
+  /// Usually, views will be obtained from `Waveform::View`,
+  /// `Waveform::ViewOfTimeIndices`, and similar functions.
+  ///
+  if(i_t_a>i_t_b) {
+    INFOTOCERR << ": Requesting impossible view"
+               << "\ni_t_a=" << i_t_a << "  >  i_t_b=" << i_t_b << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  if(i_t_b>W->NTimes()) {
+    INFOTOCERR << ": Requesting impossible view"
+               << "\ni_t_b=" << i_t_b << "  >  NTimes()=" << W->NTimes() << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  for(unsigned int i_m=0; i_m<modes.size(); ++i_m) {
+    if(modes[i_m]>=W->NModes()) {
+      INFOTOCERR << ": Requesting impossible view"
+                 << "\nModes[" << i_m << "]=" << modes[i_m] << "  >=  NModes()=" << W->NModes() << std::endl;
+      throw(GWFrames_IndexOutOfBounds);
+    }
+  }
+}
+
+// The string with which to begin history lines for this view
+std::string GWFrames::WaveformView::HistoryPrefix() const {
+  if(description.empty()) {
+    return "this->";
+  }
+  return "this->" + description + ".";
+}
+
+/// Copy of the times in the view
+std::vector<double> GWFrames::WaveformView::T() const {
+  return vector<double>(W->t.begin()+i_t_a, W->t.begin()+i_t_b);
+}
+
+/// Independent Waveform holding a copy of the viewed data
+GWFrames::Waveform GWFrames::WaveformView::Copy() const {
+  /// This is equivalent to the corresponding `Waveform::SliceOf...`
+  /// function, except for the history.
+  Waveform Slice = W->CopyWithoutData();
+  Slice.history << HistoryPrefix() << "Copy();" << std::endl;
+  const unsigned int ntimes = NTimes();
+  const unsigned int nmodes = NModes();
+  Slice.lm.resize(nmodes);
+  Slice.data.resize(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    Slice.lm[i_m] = LM(i_m);
+    const complex<double>* Data = (*this)(i_m);
+    std::copy(Data, Data+ntimes, Slice.data[i_m]);
+  }
+  Slice.IndexModes();
+  if(W->frame.size() == W->NTimes()) {
+    Slice.frame = vector<Quaternion>(W->frame.begin()+i_t_a, W->frame.begin()+i_t_b);
+  } else if(W->frame.size()==1) {
+    Slice.frame = W->frame;
+  } else if(W->frame.size()!=0) {
+    INFOTOCERR << " I don't understand what to do with frame data of length " << W->frame.size() << " in a Waveform with " << W->NTimes() << " times." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  Slice.t = T();
+  return Slice;
+}
+
 /// Remove all data relating to times outside of the given range
 GWFrames::Waveform& GWFrames::Waveform::DropTimesOutside(const double t_a, const double t_b) {
   history << "this->DropTimesOutside(" << t_a << ", " << t_b << ");" << std::endl;
@@ -470,6 +696,7 @@ GWFrames::Waveform& GWFrames::Waveform::DropEllModes(const std::vector<unsigned
     }
   }
   lm = newlm;
+  IndexModes();
   vector<vector<complex<double> > > NewData(IndicesToKeep.size(), vector<complex<double> >(NTimes()));
   for(unsigned int i_m=0; i_m<IndicesToKeep.size(); ++i_m) {
     NewData[i_m] = Data(IndicesToKeep[i_m]);
@@ -497,6 +724,7 @@ GWFrames::Waveform& GWFrames::Waveform::KeepOnlyEllModes(const std::vector<unsig
     }
   }
   lm = newlm;
+  IndexModes();
   vector<vector<complex<double> > > NewData(IndicesToKeep.size(), vector<complex<double> >(NTimes()));
   for(unsigned int i_m=0; i_m<IndicesToKeep.size(); ++i_m) {
     NewData[i_m] = Data(IndicesToKeep[i_m]);
@@ -521,9 +749,14 @@ void GWFrames::Waveform::swap(GWFrames::Waveform& b) {
   // because the histories are swapped
   { const int NewSpinWeight=b.spinweight; b.spinweight=spinweight; spinweight=NewSpinWeight; }
   { const int NewBoostWeight=b.boostweight; b.boostweight=boostweight; boostweight=NewBoostWeight; }
+  #if __cplusplus >= 201103L
+  history.swap(b.history);
+  #else
   { const string historyb=b.history.str(); b.history.str(history.str()); history.str(historyb); }
-  history.seekp(0, ios_base::end);
-  b.history.seekp(0, ios_base::end);
+  #endif
+  { const bool brecordHistory=b.recordHistory; b.recordHistory=recordHistory; recordHistory=brecordHistory; }
+  ResetHistoryStream();
+  b.ResetHistoryStream();
   t.swap(b.t);
   frame.swap(b.frame);
   { const GWFrames::WaveformFrameType bType=b.frameType; b.frameType=frameType; frameType=bType; }
@@ -531,18 +764,81 @@ void GWFrames::Waveform::swap(GWFrames::Waveform& b) {
   { const bool brIsScaledOut=b.rIsScaledOut; b.rIsScaledOut=rIsScaledOut; rIsScaledOut=brIsScaledOut; }
   { const bool bmIsScaledOut=b.mIsScaledOut; b.mIsScaledOut=mIsScaledOut; mIsScaledOut=bmIsScaledOut; }
   lm.swap(b.lm);
+  lmIndex.swap(b.lmIndex);
   data.swap(b.data);
   return;
 }
 
+/// Prepare the `history` stream for writing, according to `recordHistory`
+void GWFrames::Waveform::ResetHistoryStream() {
+  /// When history is being recorded, this clears any error state and
+  /// moves the put pointer to the end of the existing history.  When
+  /// it is not, the history is emptied and the stream is put into a
+  /// failed state, so that every subsequent `history << ...` returns
+  /// immediately without formatting or allocating anything.
+  if(recordHistory) {
+    history.clear();
+    history.seekp(0, ios_base::end);
+  } else {
+    history.str("");
+    history.setstate(ios_base::badbit);
+  }
+}
+
+/// Turn recording of this Waveform's history on or off
+GWFrames::Waveform& GWFrames::Waveform::SetRecordHistory(const bool Record) {
+  ///
+  /// \param Record If false, the existing history is discarded
+  ///
+  /// Every operation on a Waveform normally appends a line to its
+  /// history, and copies duplicate the whole history.  For temporary
+  /// objects used in inner loops (e.g., alignment scans or batches of
+  /// comparisons) this is needless work, and can be turned off with
+  /// this function.  The waveforms derived from this one (copies,
+  /// slices, interpolations, etc.) inherit the setting.  If recording
+  /// is turned back on, the history starts again with a note that
+  /// earlier steps were not recorded.
+  ///
+  /// \sa SetRecordHistoryByDefault
+  ///
+  if(Record==recordHistory) { return *this; }
+  recordHistory = Record;
+  ResetHistoryStream();
+  if(recordHistory) {
+    history << "# [History was not recorded before this point]" << endl;
+  }
+  return *this;
+}
+
+/// Set whether newly constructed Waveforms record their history
+void GWFrames::Waveform::SetRecordHistoryByDefault(const bool Record) {
+  /// This affects Waveforms constructed from scratch after the call
+  /// (which also skips looking up the working directory, host name,
+  /// and date for their headers); copies always take the setting of
+  /// the original.  The default is to record history.  This is a
+  /// global setting, and is not synchronized, so it should be changed
+  /// only when no other threads are constructing Waveforms.
+  ///
+  /// \sa SetRecordHistory
+  ///
+  WaveformsRecordHistory = Record;
+}
+
+/// Return true if newly constructed Waveforms record their history
+bool GWFrames::Waveform::RecordHistoryByDefault() {
+  return WaveformsRecordHistory;
+}
+
 
 /// Explicit constructor from data
 GWFrames::Waveform::Waveform(const std::vector<double>& T, const std::vector<std::vector<int> >& LM,
                              const std::vector<std::vector<std::complex<double> > >& Data)
-  : spinweight(-2), boostweight(-1), history(""), t(T), frame(), frameType(GWFrames::UnknownFrameType),
+  : spinweight(-2), boostweight(-1), history(""), recordHistory(WaveformsRecordHistory), t(T), frame(), frameType(GWFrames::UnknownFrameType),
     dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(LM), data(Data)
 {
   /// Arguments are T, LM, Data, which consist of the explicit data.
+  ResetHistoryStream();
+  IndexModes();
 
   // Check that dimensions match (though this is not an exhaustive check)
   if( Data.size()!=0 && ( (t.size() != Data[0].size()) || (Data.size() != lm.size()) ) ) {
@@ -572,11 +868,7 @@ GWFrames::Waveform& GWFrames::Waveform::Differentiate() {
     throw(GWFrames_NotYetImplemented);
   }
 
-  vector<vector<complex<double> > > NewData(NModes(), vector<complex<double> >(NTimes()));
-  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-    NewData[i_m] = DataDot(i_m);
-  }
-  data = MatrixC(NewData);
+  data = GWFrames::ComplexDerivative(data, t);
 
   boostweight -= 1;
   if(dataType == GWFrames::h) { dataType = GWFrames::hdot; }
@@ -604,13 +896,29 @@ std::vector<double> GWFrames::Waveform::Norm(const bool TakeSquareRoot) const {
   ///
   /// \sa MaxNormIndex
   /// \sa MaxNormTime
+  /// \sa WaveformView::Norm
   ///
-  vector<double> norm(NTimes(), 0.0);
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-      norm[i_t] += std::norm(Data(i_m, i_t));
+  return View().Norm(TakeSquareRoot);
+}
+
+/// Return the norm (sum of squares of modes) of the viewed data
+std::vector<double> GWFrames::WaveformView::Norm(const bool TakeSquareRoot) const {
+  ///
+  /// \param TakeSquareRoot If true, the square root is taken at each instant before returning
+  ///
+  /// \sa Waveform::Norm
+  ///
+  const unsigned int NT = NTimes();
+  const unsigned int NM = NModes();
+  vector<double> norm(NT, 0.0);
+  for(unsigned int i_m=0; i_m<NM; ++i_m) {
+    const complex<double>* Data = (*this)(i_m);
+    for(unsigned int i_t=0; i_t<NT; ++i_t) {
+      norm[i_t] += std::norm(Data[i_t]);
     }
-    if(TakeSquareRoot) {
+  }
+  if(TakeSquareRoot) {
+    for(unsigned int i_t=0; i_t<NT; ++i_t) {
       norm[i_t] = std::sqrt(norm[i_t]);
     }
   }
@@ -777,6 +1085,89 @@ std::vector<std::vector<double> > GWFrames::Waveform::ArgUnwrapped() const {
   return uarg;
 }
 
+/// Return contiguous array of real parts of all modes as function of time.
+GWFrames::Array2D GWFrames::Waveform::ReArray() const {
+  ///
+  /// The result has one row per mode and one column per time step,
+  /// like `Re()`, but is stored in a single contiguous block.
+  const unsigned int nmodes = NModes();
+  const unsigned int ntimes = NTimes();
+  GWFrames::Array2D re(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    const std::complex<double>* D = data[i_m];
+    double* r = re[i_m];
+    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+      r[i_t] = std::real(D[i_t]);
+    }
+  }
+  return re;
+}
+
+/// Return contiguous array of imaginary parts of all modes as function of time.
+GWFrames::Array2D GWFrames::Waveform::ImArray() const {
+  ///
+  /// \sa ReArray
+  const unsigned int nmodes = NModes();
+  const unsigned int ntimes = NTimes();
+  GWFrames::Array2D im(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    const std::complex<double>* D = data[i_m];
+    double* r = im[i_m];
+    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+      r[i_t] = std::imag(D[i_t]);
+    }
+  }
+  return im;
+}
+
+/// Return contiguous array of absolute value of all modes as function of time.
+GWFrames::Array2D GWFrames::Waveform::AbsArray() const {
+  ///
+  /// \sa ReArray
+  const unsigned int nmodes = NModes();
+  const unsigned int ntimes = NTimes();
+  GWFrames::Array2D abs(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    const std::complex<double>* D = data[i_m];
+    double* r = abs[i_m];
+    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+      r[i_t] = std::abs(D[i_t]);
+    }
+  }
+  return abs;
+}
+
+/// Return contiguous array of arg of all modes as function of time.
+GWFrames::Array2D GWFrames::Waveform::ArgArray() const {
+  ///
+  /// \sa ReArray
+  const unsigned int nmodes = NModes();
+  const unsigned int ntimes = NTimes();
+  GWFrames::Array2D arg(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    const std::complex<double>* D = data[i_m];
+    double* r = arg[i_m];
+    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+      r[i_t] = std::arg(D[i_t]);
+    }
+  }
+  return arg;
+}
+
+/// Return contiguous array of unwrapped arg of all modes as function of time.
+GWFrames::Array2D GWFrames::Waveform::ArgUnwrappedArray() const {
+  ///
+  /// \sa ReArray
+  const unsigned int nmodes = NModes();
+  const unsigned int ntimes = NTimes();
+  GWFrames::Array2D uarg(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    const vector<double> u = ArgUnwrapped(i_m);
+    std::copy(u.begin(), u.end(), uarg[i_m]);
+  }
+  return uarg;
+}
+
 /// Return vector of vector of complex data of all modes as function of time.
 std::vector<std::vector<std::complex<double> > > GWFrames::Waveform::Data() const {
   const unsigned int nmodes = NModes();
@@ -790,6 +1181,25 @@ std::vector<std::vector<std::complex<double> > > GWFrames::Waveform::Data() cons
   return dat;
 }
 
+/// Copy mode data from a contiguous array
+GWFrames::Waveform& GWFrames::Waveform::SetData(const std::complex<double>* Data, const int NModes, const int NTimes) {
+  ///
+  /// \param Data Pointer to `NModes*NTimes` values, mode by mode (row-major)
+  /// \param NModes Number of modes
+  /// \param NTimes Number of time steps
+  ///
+  /// This is the layout of a C-ordered (NModes, NTimes) `complex128`
+  /// numpy array, and of the data storage itself, so the values are
+  /// copied in a single pass rather than element by element through
+  /// nested vectors.  The `lm` and `t` data should be set to match.
+  ///
+  data.resize(NModes, NTimes);
+  if(NModes>0 && NTimes>0) {
+    std::copy(Data, Data+NModes*NTimes, data[0]);
+  }
+  return *this;
+}
+
 
 /// Return greatest ell value present in the data.
 int GWFrames::Waveform::EllMax() const {
@@ -800,16 +1210,30 @@ int GWFrames::Waveform::EllMax() const {
   return ell;
 }
 
+/// Rebuild the (ell,m) lookup table used by `FindModeIndex`
+void GWFrames::Waveform::IndexModes() {
+  /// This must be called whenever `lm` is changed.  The table has an
+  /// entry for every (ell,m) up to the largest ell present, so a mode
+  /// can be found with a single load regardless of the order of the
+  /// modes.  If a mode appears more than once, the first is found.
+  int ellMax = -1;
+  for(unsigned int i_m=0; i_m<lm.size(); ++i_m) {
+    ellMax = std::max(ellMax, lm[i_m][0]);
+  }
+  lmIndex.assign((ellMax+1)*(ellMax+1), -1);
+  for(unsigned int i_m=0; i_m<lm.size(); ++i_m) {
+    const int ell = lm[i_m][0];
+    const int m = lm[i_m][1];
+    if(ell>=0 && std::abs(m)<=ell && lmIndex[ell*(ell+1)+m]<0) {
+      lmIndex[ell*(ell+1)+m] = i_m;
+    }
+  }
+}
+
 /// Find index of mode with given (l,m) data.
 unsigned int GWFrames::Waveform::FindModeIndex(const int l, const int m) const {
-  const unsigned int i_expected = l*(l+1) + m - SpinWeight()*SpinWeight();
-  if (lm.size() > i_expected) {
-    if(lm[i_expected][0]==l && lm[i_expected][1]==m) { return i_expected; }
-  }
-  //ORIENTATION!!! following loop
-  for(unsigned int i=0; i<NModes(); ++i) {
-    if(lm[i][0]==l && lm[i][1]==m) { return i; }
-  }
+  const unsigned int i = FindModeIndexWithoutError(l, m);
+  if(i<NModes()) { return i; }
   INFOTOCERR << " Can't find (ell,m)=(" << l << ", " << m << ")" << endl;
   throw(GWFrames_WaveformMissingLMIndex);
 }
@@ -818,11 +1242,21 @@ unsigned int GWFrames::Waveform::FindModeIndex(const int l, const int m) const {
 unsigned int GWFrames::Waveform::FindModeIndexWithoutError(const int l, const int m) const {
   /// If the requested mode is not present, the returned index is 1
   /// beyond the end of the mode vector.
-  const unsigned int i_expected = l*(l+1) + m - SpinWeight()*SpinWeight();
-  if(lm[i_expected][0]==l && lm[i_expected][1]==m) { return i_expected; }
+  ///
+  /// The index is looked up in a table kept up to date with `lm`.
+  /// The entry is checked against `lm`, and if it does not match (or
+  /// the mode is not in the table) the modes are searched in order,
+  /// so the result is correct even if `lm` has been altered directly.
+  if(l>=0 && std::abs(m)<=l) {
+    const unsigned int i_lm = l*(l+1)+m;
+    if(i_lm<lmIndex.size()) {
+      const int i = lmIndex[i_lm];
+      if(i>=0 && static_cast<unsigned int>(i)<lm.size() && lm[i][0]==l && lm[i][1]==m) { return i; }
+    }
+  }
   // ORIENTATION!!! following loop
   unsigned int i=0;
-  for(; i<NModes(); ++i) {
+  for(; i<lm.size(); ++i) {
     if(lm[i][0]==l && lm[i][1]==m) { return i; }
   }
   ++i;
@@ -879,6 +1313,14 @@ std::vector<double> GWFrames::Waveform::NormalizedAntisymmetry(std::vector<int>
 
 /// Evaluate the dipole moment of the waveform
 std::vector<std::vector<double> > GWFrames::Waveform::DipoleMoment(int ellMax) const {
+  /// \param ellMax Maximum ell mode to include [default: all]
+  ///
+  /// \sa DipoleMomentArray
+  return DipoleMomentArray(ellMax).Nested();
+}
+
+/// Evaluate the dipole moment of the waveform, as a contiguous NTimes x 3 array
+GWFrames::Array2D GWFrames::Waveform::DipoleMomentArray(int ellMax) const {
   /// \param ellMax Maximum ell mode to include [default: all]
   ///
   /// This function evaluates the dipole moment of the waveform's
@@ -891,7 +1333,7 @@ std::vector<std::vector<double> > GWFrames::Waveform::DipoleMoment(int ellMax) c
     ellMax = EllMax();
   }
 
-  vector<vector<double> > D(NTimes(), vector<double>(3));
+  GWFrames::Array2D D(NTimes(), 3);
   vector<complex<double> > d(3);
 
   for(int i_t=0; i_t<NTimes(); ++i_t) {
@@ -936,9 +1378,9 @@ std::vector<std::vector<double> > GWFrames::Waveform::DipoleMoment(int ellMax) c
         }
       }
     }
-    D[i_t][0] = d[0].real();
-    D[i_t][1] = d[1].real();
-    D[i_t][2] = d[2].real();
+    D(i_t,0) = d[0].real();
+    D(i_t,1) = d[1].real();
+    D(i_t,2) = d[2].real();
   }
 
   return D;
@@ -977,6 +1419,7 @@ GWFrames::Waveform GWFrames::Waveform::Involution(WaveformInvolutionFunction WIn
     B.frame[i] = QInvol(A.frame[i]);
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1002,6 +1445,7 @@ GWFrames::Waveform GWFrames::Waveform::InvolutionSymmetricPart(WaveformInvolutio
     B.frame[i] = 0.5 * ( A.frame[i] +  QInvol(A.frame[i]) );
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1027,6 +1471,7 @@ GWFrames::Waveform GWFrames::Waveform::InvolutionAntisymmetricPart(WaveformInvol
     B.frame[i] = 0.5 * ( A.frame[i] -  QInvol(A.frame[i]) );
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1070,6 +1515,7 @@ public:
     min_func.n = 2;
     min_func.f = &minfunc_MinimalParityViolation;
     min_func.params = (void*) this;
+    W.SetRecordHistory(false); // Only an internal scratch object, copied for every evaluation
     R_last = Quaternions::sqrtOfRotor(-Quaternions::zHat*Quaternions::Quaternion(W.LLDominantEigenvector()[0]));
     s = gsl_multimin_fminimizer_alloc(gsl_multimin_fminimizer_nmsimplex2, min_func.n);
     ss = gsl_vector_alloc(min_func.n);
@@ -1081,7 +1527,8 @@ public:
     gsl_multimin_fminimizer_free(s);
   }
   double EvaluateMinimizationQuantity(const double deltax, const double deltay) const {
-    const GWFrames::Waveform W2 = GWFrames::Waveform(W).RotateDecompositionBasis(Quaternions::exp(Quaternions::Quaternion(0.0,deltax,deltay,0.0)));
+    GWFrames::Waveform W2(W);
+    W2.RotateDecompositionBasis(Quaternions::exp(Quaternions::Quaternion(0.0,deltax,deltay,0.0)));
     return W2.ZParityViolationSquared()[0];
   }
   double Minimize(const unsigned int i, const int direction) {
@@ -1098,7 +1545,8 @@ public:
     default:
       throw(GWFrames_ValueError);
     }
-    W = Win.SliceOfTimeIndices(i);
+    { GWFrames::Waveform Slice = Win.SliceOfTimeIndices(i); W.swap(Slice); }
+    W.SetRecordHistory(false);
     W.RotateDecompositionBasis(R_last);
     const unsigned int MaxIterations = 2000;
     const double MinSimplexSize = 1.0e-8;
@@ -1175,6 +1623,109 @@ std::vector<double> GWFrames::Waveform::MinimalParityViolation() const {
   return violations;
 }
 
+/// Compute the norm and all parity diagnostics in a single pass over the data
+GWFrames::WaveformParityDiagnostics GWFrames::Waveform::ParityDiagnostics(std::vector<int> Lmodes) const {
+  /// \param Lmodes \f$\ell\f$ modes to use when calculating the violations and antisymmetry
+  ///
+  /// The members of the returned object are equal (up to roundoff) to
+  /// the results of `Norm()`, `XParityViolationNormalized(Lmodes)`,
+  /// `YParityViolationNormalized(Lmodes)`,
+  /// `ZParityViolationNormalized(Lmodes)`,
+  /// `ParityViolationNormalized(Lmodes)`, and
+  /// `NormalizedAntisymmetry(Lmodes)`.  But the data are read only
+  /// once, in blocks of time steps that are handled in parallel, and
+  /// no intermediate Waveforms are constructed, so this is much
+  /// faster than calling each of those functions.
+  ///
+  /// \sa MinimalParityViolation
+
+  // The modes entering the violations, and the sign with which the
+  // conjugate of the (ell,-m) mode enters the z-parity and parity
+  // violations, are found before touching the data
+  vector<unsigned int> ModeIndices, ConjugateModeIndices;
+  vector<double> ZSigns, XSigns, PSigns;
+  vector<bool> UseForNorm2(NModes(), false), UseForAsymmetry;
+  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
+    UseForNorm2[i_m] = (lm[i_m][0]>=2);
+  }
+  const int ellMax = EllMax();
+  for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    if(Lmodes.size()==0 || GWFrames::xINy(ell,Lmodes)) {
+      for(int m=-ell; m<=ell; ++m) {
+        ModeIndices.push_back(FindModeIndex(ell,m));
+        ConjugateModeIndices.push_back(FindModeIndex(ell,-m));
+        XSigns.push_back((m%2)==0 ? 1.0 : -1.0);
+        ZSigns.push_back((ell%2)==0 ? 1.0 : -1.0);
+        PSigns.push_back(((ell+m)%2)==0 ? 1.0 : -1.0);
+        UseForAsymmetry.push_back(ell>=2);
+      }
+    }
+  }
+
+  const int ntimes = NTimes();
+  const int nmodes = NModes();
+  const int npairs = ModeIndices.size();
+  WaveformParityDiagnostics D;
+  D.Norm.assign(ntimes, 0.0);
+  D.XParityViolationNormalized.assign(ntimes, 0.0);
+  D.YParityViolationNormalized.assign(ntimes, 0.0);
+  D.ZParityViolationNormalized.assign(ntimes, 0.0);
+  D.ParityViolationNormalized.assign(ntimes, 0.0);
+  D.NormalizedAntisymmetry.assign(ntimes, 0.0);
+
+  const int BlockSize = 1024;
+  const int NBlocks = (ntimes+BlockSize-1)/BlockSize;
+  #pragma omp parallel
+  {
+    vector<double> Norm2(BlockSize);
+    #pragma omp for schedule(static)
+    for(int i_block=0; i_block<NBlocks; ++i_block) {
+      const int i_t_a = i_block*BlockSize;
+      const int i_t_b = std::min(ntimes, i_t_a+BlockSize);
+      double* Norm = &D.Norm[0];
+      double* X = &D.XParityViolationNormalized[0];
+      double* Y = &D.YParityViolationNormalized[0];
+      double* Z = &D.ZParityViolationNormalized[0];
+      double* P = &D.ParityViolationNormalized[0];
+      double* A = &D.NormalizedAntisymmetry[0];
+      std::fill(Norm2.begin(), Norm2.end(), 0.0);
+      for(int i_m=0; i_m<nmodes; ++i_m) {
+        const complex<double>* h = data[i_m];
+        for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+          const double n = std::norm(h[i_t]);
+          Norm[i_t] += n;
+          if(UseForNorm2[i_m]) { Norm2[i_t-i_t_a] += n; }
+        }
+      }
+      for(int i_pair=0; i_pair<npairs; ++i_pair) {
+        const complex<double>* h = data[ModeIndices[i_pair]];
+        const complex<double>* hm = data[ConjugateModeIndices[i_pair]];
+        const double XSign = XSigns[i_pair], ZSign = ZSigns[i_pair], PSign = PSigns[i_pair];
+        const bool Asymmetry = UseForAsymmetry[i_pair];
+        for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+          const complex<double> hbar = std::conj(h[i_t]);
+          const complex<double> hmbar = std::conj(hm[i_t]);
+          X[i_t] += std::norm(h[i_t] - XSign*hbar);
+          Y[i_t] += std::norm(h[i_t] - hbar);
+          Z[i_t] += std::norm(h[i_t] - ZSign*hmbar);
+          const double p = std::norm(h[i_t] - PSign*hmbar);
+          P[i_t] += p;
+          if(Asymmetry) { A[i_t] += p; }
+        }
+      }
+      for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+        // Each violation is 1/4 of the sum accumulated above
+        X[i_t] = std::sqrt(0.25*X[i_t]/Norm[i_t]);
+        Y[i_t] = std::sqrt(0.25*Y[i_t]/Norm[i_t]);
+        Z[i_t] = std::sqrt(0.25*Z[i_t]/Norm[i_t]);
+        P[i_t] = std::sqrt(0.25*P[i_t]/Norm[i_t]);
+        A[i_t] = std::sqrt(A[i_t]/(4*Norm2[i_t-i_t_a]));
+      }
+    }
+  }
+
+  return D;
+}
 
 /// Rotate the physical content of the Waveform by a constant rotor.
 GWFrames::Waveform& GWFrames::Waveform::RotatePhysicalSystem(const Quaternions::Quaternion& R_phys) {
@@ -1327,6 +1878,7 @@ GWFrames::Waveform& GWFrames::Waveform::TransformModesToRotatedFrame(const std::
   /// does not adjust the `frameType`, which is left to the calling
   /// functions.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::TransformModesToRotatedFrame");
 
   const int NModes = this->NModes();
   const int NTimes = this->NTimes();
@@ -1336,105 +1888,191 @@ GWFrames::Waveform& GWFrames::Waveform::TransformModesToRotatedFrame(const std::
     throw(GWFrames_VectorSizeMismatch);
   }
 
-  // Loop through each mode and do the rotation
+  // Find the mode indices for each l.  Use a vector of mode indices,
+  // in case the modes are out of order.  This still assumes that we
+  // have each l from l=2 up to some l_max, but it's better than
+  // assuming that, plus assuming that everything is in order.
+  vector<int> Ls;
+  vector<vector<unsigned int> > ModeIndices;
   {
     int mode=1;
     for(int l=std::abs(SpinWeight()); l<NModes; ++l) {
       if(NModes<mode) { break; }
-
-      // Use a vector of mode indices, in case the modes are out of
-      // order.  This still assumes that we have each l from l=2 up to
-      // some l_max, but it's better than assuming that, plus assuming
-      // that everything is in order.
-      vector<unsigned int> ModeIndices(2*l+1);
+      ModeIndices.push_back(vector<unsigned int>(2*l+1));
+      Ls.push_back(l);
       for(int m=-l, i=0; m<=l; ++m, ++i) {
         try {
-          ModeIndices[i] = FindModeIndex(l, m);
+          ModeIndices.back()[i] = FindModeIndex(l, m);
         } catch(int thrown) {
           cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Incomplete mode information in Waveform; cannot rotate." << endl;
           throw(thrown);
         }
       }
-
-      {
-
-        // Construct the D matrix and data storage
-        SphericalFunctions::WignerDMatrix D(R_frame[0]);
-        vector<vector<complex<double> > > Ds(2*l+1, vector<complex<double> >(2*l+1));
-        vector<complex<double> > Data(2*l+1);
-
-        if(R_frame.size()==1) {
-          // Get the Wigner D matrix data just once
-          for(int m=-l; m<=l; ++m) {
-            for(int mp=-l; mp<=l; ++mp) {
-              Ds[mp+l][m+l] = D(l,mp,m);
-            }
-          }
-          // Loop through each time step
-          for(int t=0; t<NTimes; ++t) {
-            // Store the data for all m' modes at this time step
-            for(int mp=-l, i=0; mp<=l; ++mp, ++i) {
-              Data[mp+l] = this->operator()(ModeIndices[i], t);
-            }
-            // Compute the data at this time step for each m
-            for(int m=-l, i=0; m<=l; ++m, ++i) {
-              data[ModeIndices[i]][t] = 0.0;
-              for(int mp=-l; mp<=l; ++mp) { // Sum over m'
-                data[ModeIndices[i]][t] += Ds[mp+l][m+l]*Data[mp+l];
-              }
-            }
-          }
-        } else {
-          // Loop through each time step
-          for(int t=0; t<NTimes; ++t) {
-            // Get the Wigner D matrix data at this time step
-            D.SetRotation(R_frame[t]);
+      mode += 2*l+1;
+    }
+  }
+  const int NLs = Ls.size();
+  if(NLs==0) { return *this; }
+  const int lMax = Ls.back();
+  const bool ConstantRotation = (R_frame.size()==1);
+
+  // Make sure the data are owned (not mapped) before threads write to
+  // them, and that the singletons used by WignerDMatrix are
+  // constructed before any threads need them
+  data.detach();
+  { SphericalFunctions::WignerDMatrix D(R_frame[0]); }
+
+  // The work is done on blocks of TimeBlockSize time steps at a time.
+  // The input data for each block are copied (contiguously in time,
+  // with real and imaginary parts split) into a small buffer, so that
+  // the innermost loops are simple multiply-adds over the time steps
+  // of the block, which the compiler can vectorize.  Each thread gets
+  // its own D matrix and buffers; the result for each time step does
+  // not depend on which thread computes it, so this is identical to
+  // the serial result.
+  const int TimeBlockSize = 32;
+  const int NBlocks = (NTimes+TimeBlockSize-1)/TimeBlockSize;
+  #pragma omp parallel
+  {
+    SphericalFunctions::WignerDMatrix D(R_frame[0]);
+    const int NmMax = 2*lMax+1;
+    // D elements, indexed as [(m*(2l+1)+mp)*TimeBlockSize + tt]
+    vector<double> DRe(NmMax*NmMax*TimeBlockSize), DIm(NmMax*NmMax*TimeBlockSize);
+    // Input and output data, indexed as [mp*TimeBlockSize + tt]
+    vector<double> InRe(NmMax*TimeBlockSize), InIm(NmMax*TimeBlockSize);
+    vector<double> OutRe(TimeBlockSize), OutIm(TimeBlockSize);
+
+    #pragma omp for schedule(static)
+    for(int i_b=0; i_b<NBlocks; ++i_b) {
+      const int t0 = i_b*TimeBlockSize;
+      const int NT = std::min(TimeBlockSize, NTimes-t0);
+
+      for(int i_l=0; i_l<NLs; ++i_l) {
+        const int l = Ls[i_l];
+        const int Nm = 2*l+1;
+        const vector<unsigned int>& Indices = ModeIndices[i_l];
+
+        // Get the Wigner D matrix data for each time step of this block
+        for(int tt=0; tt<NT; ++tt) {
+          if(!ConstantRotation || tt==0) {
+            D.SetRotation(R_frame[ConstantRotation ? 0 : t0+tt]);
             for(int m=-l; m<=l; ++m) {
               for(int mp=-l; mp<=l; ++mp) {
-                Ds[mp+l][m+l] = D(l,mp,m);
+                const complex<double> Dmmp = D(l,mp,m);
+                DRe[((m+l)*Nm+(mp+l))*TimeBlockSize+tt] = std::real(Dmmp);
+                DIm[((m+l)*Nm+(mp+l))*TimeBlockSize+tt] = std::imag(Dmmp);
               }
             }
-            // Store the data for all m' modes at this time step
-            for(int mp=-l, i=0; mp<=l; ++mp, ++i) {
-              Data[mp+l] = this->operator()(ModeIndices[i], t);
-            }
-            // Compute the data at this time step for each m
-            for(int m=-l, i=0; m<=l; ++m, ++i) {
-              data[ModeIndices[i]][t] = 0.0;
-              for(int mp=-l; mp<=l; ++mp) { // Sum over m'
-                data[ModeIndices[i]][t] += Ds[mp+l][m+l]*Data[mp+l];
-              }
+          } else {
+            for(int i_mmp=0; i_mmp<Nm*Nm; ++i_mmp) {
+              DRe[i_mmp*TimeBlockSize+tt] = DRe[i_mmp*TimeBlockSize];
+              DIm[i_mmp*TimeBlockSize+tt] = DIm[i_mmp*TimeBlockSize];
             }
           }
         }
 
-      }
+        // Store the data for all m' modes for this block; each of these
+        // reads is contiguous in memory
+        for(int i_mp=0; i_mp<Nm; ++i_mp) {
+          const complex<double>* Row = data[Indices[i_mp]] + t0;
+          for(int tt=0; tt<NT; ++tt) {
+            InRe[i_mp*TimeBlockSize+tt] = std::real(Row[tt]);
+            InIm[i_mp*TimeBlockSize+tt] = std::imag(Row[tt]);
+          }
+        }
 
-      mode += 2*l+1;
+        // Compute the data for each m in this block
+        for(int i_m=0; i_m<Nm; ++i_m) {
+          for(int tt=0; tt<NT; ++tt) {
+            OutRe[tt] = 0.0;
+            OutIm[tt] = 0.0;
+          }
+          for(int i_mp=0; i_mp<Nm; ++i_mp) { // Sum over m'
+            const double* dre = &DRe[(i_m*Nm+i_mp)*TimeBlockSize];
+            const double* dim = &DIm[(i_m*Nm+i_mp)*TimeBlockSize];
+            const double* xre = &InRe[i_mp*TimeBlockSize];
+            const double* xim = &InIm[i_mp*TimeBlockSize];
+            for(int tt=0; tt<NT; ++tt) {
+              OutRe[tt] += dre[tt]*xre[tt] - dim[tt]*xim[tt];
+              OutIm[tt] += dre[tt]*xim[tt] + dim[tt]*xre[tt];
+            }
+          }
+          complex<double>* Row = data[Indices[i_m]] + t0;
+          for(int tt=0; tt<NT; ++tt) {
+            Row[tt] = complex<double>(OutRe[tt], OutIm[tt]);
+          }
+        }
+      }
     }
   }
 
   return *this;
 }
 
-/// Calculate the \f$<L \partial_t>\f$ quantity defined in the paper.
-vector<vector<double> > GWFrames::Waveform::LdtVector(vector<int> Lmodes) const {
+#ifndef DOXYGEN
+namespace {
+  // Solve the 3x3 system A x = b by Gaussian elimination with partial
+  // pivoting.  A is row-major; A and b are overwritten.
+  void Solve3x3(double* A, double* b, double* x) {
+    for(int k=0; k<3; ++k) {
+      int p = k;
+      for(int i=k+1; i<3; ++i) {
+        if(std::fabs(A[3*i+k])>std::fabs(A[3*p+k])) { p = i; }
+      }
+      if(p!=k) {
+        for(int j=0; j<3; ++j) { std::swap(A[3*k+j], A[3*p+j]); }
+        std::swap(b[k], b[p]);
+      }
+      for(int i=k+1; i<3; ++i) {
+        const double f = A[3*i+k]/A[3*k+k];
+        for(int j=k; j<3; ++j) { A[3*i+j] -= f*A[3*k+j]; }
+        b[i] -= f*b[k];
+      }
+    }
+    for(int i=2; i>=0; --i) {
+      double sum = b[i];
+      for(int j=i+1; j<3; ++j) { sum -= A[3*i+j]*x[j]; }
+      x[i] = sum/A[3*i+i];
+    }
+  }
+}
+#endif // DOXYGEN
+
+/// Compute <L dt> and/or <LL> in one pass over the data
+void GWFrames::Waveform::LdtAndLL(std::vector<int> Lmodes, std::vector<double>* Ldt, std::vector<double>* LL,
+                                  const unsigned int i_t_a, int i_t_b) const {
   ///
   /// \param Lmodes L modes to evaluate
+  /// \param Ldt If nonzero, on output holds <L dt> as NTimes*3 contiguous values
+  /// \param LL If nonzero, on output holds <LL> as NTimes*9 contiguous (row-major) values
+  /// \param i_t_a Optional initial time index to evaluate
+  /// \param i_t_b Optional one-past-final time index to evaluate
   ///
-  /// If Lmodes is empty (default), all L modes are used.  Setting
-  /// Lmodes to [2] or [2,3,4], for example, restricts the range of
-  /// the sum.  The vector is given with respect to the (possibly
-  /// rotating) mode frame (X,Y,Z), rather than the inertial frame
-  /// (x,y,z).
-  ///
-  /// \f$<L \partial_t>^a = \sum_{\ell,m,m'} \Im [ \bar{f}^{\ell,m'} < \ell,m' | L_a | \ell,m > \dot{f}^{\ell,m} ]\f$
+  /// When a range of times is given, the results are just those of
+  /// the corresponding slice of this Waveform (so the derivatives are
+  /// taken over that range alone), as used by `WaveformView`.
+  /// This is the kernel for `LdtVector`, `LLMatrix`, and
+  /// `AngularVelocityVector`.  The mode indices and ladder-operator
+  /// factors are looked up once, each mode is differentiated once
+  /// (only if `Ldt` is needed), and then the time steps are split
+  /// into tiles, which are done in parallel.  Within a tile, each ell
+  /// block is walked contiguously in time.  The sums at each time
+  /// step are done in the same order as the original separate
+  /// functions, so the results are identical.
 
   // L+ = Lx + i Ly      Lx =    (L+ + L-) / 2     Im(Lx) =  ( Im(L+) + Im(L-) ) / 2
   // L- = Lx - i Ly      Ly = -i (L+ - L-) / 2     Im(Ly) = -( Re(L+) - Re(L-) ) / 2
   // Lz = Lz             Lz = Lz                   Im(Lz) = Im(Lz)
-
-  const LadderOperatorFactorSingleton& LadderOperatorFactor = LadderOperatorFactorSingleton::Instance();
+  // LxLx =   (L+ + L-)(L+ + L-) / 4
+  // LxLy = -i(L+ + L-)(L+ - L-) / 4
+  // LxLz =   (L+ + L-)(  Lz   ) / 2
+  // LyLx = -i(L+ - L-)(L+ + L-) / 4
+  // LyLy =  -(L+ - L-)(L+ - L-) / 4
+  // LyLz = -i(L+ - L-)(  Lz   ) / 2
+  // LzLx =   (  Lz   )(L+ + L-) / 2
+  // LzLy = -i(  Lz   )(L+ - L-) / 2
+  // LzLz =   (  Lz   )(  Lz   )
+
   if(Lmodes.size()==0) {
     Lmodes.push_back(lm[0][0]);
     for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
@@ -1443,114 +2081,246 @@ vector<vector<double> > GWFrames::Waveform::LdtVector(vector<int> Lmodes) const
       }
     }
   }
-  vector<vector<double> > l(NTimes(), vector<double>(3, 0.0));
-  for(unsigned int iL=0; iL<Lmodes.size(); ++iL) {
+  if(i_t_b==-1) {
+    i_t_b = NTimes();
+  }
+  if(int(i_t_a)>i_t_b || i_t_b>int(NTimes())) {
+    INFOTOCERR << "\nError: Asking for time indices [i_t_a,i_t_b)=[" << i_t_a << "," << i_t_b << ") in a Waveform with " << NTimes() << " time steps." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  const int NL = Lmodes.size();
+  const int NT = i_t_b-i_t_a;
+
+  // Look up the mode indices and ladder factors for each ell block;
+  // Ladder[iL][k+L] = LadderOperatorFactor(L, k)
+  const LadderOperatorFactorSingleton& LadderOperatorFactor = LadderOperatorFactorSingleton::Instance();
+  vector<vector<const complex<double>*> > Rows(NL);
+  vector<vector<double> > Ladder(NL);
+  vector<std::pair<int,int> > DerivativeModes;
+  for(int iL=0; iL<NL; ++iL) {
     const int L = Lmodes[iL];
+    Rows[iL].resize(2*L+1);
+    Ladder[iL].resize(2*L+1);
     for(int M=-L; M<=L; ++M) {
-      const int iMode = FindModeIndex(L,M);
-      const vector<complex<double> > dDdt = DataDot(iMode);
-      if(M+1<=L) { // L+
-        const int iModep1 = FindModeIndex(L,M+1);
-        const double c_ell_posm = LadderOperatorFactor(L, M);
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lplus  = c_ell_posm * conj(data[iModep1][iTime]) * dDdt[iTime];
-          l[iTime][0] += 0.5 * imag(Lplus);
-          l[iTime][1] -= 0.5 * real(Lplus);
+      Rows[iL][M+L] = data[FindModeIndex(L,M)]+i_t_a;
+      Ladder[iL][M+L] = LadderOperatorFactor(L, M);
+      DerivativeModes.push_back(std::make_pair(iL, M));
+    }
+  }
+
+  // Differentiate each mode once
+  vector<vector<vector<complex<double> > > > dDdt(NL);
+  if(Ldt) {
+    for(int iL=0; iL<NL; ++iL) {
+      dDdt[iL].resize(2*Lmodes[iL]+1);
+    }
+    const vector<double> tWindow( (NT==int(NTimes())) ? vector<double>(0) : vector<double>(t.begin()+i_t_a, t.begin()+i_t_b) );
+    const vector<double>& tNT = (NT==int(NTimes()) ? t : tWindow);
+    const int ND = DerivativeModes.size();
+    int ErrorCode = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for(int i_D=0; i_D<ND; ++i_D) {
+      try {
+        const int iL = DerivativeModes[i_D].first;
+        const int L = Lmodes[iL];
+        const int M = DerivativeModes[i_D].second;
+        dDdt[iL][M+L] = ComplexDerivative(vector<complex<double> >(Rows[iL][M+L], Rows[iL][M+L]+NT), tNT);
+      } catch(int e) {
+        #pragma omp critical(GWFrames_LdtAndLLError)
+        {
+          ErrorCode = e;
         }
-      }
-      { // Lz; always evaluate this one
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lz = (conj(data[iMode][iTime]) * dDdt[iTime]) * double(M);
-          l[iTime][2] += imag(Lz);
+      } catch(...) {
+        #pragma omp critical(GWFrames_LdtAndLLError)
+        {
+          ErrorCode = GWFrames_UnknownException;
         }
       }
-      if(M-1>=-L) { // L-
-        const int iModem1 = FindModeIndex(L,M-1);
-        const double c_ell_negm = LadderOperatorFactor(L, -M);
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lminus  = c_ell_negm * conj(data[iModem1][iTime]) * dDdt[iTime];
-          l[iTime][0] += 0.5 * imag(Lminus);
-          l[iTime][1] += 0.5 * real(Lminus);
+    }
+    if(ErrorCode) { throw(ErrorCode); }
+    Ldt->assign(3*NT, 0.0);
+  }
+  if(LL) {
+    LL->assign(9*NT, 0.0);
+  }
+
+  const complex<double> ImaginaryI(0.0,1.0);
+  const int TileSize = 256;
+  const int NTiles = (NT+TileSize-1)/TileSize;
+  #pragma omp parallel for schedule(static)
+  for(int i_tile=0; i_tile<NTiles; ++i_tile) {
+    const int t0 = i_tile*TileSize;
+    const int t1 = std::min(NT, t0+TileSize);
+    for(int iL=0; iL<NL; ++iL) {
+      const int L = Lmodes[iL];
+      const vector<double>& c = Ladder[iL];
+      for(int M=-L; M<=L; ++M) {
+        if(Ldt) {
+          double* l = &(*Ldt)[0];
+          const complex<double>* D = Rows[iL][M+L];
+          const complex<double>* dD = &dDdt[iL][M+L][0];
+          if(M+1<=L) { // L+
+            const complex<double>* Dp1 = Rows[iL][M+1+L];
+            const double c_ell_posm = c[M+L];
+            for(int iTime=t0; iTime<t1; ++iTime) {
+              const complex<double> Lplus  = c_ell_posm * conj(Dp1[iTime]) * dD[iTime];
+              l[3*iTime+0] += 0.5 * imag(Lplus);
+              l[3*iTime+1] -= 0.5 * real(Lplus);
+            }
+          }
+          { // Lz; always evaluate this one
+            for(int iTime=t0; iTime<t1; ++iTime) {
+              const complex<double> Lz = (conj(D[iTime]) * dD[iTime]) * double(M);
+              l[3*iTime+2] += imag(Lz);
+            }
+          }
+          if(M-1>=-L) { // L-
+            const complex<double>* Dm1 = Rows[iL][M-1+L];
+            const double c_ell_negm = c[-M+L];
+            for(int iTime=t0; iTime<t1; ++iTime) {
+              const complex<double> Lminus  = c_ell_negm * conj(Dm1[iTime]) * dD[iTime];
+              l[3*iTime+0] += 0.5 * imag(Lminus);
+              l[3*iTime+1] += 0.5 * real(Lminus);
+            }
+          }
+        }
+        if(LL) {
+          double* ll = &(*LL)[0];
+          const complex<double>* DM   = Rows[iL][M+L];
+          const complex<double>* DMm2 = (M-2>=-L ? Rows[iL][M-2+L] : 0);
+          const complex<double>* DMm1 = (M-1>=-L ? Rows[iL][M-1+L] : 0);
+          const complex<double>* DMp1 = (M+1<=L ? Rows[iL][M+1+L] : 0);
+          const complex<double>* DMp2 = (M+2<=L ? Rows[iL][M+2+L] : 0);
+          for(int iTime=t0; iTime<t1; ++iTime) {
+            const complex<double> LpLp = (M+2<=L  ? conj(DMp2[iTime]) * c[M+1+L]    * c[M+L] * DM[iTime] : 0.0);
+            const complex<double> LpLm = (M-1>=-L ? conj(DM[iTime])   * c[M-1+L]    * c[-M+L] * DM[iTime] : 0.0);
+            const complex<double> LmLp = (M+1<=L  ? conj(DM[iTime])   * c[-(M+1)+L] * c[M+L] * DM[iTime] : 0.0);
+            const complex<double> LmLm = (M-2>=-L ? conj(DMm2[iTime]) * c[-(M-1)+L] * c[-M+L] * DM[iTime] : 0.0);
+            const complex<double> LpLz = (M+1<=L  ? conj(DMp1[iTime]) * c[M+L] * double(M)      * DM[iTime] : 0.0);
+            const complex<double> LzLp = (M+1<=L  ? conj(DMp1[iTime]) * double(M+1) * c[M+L]  * DM[iTime] : 0.0);
+            const complex<double> LmLz = (M-1>=-L ? conj(DMm1[iTime]) * c[-M+L] * double(M)     * DM[iTime] : 0.0);
+            const complex<double> LzLm = (M-1>=-L ? conj(DMm1[iTime]) * double(M-1) * c[-M+L] * DM[iTime] : 0.0);
+            const complex<double> LzLz = conj(DM[iTime]) * double(M) * double(M) * DM[iTime];
+            //
+            const complex<double> LxLx = 0.25 * (LpLp + LmLm + LmLp + LpLm);
+            const complex<double> LxLy = -0.25 * ImaginaryI * (LpLp - LmLm + LmLp - LpLm);
+            const complex<double> LxLz = 0.5 * (LpLz + LmLz);
+            const complex<double> LyLx = -0.25 * ImaginaryI * (LpLp - LmLp + LpLm - LmLm);
+            const complex<double> LyLy = -0.25 * (LpLp - LmLp - LpLm + LmLm);
+            const complex<double> LyLz = -0.5 * ImaginaryI * (LpLz - LmLz);
+            const complex<double> LzLx = 0.5 * (LzLp + LzLm);
+            const complex<double> LzLy = -0.5 * ImaginaryI * (LzLp - LzLm);
+            double* ll_t = ll+9*iTime;
+            ll_t[0] += real( LxLx );
+            ll_t[1] += real( LxLy + LyLx )/2.0;
+            ll_t[2] += real( LxLz + LzLx )/2.0;
+            ll_t[3] += real( LyLx + LxLy )/2.0;
+            ll_t[4] += real( LyLy );
+            ll_t[5] += real( LyLz + LzLy )/2.0;
+            ll_t[6] += real( LzLx + LxLz )/2.0;
+            ll_t[7] += real( LzLy + LyLz )/2.0;
+            ll_t[8] += real( LzLz );
+          }
         }
       }
     }
   }
-  return l;
+  return;
 }
 
-/// Calculate the \f$<LL>\f$ quantity defined in the paper.
-vector<Matrix> GWFrames::Waveform::LLMatrix(vector<int> Lmodes) const {
+/// Calculate the \f$<L \partial_t>\f$ quantity defined in the paper.
+vector<vector<double> > GWFrames::Waveform::LdtVector(vector<int> Lmodes) const {
   ///
   /// \param Lmodes L modes to evaluate
   ///
   /// If Lmodes is empty (default), all L modes are used.  Setting
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
-  /// the sum.  The matrix is given in the (possibly rotating) mode
-  /// frame (X,Y,Z), rather than the inertial frame (x,y,z).
+  /// the sum.  The vector is given with respect to the (possibly
+  /// rotating) mode frame (X,Y,Z), rather than the inertial frame
+  /// (x,y,z).
   ///
-  /// \f$<LL>^{ab} = \sum_{\ell,m,m'} [\bar{f}^{\ell,m'} < \ell,m' | L_a L_b | \ell,m > f^{\ell,m} ]\f$
+  /// \f$<L \partial_t>^a = \sum_{\ell,m,m'} \Im [ \bar{f}^{\ell,m'} < \ell,m' | L_a | \ell,m > \dot{f}^{\ell,m} ]\f$
 
-  // Big, bad, ugly, obvious way to do the calculation
+  return LdtArray(Lmodes).Nested();
+}
 
-  // L+ = Lx + i Ly      Lx =    (L+ + L-) / 2     Im(Lx) =  ( Im(L+) + Im(L-) ) / 2
-  // L- = Lx - i Ly      Ly = -i (L+ - L-) / 2     Im(Ly) = -( Re(L+) - Re(L-) ) / 2
-  // Lz = Lz             Lz = Lz                   Im(Lz) = Im(Lz)
-  // LxLx =   (L+ + L-)(L+ + L-) / 4
-  // LxLy = -i(L+ + L-)(L+ - L-) / 4
-  // LxLz =   (L+ + L-)(  Lz   ) / 2
-  // LyLx = -i(L+ - L-)(L+ + L-) / 4
-  // LyLy =  -(L+ - L-)(L+ - L-) / 4
-  // LyLz = -i(L+ - L-)(  Lz   ) / 2
-  // LzLx =   (  Lz   )(L+ + L-) / 2
-  // LzLy = -i(  Lz   )(L+ - L-) / 2
-  // LzLz =   (  Lz   )(  Lz   )
-  vector<Matrix> ll(NTimes(), Matrix(3,3));
-  const complex<double> ImaginaryI(0.0,1.0);
+/// Calculate the \f$<L \partial_t>\f$ quantity as a contiguous NTimes x 3 array
+GWFrames::Array2D GWFrames::Waveform::LdtArray(const std::vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// \sa LdtVector
+  GWFrames::Array2D l(NTimes(), 3);
+  LdtAndLL(Lmodes, &l.Flat(), 0);
+  return l;
+}
+
+/// Calculate the \f$<L \partial_t>\f$ quantity over the viewed times
+vector<vector<double> > GWFrames::WaveformView::LdtVector(vector<int> Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// \sa Waveform::LdtVector
+  return LdtArray(Lmodes).Nested();
+}
+
+/// Calculate the \f$<L \partial_t>\f$ quantity over the viewed times as a contiguous NTimes x 3 array
+GWFrames::Array2D GWFrames::WaveformView::LdtArray(vector<int> Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// If Lmodes is empty (default), all L modes in the view are used.
+  /// Every (ell,m) mode of each requested ell must be in the view.
+  /// The result is the same as that of the `Copy()` of this view,
+  /// but nothing is copied except for the times.
+  ///
+  /// \sa Waveform::LdtArray
+  const unsigned int NM = NModes();
   if(Lmodes.size()==0) {
-    Lmodes.push_back(lm[0][0]);
-    for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-      if(std::find(Lmodes.begin(), Lmodes.end(), lm[i_m][0]) == Lmodes.end() ) {
-        Lmodes.push_back(lm[i_m][0]);
+    for(unsigned int i_m=0; i_m<NM; ++i_m) {
+      if(std::find(Lmodes.begin(), Lmodes.end(), LM(i_m)[0]) == Lmodes.end() ) {
+        Lmodes.push_back(LM(i_m)[0]);
       }
     }
+    if(Lmodes.size()==0) {
+      INFOTOCERR << "\nError: Asking for <L dt> of a view with no modes." << std::endl;
+      throw(GWFrames_IndexOutOfBounds);
+    }
   }
   for(unsigned int iL=0; iL<Lmodes.size(); ++iL) {
     const int L = Lmodes[iL];
     for(int M=-L; M<=L; ++M) {
-      const int iMm2 = (M-2>=-L ? FindModeIndex(L,M-2) : 0);
-      const int iMm1 = (M-1>=-L ? FindModeIndex(L,M-1) : 0);
-      const int iM   = FindModeIndex(L,M);
-      const int iMp1 = (M+1<=L ? FindModeIndex(L,M+1) : 0);
-      const int iMp2 = (M+2<=L ? FindModeIndex(L,M+2) : 0);
-      for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-        const complex<double> LpLp = (M+2<=L  ? conj(data[iMp2][iTime]) * LadderOperatorFactor(L, M+1)    * LadderOperatorFactor(L, M) * data[iM][iTime] : 0.0);
-        const complex<double> LpLm = (M-1>=-L ? conj(data[iM][iTime])   * LadderOperatorFactor(L, M-1)    * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LmLp = (M+1<=L  ? conj(data[iM][iTime])   * LadderOperatorFactor(L, -(M+1)) * LadderOperatorFactor(L, M) * data[iM][iTime] : 0.0);
-        const complex<double> LmLm = (M-2>=-L ? conj(data[iMm2][iTime]) * LadderOperatorFactor(L, -(M-1)) * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LpLz = (M+1<=L  ? conj(data[iMp1][iTime]) * LadderOperatorFactor(L, M) * double(M)      * data[iM][iTime] : 0.0);
-        const complex<double> LzLp = (M+1<=L  ? conj(data[iMp1][iTime]) * double(M+1) * LadderOperatorFactor(L, M)  * data[iM][iTime] : 0.0);
-        const complex<double> LmLz = (M-1>=-L ? conj(data[iMm1][iTime]) * LadderOperatorFactor(L, -M) * double(M)     * data[iM][iTime] : 0.0);
-        const complex<double> LzLm = (M-1>=-L ? conj(data[iMm1][iTime]) * double(M-1) * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LzLz = conj(data[iM][iTime]) * double(M) * double(M) * data[iM][iTime];
-        //
-        const complex<double> LxLx = 0.25 * (LpLp + LmLm + LmLp + LpLm);
-        const complex<double> LxLy = -0.25 * ImaginaryI * (LpLp - LmLm + LmLp - LpLm);
-        const complex<double> LxLz = 0.5 * (LpLz + LmLz);
-        const complex<double> LyLx = -0.25 * ImaginaryI * (LpLp - LmLp + LpLm - LmLm);
-        const complex<double> LyLy = -0.25 * (LpLp - LmLp - LpLm + LmLm);
-        const complex<double> LyLz = -0.5 * ImaginaryI * (LpLz - LmLz);
-        const complex<double> LzLx = 0.5 * (LzLp + LzLm);
-        const complex<double> LzLy = -0.5 * ImaginaryI * (LzLp - LzLm);
-        //const complex<double> LzLz = (LzLz);
-        ll[iTime](0,0) += real( LxLx );
-        ll[iTime](0,1) += real( LxLy + LyLx )/2.0;
-        ll[iTime](0,2) += real( LxLz + LzLx )/2.0;
-        ll[iTime](1,0) += real( LyLx + LxLy )/2.0;
-        ll[iTime](1,1) += real( LyLy );
-        ll[iTime](1,2) += real( LyLz + LzLy )/2.0;
-        ll[iTime](2,0) += real( LzLx + LxLz )/2.0;
-        ll[iTime](2,1) += real( LzLy + LyLz )/2.0;
-        ll[iTime](2,2) += real( LzLz );
+      const unsigned int i_Parent = W->FindModeIndex(L, M);
+      if(std::find(modes.begin(), modes.end(), i_Parent) == modes.end()) {
+        INFOTOCERR << "\nError: (ell,m)=(" << L << "," << M << ") is not in this view of the Waveform." << std::endl;
+        throw(GWFrames_IndexOutOfBounds);
+      }
+    }
+  }
+  GWFrames::Array2D l(NTimes(), 3);
+  W->LdtAndLL(Lmodes, &l.Flat(), 0, i_t_a, i_t_b);
+  return l;
+}
+
+/// Calculate the \f$<LL>\f$ quantity defined in the paper.
+vector<Matrix> GWFrames::Waveform::LLMatrix(vector<int> Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// If Lmodes is empty (default), all L modes are used.  Setting
+  /// Lmodes to [2] or [2,3,4], for example, restricts the range of
+  /// the sum.  The matrix is given in the (possibly rotating) mode
+  /// frame (X,Y,Z), rather than the inertial frame (x,y,z).
+  ///
+  /// \f$<LL>^{ab} = \sum_{\ell,m,m'} [\bar{f}^{\ell,m'} < \ell,m' | L_a L_b | \ell,m > f^{\ell,m} ]\f$
+
+  std::vector<double> LL;
+  LdtAndLL(Lmodes, 0, &LL);
+  vector<Matrix> ll(NTimes(), Matrix(3,3));
+  for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
+    for(int a=0; a<3; ++a) {
+      for(int b=0; b<3; ++b) {
+        ll[iTime](a,b) = LL[9*iTime+3*a+b];
       }
     }
   }
@@ -1577,14 +2347,26 @@ std::vector<std::vector<double> > GWFrames::Waveform::LLDominantEigenvector(cons
   ///
   /// The vector is given in the (possibly rotating) mode frame
   /// (X,Y,Z), rather than the inertial frame (x,y,z).
+  ///
+  /// The LL matrices are kept flat, and the 3x3 eigenproblem at each
+  /// instant is solved with `SymmetricEigensystem3`, which allocates
+  /// nothing, so the time steps are done in parallel.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::LLDominantEigenvector");
 
   // Calculate the LL matrix at each instant
-  vector<Matrix> ll = LLMatrix(Lmodes);
+  std::vector<double> LL;
+  LdtAndLL(Lmodes, 0, &LL);
 
   // Calculate the dominant principal axis (dpa) of LL at each instant
-  vector<vector<double> > dpa(NTimes(), vector<double>(3));
-  for(unsigned int i=0; i<ll.size(); ++i) {
-    dpa[i] = GWFrames::DominantPrincipalAxis(ll[i]);
+  const int NT = NTimes();
+  vector<vector<double> > dpa(NT, vector<double>(3));
+  #pragma omp parallel for schedule(static)
+  for(int i=0; i<NT; ++i) {
+    double Values[3], Vectors[9];
+    GWFrames::SymmetricEigensystem3(&LL[9*i], Values, Vectors);
+    dpa[i][0] = Vectors[0];
+    dpa[i][1] = Vectors[3];
+    dpa[i][2] = Vectors[6];
   }
 
   // Make the initial direction closer to RoughInitialEllDirection than not
@@ -1645,36 +2427,69 @@ vector<vector<double> > GWFrames::Waveform::AngularVelocityVector(const vector<i
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
   /// the sum.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::AngularVelocityVector");
 
-  // Calculate the L vector and LL matrix at each instant
-  vector<vector<double> > l = LdtVector(Lmodes);
-  vector<Matrix> ll = LLMatrix(Lmodes);
-
-  // Construct some objects for storage
-  vector<vector<double> > omega(NTimes(), vector<double>(3));
-  int s;
-  gsl_vector* x = gsl_vector_alloc(3);
-  gsl_permutation* p = gsl_permutation_alloc(3);
+  return AngularVelocityArray(Lmodes).Nested();
+}
 
-  // Loop through time steps
-  for(unsigned int iTime=0; iTime<omega.size(); ++iTime) {
-    // Solve   -omega * LL = L   at each time step, using LU decomposition
-    gsl_vector_view b = gsl_vector_view_array(&l[iTime][0], 3);
-    gsl_linalg_LU_decomp(ll[iTime].gslobj(), p, &s);
-    gsl_linalg_LU_solve(ll[iTime].gslobj(), p, &b.vector, x);
+/// Calculate the angular velocity of the Waveform as a contiguous NTimes x 3 array
+GWFrames::Array2D GWFrames::Waveform::AngularVelocityArray(const std::vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// \sa AngularVelocityVector
+  std::vector<double> Ldt, LL;
+  GWFrames::Array2D omega(NTimes(), 3);
+  LdtLLAndAngularVelocity(Lmodes, Ldt, LL, omega.Flat());
+  return omega;
+}
 
-    // Save data for this time step
-    omega[iTime][0] = -gsl_vector_get(x, 0);
-    omega[iTime][1] = -gsl_vector_get(x, 1);
-    omega[iTime][2] = -gsl_vector_get(x, 2);
+/// Calculate <L dt>, <LL>, and the angular velocity together, as contiguous arrays
+void GWFrames::Waveform::LdtLLAndAngularVelocity(const std::vector<int>& Lmodes, std::vector<double>& Ldt,
+                                                 std::vector<double>& LL, std::vector<double>& omega) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  /// \param Ldt On output, <L dt> as NTimes*3 contiguous values
+  /// \param LL On output, <LL> as NTimes*9 contiguous (row-major) values
+  /// \param omega On output, the angular velocity as NTimes*3 contiguous values
+  ///
+  /// This returns the same quantities as `LdtVector`, `LLMatrix`, and
+  /// `AngularVelocityVector`, but computes them all in one pass over
+  /// the data, and stores them flat, with the time index varying
+  /// slowest.  The angular velocity solves \f$-\omega\, <LL> = <L
+  /// \partial_t>\f$ at each instant.
+  ///
+  /// \sa AngularVelocityVector
+
+  LdtAndLL(Lmodes, &Ldt, &LL);
+  const int NT = NTimes();
+  omega.resize(3*NT);
+  #pragma omp parallel for schedule(static)
+  for(int iTime=0; iTime<NT; ++iTime) {
+    // Solve   -omega * LL = L   at each time step
+    double A[9], b[3], x[3];
+    std::copy(&LL[9*iTime], &LL[9*iTime]+9, A);
+    std::copy(&Ldt[3*iTime], &Ldt[3*iTime]+3, b);
+    Solve3x3(A, b, x);
+    omega[3*iTime]   = -x[0];
+    omega[3*iTime+1] = -x[1];
+    omega[3*iTime+2] = -x[2];
   }
+  return;
+}
 
-  // Free the memory
-  gsl_permutation_free(p);
-  gsl_vector_free(x);
-
-  return omega;
+#ifndef DOXYGEN
+namespace {
+  // Pure-vector quaternions from the rows of an NTimes x 3 array
+  vector<Quaternion> QuaternionsFromArray(const GWFrames::Array2D& v) {
+    vector<Quaternion> Q(v.nrows());
+    for(unsigned int i=0; i<v.nrows(); ++i) {
+      Q[i] = Quaternion(0.0, v(i,0), v(i,1), v(i,2));
+    }
+    return Q;
+  }
 }
+#endif // DOXYGEN
 
 /// Calculate the angular velocity of the Waveform.
 vector<vector<double> > GWFrames::Waveform::AngularVelocityVectorRelativeToInertial(const vector<int>& Lmodes) const {
@@ -1693,7 +2508,17 @@ vector<vector<double> > GWFrames::Waveform::AngularVelocityVectorRelativeToInert
   /// the sum.
   ///
 
-  vector<vector<double> > omega = this->AngularVelocityVector(Lmodes);
+  return AngularVelocityArrayRelativeToInertial(Lmodes).Nested();
+}
+
+/// Calculate the angular velocity of the Waveform in the inertial frame, as a contiguous NTimes x 3 array
+GWFrames::Array2D GWFrames::Waveform::AngularVelocityArrayRelativeToInertial(const vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// \sa AngularVelocityVectorRelativeToInertial
+
+  GWFrames::Array2D omega = this->AngularVelocityArray(Lmodes);
 
   // If the frame is nontrivial, include its contribution
   const bool TimeDependentFrame = (frame.size()>1);
@@ -1710,14 +2535,23 @@ vector<vector<double> > GWFrames::Waveform::AngularVelocityVectorRelativeToInert
   }
 
   // Loop through time steps
+  const int NT = omega.nrows();
   if(TimeDependentFrame) { // Include frame-rotation effects
-    for(unsigned int iTime=0; iTime<omega.size(); ++iTime) {
+    #pragma omp parallel for schedule(static)
+    for(int iTime=0; iTime<NT; ++iTime) {
       const Quaternion& R = frame[iTime];
-      omega[iTime] = (R*Quaternion(omega[iTime])*R.conjugate() + 2*Rdot[iTime]*R.conjugate()).vec();
+      const Quaternion Omega = R*Quaternion(0.0, omega(iTime,0), omega(iTime,1), omega(iTime,2))*R.conjugate() + 2*Rdot[iTime]*R.conjugate();
+      omega(iTime,0) = Omega[1];
+      omega(iTime,1) = Omega[2];
+      omega(iTime,2) = Omega[3];
     }
-  } else if(ConstantNontrivialFrame) { // Just rotate the resul
-    for(unsigned int iTime=0; iTime<omega.size(); ++iTime) {
-      omega[iTime] = (R0*Quaternion(omega[iTime])*R0.conjugate()).vec();
+  } else if(ConstantNontrivialFrame) { // Just rotate the result
+    #pragma omp parallel for schedule(static)
+    for(int iTime=0; iTime<NT; ++iTime) {
+      const Quaternion Omega = R0*Quaternion(0.0, omega(iTime,0), omega(iTime,1), omega(iTime,2))*R0.conjugate();
+      omega(iTime,0) = Omega[1];
+      omega(iTime,1) = Omega[2];
+      omega(iTime,2) = Omega[3];
     }
   }
 
@@ -1739,7 +2573,7 @@ std::vector<Quaternions::Quaternion> GWFrames::Waveform::CorotatingFrame(const s
   /// the sum.
   ///
 
-  return Quaternions::FrameFromAngularVelocity(QuaternionArray(AngularVelocityVector(Lmodes)), T());
+  return Quaternions::FrameFromAngularVelocity(QuaternionsFromArray(AngularVelocityArray(Lmodes)), T());
 }
 
 /// Transform Waveform to co-precessing frame.
@@ -1757,6 +2591,7 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToCoprecessingFrame(const std::
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
   /// the sum.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::TransformToCoprecessingFrame");
   Quaternions::Quaternion RoughInitialEllDirection;
   const unsigned int NPointsForDeriv = 7;
   if(NTimes()<=NPointsForDeriv || FrameType()==GWFrames::Coorbital || FrameType()==GWFrames::Corotating) {
@@ -1767,7 +2602,7 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToCoprecessingFrame(const std::
     RoughInitialEllDirection = Quaternions::zHat;
   } else {
     const Waveform Segment = SliceOfTimeIndicesWithEll2(0, NPointsForDeriv);
-    RoughInitialEllDirection = Quaternions::Quaternion(Segment.AngularVelocityVector()[NPointsForDeriv/2]); // Using integer division
+    RoughInitialEllDirection = Quaternions::Quaternion(Segment.AngularVelocityArray().Row(NPointsForDeriv/2)); // Using integer division
   }
   history << "this->TransformToCoprecessingFrame(" << StringForm(Lmodes) << ")\n#";
   SetFrameType(GWFrames::Coprecessing);
@@ -1788,8 +2623,9 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToAngularVelocityFrame(const st
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
   /// the sum.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::TransformToAngularVelocityFrame");
   history << "this->TransformToAngularVelocityFrame(" << StringForm(Lmodes) << ")\n#";
-  vector<Quaternion> R_AV = normalized(QuaternionArray(this->AngularVelocityVector(Lmodes)));
+  vector<Quaternion> R_AV = normalized(QuaternionsFromArray(this->AngularVelocityArray(Lmodes)));
   this->frameType = GWFrames::Coprecessing;
   return this->RotateDecompositionBasis(FrameFromZ(R_AV, T()));
 }
@@ -1809,6 +2645,7 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToCorotatingFrame(const std::ve
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
   /// the sum.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::TransformToCorotatingFrame");
 
   vector<Quaternion> R_corot = this->CorotatingFrame(Lmodes);
   this->frameType = GWFrames::Corotating;
@@ -1824,6 +2661,7 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToInertialFrame() {
   /// stationary, inertial frame.  This is the usual frame of scri^+,
   /// and is the frame in which GW observations should be made.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::TransformToInertialFrame");
 
   if(frameType == GWFrames::Inertial) {
     INFOTOCERR << "\nWarning: Waveform is already in the " << GWFrames::WaveformFrameNames[GWFrames::Inertial] << " frame;"
@@ -1862,27 +2700,44 @@ GWFrames::Waveform& GWFrames::Waveform::TransformToInertialFrame() {
   return *this;
 }
 
-/// Interpolate the Waveform to a new set of time instants.
-GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain) const {
+// Copy everything but the data to a new Waveform on the new times,
+// interpolating the frame as needed
+GWFrames::Waveform GWFrames::Waveform::CopyForInterpolation(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                                            unsigned int& i0, unsigned int& i1) const {
   /// \param NewTime New vector of times to which this interpolates
-  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  /// \param AllowTimesOutsideCurrentDomain
+  /// \param i0 On output, the first index of NewTime inside the current domain
+  /// \param i1 On output, one more than the last index of NewTime inside the current domain
   ///
-  /// If `AllowTimesOutsideCurrentDomain` is true, the values of all
-  /// modes will be set to 0.0 for times outside the current set of
-  /// time data.  If false, and such times are requested, an error
-  /// will be thrown.
+  /// The returned Waveform has just the default history, and data of
+  /// the correct size, but with undefined values.
   ///
+  return View().CopyForInterpolation(NewTime, AllowTimesOutsideCurrentDomain, i0, i1);
+}
+
+// Copy everything but the data to a new Waveform on the new times,
+// interpolating the frame within the view as needed
+GWFrames::Waveform GWFrames::WaveformView::CopyForInterpolation(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                                                unsigned int& i0, unsigned int& i1) const {
+  /// \sa Waveform::CopyForInterpolation
   if(NewTime.size()==0) {
     INFOTOCERR << ": Asking for empty Waveform." << std::endl;
     throw(GWFrames_EmptyIntersection);
   }
-  unsigned int i0=0, i1=NewTime.size()-1;
+  if(NTimes()==0) {
+    INFOTOCERR << ": Asking to interpolate a view with no times." << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  i0=0;
+  i1=NewTime.size()-1;
   const unsigned int i2 = NewTime.size();
+  const double t0 = T(0);
+  const double tN = T(NTimes()-1);
   vector<double> NewTimesInsideCurrentDomain;
   if(AllowTimesOutsideCurrentDomain) {
     // Set the indices in the dumbest way possible
-    while(NewTime[i0]<t[0]) { ++i0; }
-    while(NewTime[i1]>t.back() && i1>0) { --i1; }
+    while(NewTime[i0]<t0) { ++i0; }
+    while(NewTime[i1]>tN && i1>0) { --i1; }
     ++i1;
     // Now, i0 is the first index in NewTime for which a current time
     // exists, and i1 is 1 beyond the last index in NewTime for which
@@ -1890,30 +2745,40 @@ GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& Ne
     NewTimesInsideCurrentDomain.resize(i1-i0);
     std::copy(NewTime.begin()+i0, NewTime.begin()+i1, NewTimesInsideCurrentDomain.begin());
   } else {
-    if(NewTime[0]<t[0]) {
+    if(NewTime[0]<t0) {
       std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Asking for extrapolation; we only do interpolation.\n"
-                << "NewTime[0]=" << NewTime[0] << "\tt[0]=" << t[0]
+                << "NewTime[0]=" << NewTime[0] << "\tt[0]=" << t0
                 << "\nMaybe you meant to pass the `AllowTimesOutsideCurrentDomain=true` flag..." << std::endl;
       throw(GWFrames_EmptyIntersection);
     }
-    if(NewTime.back()>t.back()) {
+    if(NewTime.back()>tN) {
       std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Asking for extrapolation; we only do interpolation.\n"
-                << "NewTime.back()=" << NewTime.back() << "\tt.back()=" << t.back()
+                << "NewTime.back()=" << NewTime.back() << "\tt.back()=" << tN
                 << "\nMaybe you meant to pass the `AllowTimesOutsideCurrentDomain=true` flag..."  << std::endl;
       throw(GWFrames_EmptyIntersection);
     }
+    i1 = i2;
   }
 
   Waveform C;
-  C.history << HistoryStr()
-            << "### *this = this->Interpolate(NewTime," << AllowTimesOutsideCurrentDomain << ");" << std::endl;
+  C.recordHistory = W->recordHistory;
+  C.ResetHistoryStream();
+  C.spinweight = W->spinweight;
+  C.boostweight = W->boostweight;
   C.t = NewTime;
-  if(frame.size()==1) { // Assume we have just a constant non-trivial frame
-    C.frame = frame;
-  } else if(frame.size()>1) { // Assume we have frame data for each time step
+  if(W->frame.size()==1) { // Assume we have just a constant non-trivial frame
+    C.frame = W->frame;
+  } else if(W->frame.size()>1) { // Assume we have frame data for each time step
+    // Only copy the times and frame if this is a proper subset
+    const bool Whole = (i_t_a==0 && i_t_b==W->NTimes());
+    const vector<double> tWindow( Whole ? vector<double>(0) : T() );
+    const vector<Quaternion> frameWindow( Whole ? vector<Quaternion>(0)
+                                          : vector<Quaternion>(W->frame.begin()+i_t_a, W->frame.begin()+i_t_b) );
+    const vector<double>& tView = (Whole ? W->t : tWindow);
+    const vector<Quaternion>& frameView = (Whole ? W->frame : frameWindow);
     if(AllowTimesOutsideCurrentDomain) {
       C.frame.resize(NewTime.size());
-      const std::vector<Quaternion> NewFrame = Squad(frame, t, NewTimesInsideCurrentDomain);
+      const std::vector<Quaternion> NewFrame = Squad(frameView, tView, NewTimesInsideCurrentDomain);
       for(unsigned int i=0; i<i0; ++i) {
         C.frame[i] = NewFrame[0];
       }
@@ -1924,57 +2789,140 @@ GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& Ne
         C.frame[i] = NewFrame.back();
       }
     } else {
-      C.frame = Squad(frame, t, NewTime);
+      C.frame = Squad(frameView, tView, NewTime);
     }
   }
-  C.frameType = frameType;
-  C.dataType = dataType;
-  C.rIsScaledOut = rIsScaledOut;
-  C.mIsScaledOut = mIsScaledOut;
-  C.lm = lm;
+  C.frameType = W->frameType;
+  C.dataType = W->dataType;
+  C.rIsScaledOut = W->rIsScaledOut;
+  C.mIsScaledOut = W->mIsScaledOut;
+  C.lm.resize(NModes());
+  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
+    C.lm[i_m] = LM(i_m);
+  }
+  C.IndexModes();
   C.data.resize(NModes(), NewTime.size());
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, NTimes());
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, NTimes());
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> re = Re(i_m);
-    const vector<double> im = Im(i_m);
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineRe, &(t)[0], &re[0], NTimes());
-    gsl_spline_init(splineIm, &(t)[0], &im[0], NTimes());
-    // Assign the interpolated data
-    if(AllowTimesOutsideCurrentDomain) {
+  return C;
+}
+
+/// Interpolate the Waveform to a new set of time instants.
+GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// If `AllowTimesOutsideCurrentDomain` is true, the values of all
+  /// modes will be set to 0.0 for times outside the current set of
+  /// time data.  If false, and such times are requested, an error
+  /// will be thrown.
+  ///
+  /// \sa WaveformInterpolant, for repeated interpolation of the same
+  /// Waveform to different times.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Interpolate");
+  return View().Interpolate(NewTime, AllowTimesOutsideCurrentDomain);
+}
+
+/// Interpolate the viewed data to a new set of time instants.
+GWFrames::Waveform GWFrames::WaveformView::Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// The splines are built from the viewed times and modes only, so
+  /// this gives the same result as interpolating the `Copy()` of
+  /// this view, without making that copy first.
+  ///
+  /// \sa Waveform::Interpolate
+  ///
+  unsigned int i0, i1;
+  Waveform C = CopyForInterpolation(NewTime, AllowTimesOutsideCurrentDomain, i0, i1);
+  const unsigned int i2 = NewTime.size();
+  C.history << W->HistoryStr()
+            << "### *this = " << HistoryPrefix() << "Interpolate(NewTime," << AllowTimesOutsideCurrentDomain << ");" << std::endl;
+  const double* tView = &(W->t)[i_t_a];
+  const int NT = NTimes();
+  // Loop over the modes in parallel; each thread gets its own GSL
+  // interpolators, which are not safe to share
+  const int NModes = C.NModes();
+  #pragma omp parallel
+  {
+    // Initialize the GSL interpolators for the data
+    gsl_interp_accel* accRe = gsl_interp_accel_alloc();
+    gsl_interp_accel* accIm = gsl_interp_accel_alloc();
+    gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, NT);
+    gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, NT);
+    vector<double> re(NT), im(NT);
+    // Now loop over each mode filling in the waveform data
+    #pragma omp for schedule(dynamic)
+    for(int i_m=0; i_m<NModes; ++i_m) {
+      // Extract the real and imaginary parts of the data separately for GSL
+      const complex<double>* Mode = (*this)(i_m);
+      for(int i_t=0; i_t<NT; ++i_t) {
+        re[i_t] = std::real(Mode[i_t]);
+        im[i_t] = std::imag(Mode[i_t]);
+      }
+      // Initialize the interpolators for this data set
+      GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 2);
+      gsl_spline_init(splineRe, tView, &re[0], NT);
+      gsl_spline_init(splineIm, tView, &im[0], NT);
+      gsl_interp_accel_reset(accRe);
+      gsl_interp_accel_reset(accIm);
+      // Assign the interpolated data
+      complex<double>* Data = C.data[i_m];
       for(unsigned int i_t=0; i_t<i0; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( 0., 0. );
+        Data[i_t] = complex<double>( 0., 0. );
       }
       for(unsigned int i_t=i0; i_t<i1; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, NewTimesInsideCurrentDomain[i_t], accRe),
-                                            gsl_spline_eval(splineIm, NewTimesInsideCurrentDomain[i_t], accIm) );
+        Data[i_t] = complex<double>( gsl_spline_eval(splineRe, NewTime[i_t], accRe), gsl_spline_eval(splineIm, NewTime[i_t], accIm) );
       }
       for(unsigned int i_t=i1; i_t<i2; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( 0., 0. );
-      }
-    } else {
-      for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
-        C.data[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, C.t[i_t], accRe), gsl_spline_eval(splineIm, C.t[i_t], accIm) );
+        Data[i_t] = complex<double>( 0., 0. );
       }
     }
+    // Free the interpolators
+    gsl_interp_accel_free(accRe);
+    gsl_interp_accel_free(accIm);
+    gsl_spline_free(splineRe);
+    gsl_spline_free(splineIm);
   }
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
 
   return C;
 }
 
+/// Interpolate the Waveform to a new set of time instants, using a precomputed interpolant.
+GWFrames::Waveform GWFrames::Waveform::Interpolate(const GWFrames::WaveformInterpolant& Interpolant, const std::vector<double>& NewTime,
+                                                   const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param Interpolant Interpolant constructed from this Waveform
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// This is the same as the other version of this function, except
+  /// that the spline coefficients are taken from `Interpolant`, which
+  /// must have been constructed from this Waveform (and its data not
+  /// changed since then).  This avoids recomputing the coefficients
+  /// each time this Waveform is interpolated to a new set of times.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Interpolate");
+  CheckInterpolant(Interpolant);
+  unsigned int i0, i1;
+  Waveform C = CopyForInterpolation(NewTime, AllowTimesOutsideCurrentDomain, i0, i1);
+  const unsigned int i2 = NewTime.size();
+  C.history << HistoryStr()
+            << "### *this = this->Interpolate(Interpolant, NewTime," << AllowTimesOutsideCurrentDomain << ");" << std::endl;
+  for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
+    for(unsigned int i_t=0; i_t<i0; ++i_t) {
+      C.data[i_m][i_t] = complex<double>( 0., 0. );
+    }
+    for(unsigned int i_t=i1; i_t<i2; ++i_t) {
+      C.data[i_m][i_t] = complex<double>( 0., 0. );
+    }
+  }
+  Interpolant.Evaluate(NewTime, C.data, i0, i1);
+  return C;
+}
+
 /// Interpolate the Waveform to a new set of time instants.
 GWFrames::Waveform& GWFrames::Waveform::InterpolateInPlace(const std::vector<double>& NewTime) {
+  GWFrames_INSTRUMENT_SCOPE("Waveform::InterpolateInPlace");
   if(NewTime.size()==0) {
     std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Asking for empty Waveform." << std::endl;
     throw(GWFrames_EmptyIntersection);
@@ -1990,8 +2938,7 @@ GWFrames::Waveform& GWFrames::Waveform::InterpolateInPlace(const std::vector<dou
     throw(GWFrames_EmptyIntersection);
   }
 
-  history << HistoryStr()
-          << "*this = this->Interpolate(NewTime);" << std::endl;
+  history << "*this = this->Interpolate(NewTime);" << std::endl;
   const vector<double> OldTime(t);
   if(frame.size()==1) { // Assume we have just a constant non-trivial frame
     frame = frame;
@@ -2000,98 +2947,724 @@ GWFrames::Waveform& GWFrames::Waveform::InterpolateInPlace(const std::vector<dou
   }
   MatrixC NewData;
   NewData.resize(NModes(), NewTime.size());
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> re(Re(i_m));
-    const vector<double> im(Im(i_m));
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineRe, &(OldTime)[0], &re[0], OldTime.size());
-    gsl_spline_init(splineIm, &(OldTime)[0], &im[0], OldTime.size());
-    // Assign the interpolated data
-    for(unsigned int i_t=0; i_t<NewTime.size(); ++i_t) {
-      NewData[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, NewTime[i_t], accRe), gsl_spline_eval(splineIm, NewTime[i_t], accIm) );
+  // Loop over the modes in parallel; each thread gets its own GSL
+  // interpolators, which are not safe to share
+  const int NModes = this->NModes();
+  const int NNew = NewTime.size();
+  #pragma omp parallel
+  {
+    // Initialize the GSL interpolators for the data
+    gsl_interp_accel* accRe = gsl_interp_accel_alloc();
+    gsl_interp_accel* accIm = gsl_interp_accel_alloc();
+    gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
+    gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
+    // Now loop over each mode filling in the waveform data
+    #pragma omp for schedule(dynamic)
+    for(int i_m=0; i_m<NModes; ++i_m) {
+      // Extract the real and imaginary parts of the data separately for GSL
+      const vector<double> re(Re(i_m));
+      const vector<double> im(Im(i_m));
+      // Initialize the interpolators for this data set
+      GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 2);
+      gsl_spline_init(splineRe, &(OldTime)[0], &re[0], OldTime.size());
+      gsl_spline_init(splineIm, &(OldTime)[0], &im[0], OldTime.size());
+      gsl_interp_accel_reset(accRe);
+      gsl_interp_accel_reset(accIm);
+      // Assign the interpolated data
+      complex<double>* Data = NewData[i_m];
+      for(int i_t=0; i_t<NNew; ++i_t) {
+        Data[i_t] = complex<double>( gsl_spline_eval(splineRe, NewTime[i_t], accRe), gsl_spline_eval(splineIm, NewTime[i_t], accIm) );
+      }
     }
+    // Free the interpolators
+    gsl_interp_accel_free(accRe);
+    gsl_interp_accel_free(accIm);
+    gsl_spline_free(splineRe);
+    gsl_spline_free(splineIm);
   }
   data.swap(NewData);
   t = NewTime;
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
 
   return *this;
 }
 
-/// Find the appropriate rotations to fix the attitude of the corotating frame.
-std::vector<Quaternions::Quaternion> GWFrames::Waveform::GetAlignmentsOfDecompositionFrameToModes(const std::vector<int>& Lmodes) const {
-  ///
-  /// \param Lmodes Lmodes to use in computing \f$<LL>\f$
+/// Interpolate the Waveform to a new set of time instants, using a precomputed interpolant.
+GWFrames::Waveform& GWFrames::Waveform::InterpolateInPlace(const GWFrames::WaveformInterpolant& Interpolant, const std::vector<double>& NewTime) {
+  /// \param Interpolant Interpolant constructed from this Waveform
+  /// \param NewTime New vector of times to which this interpolates
   ///
-  /// This function finds the appropriate pre-multiplied rotation
-  /// \f$R_{\varepsilon}\f$ so that the decomposition frame is aligned
-  /// to the waveform.  This particular version finds the appropriate
-  /// \f$R_{\varepsilon}\f$ at each time in the input Waveform.  This
-  /// is useful in cases where we need to try many such alignments,
-  /// because the setup for interpolation is very slow.
+  /// Note that `Interpolant` will no longer correspond to this
+  /// Waveform after this function returns.
   ///
-  /// Note that this function has no option to choose the direction of
-  /// X based on some nHat vector, as other similar functions have.
-  /// That issue is assumed to be handled elsewhere.
-
-  if(frameType!=GWFrames::Coprecessing && frameType!=GWFrames::Coorbital && frameType!=GWFrames::Corotating) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
-              << "\nError: GetAlignmentOfDecompositionFrameToModes only takes Waveforms in the "
-              << GWFrames::WaveformFrameNames[GWFrames::Coprecessing] << ", "
-              << GWFrames::WaveformFrameNames[GWFrames::Coorbital] << ", or "
-              << GWFrames::WaveformFrameNames[GWFrames::Corotating] << " frames."
-              << "\n       This Waveform is in the " << GWFrames::WaveformFrameNames[frameType] << " frame." << std::endl;
-    throw(GWFrames_WrongFrameType);
-  }
+  GWFrames_INSTRUMENT_SCOPE("Waveform::InterpolateInPlace");
+  CheckInterpolant(Interpolant);
+  unsigned int i0, i1;
+  Waveform C = CopyForInterpolation(NewTime, false, i0, i1);
+  history << "*this = this->Interpolate(Interpolant, NewTime);" << std::endl;
+  Interpolant.Evaluate(NewTime, C.data, i0, i1);
+  frame.swap(C.frame);
+  data.swap(C.data);
+  t.swap(C.t);
+  return *this;
+}
 
-  if(frame.size()!=NTimes()) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
-              << "\nError: GetAlignmentOfDecompositionFrameToModes requires full information about the Waveform's frame."
-              << "\n       This Waveform has " << NTimes() << " time steps, but " << frame.size() << " rotors in its frame data." << std::endl;
+// Make sure the interpolant could have come from this Waveform
+void GWFrames::Waveform::CheckInterpolant(const GWFrames::WaveformInterpolant& Interpolant) const {
+  if(Interpolant.NTimes()!=NTimes() || Interpolant.NModes()!=NModes()
+     || (NTimes()>0 && (Interpolant.T()[0]!=t[0] || Interpolant.T().back()!=t.back()))) {
+    INFOTOCERR << "\nError: The interpolant (NTimes=" << Interpolant.NTimes() << ", NModes=" << Interpolant.NModes() << ")"
+               << "\n       was not constructed from this Waveform (NTimes=" << NTimes() << ", NModes=" << NModes() << ")."
+               << std::endl;
     throw(GWFrames_VectorSizeMismatch);
   }
+}
 
-  // This will be the returned quantity
-  std::vector<Quaternion> R_eps(NTimes());
-
-  // Get direction of angular-velocity vector at each time step, in this frame
-  const vector<Quaternion> omegaHat
-    = Quaternions::inverse(frame)
-    * Quaternions::normalized(Quaternions::QuaternionArray(this->SliceOfTimesWithEll2().AngularVelocityVectorRelativeToInertial())) * frame;
 
-  const vector<vector<double> > V_h = this->LLDominantEigenvector(Lmodes);
+/// Construct the interpolant from a Waveform
+GWFrames::WaveformInterpolant::WaveformInterpolant(const GWFrames::Waveform& W)
+  : t(W.T()), y(W.NModes(), W.NTimes()), c(W.NModes(), W.NTimes())
+{
+  /// \param W Waveform to be interpolated
+  ///
+  /// This computes the natural cubic-spline coefficients (the same
+  /// spline that GSL's `gsl_interp_cspline` uses) for every mode of
+  /// the input Waveform, and stores them contiguously along with a
+  /// copy of the data.  The Waveform can then be interpolated to any
+  /// number of sets of times with `Waveform::Interpolate(Interpolant,
+  /// NewTime)` without redoing this work.
+  ///
+  /// The tridiagonal system for the coefficients depends only on the
+  /// times, so it is factored just once for all modes.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("WaveformInterpolant");
+  SetCoefficients(W.View());
+}
 
-  const unsigned int i_22 = FindModeIndex(2,2);
-  const unsigned int i_2m2 = FindModeIndex(2,-2);
+/// Construct the interpolant from the times and modes of a WaveformView
+GWFrames::WaveformInterpolant::WaveformInterpolant(const GWFrames::WaveformView& W)
+  : t(W.T()), y(W.NModes(), W.NTimes()), c(W.NModes(), W.NTimes())
+{
+  /// \param W View of the Waveform to be interpolated
+  ///
+  /// The spline is the natural spline through the viewed times only,
+  /// so this is the same as constructing the interpolant from the
+  /// `Copy()` of this view, without making that copy first.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("WaveformInterpolant");
+  SetCoefficients(W);
+}
+
+// Copy the data and solve for the spline coefficients
+void GWFrames::WaveformInterpolant::SetCoefficients(const GWFrames::WaveformView& W) {
+  const int n = t.size();
+  const int NModes = W.NModes();
+  if(n<2) {
+    INFOTOCERR << "\nError: Need at least two times to interpolate; W.NTimes()=" << n << "." << std::endl;
+    throw(GWFrames_NotEnoughPointsForDerivative);
+  }
+  for(int i_m=0; i_m<NModes; ++i_m) {
+    std::copy(W(i_m), W(i_m)+n, y[i_m]);
+    c[i_m][0] = 0.0;
+    c[i_m][n-1] = 0.0;
+  }
+  if(n<3) { return; } // Linear interpolation
+
+  // Factor the system (Thomas algorithm) for the interior nodes
+  const int N = n-2;
+  vector<double> h(n-1), cp(N), InvDenom(N);
+  for(int i=0; i<n-1; ++i) {
+    h[i] = t[i+1]-t[i];
+  }
+  for(int k=0; k<N; ++k) {
+    const double diag = 2.0*(h[k]+h[k+1]);
+    const double denom = (k==0 ? diag : diag - h[k]*cp[k-1]);
+    InvDenom[k] = 1.0/denom;
+    cp[k] = h[k+1]*InvDenom[k];
+  }
+
+  // Solve for each mode (in parallel)
+  #pragma omp parallel
+  {
+    vector<complex<double> > dp(N);
+    #pragma omp for schedule(dynamic)
+    for(int i_m=0; i_m<NModes; ++i_m) {
+      const complex<double>* Y = y[i_m];
+      complex<double>* C = c[i_m];
+      for(int k=0; k<N; ++k) {
+        const complex<double> rhs = 3.0*((Y[k+2]-Y[k+1])/h[k+1] - (Y[k+1]-Y[k])/h[k]);
+        dp[k] = (k==0 ? rhs : rhs - h[k]*dp[k-1])*InvDenom[k];
+      }
+      C[N] = dp[N-1];
+      for(int k=N-2; k>=0; --k) {
+        C[k+1] = dp[k] - cp[k]*C[k+2];
+      }
+    }
+  }
+}
+
+#ifndef DOXYGEN
+namespace {
+
+  // Locate x in t, starting from the previous interval i, and find
+  // the weights multiplying y[i], y[i+1], c[i], and c[i+1] to give the
+  // value of the natural spline (as stored by WaveformInterpolant)
+  // at x
+  inline void SplineIntervalWeights(const std::vector<double>& t, const double x, int& i,
+                                    double& W0, double& W1, double& W2, double& W3) {
+    const int n = t.size();
+    if(!(t[i]<=x && x<t[i+1])) { // Usually, the times are in order, so this is rare
+      i = std::upper_bound(t.begin(), t.end(), x) - t.begin() - 1;
+      i = std::max(0, std::min(n-2, i));
+    }
+    const double h = t[i+1]-t[i];
+    const double dx = x-t[i];
+    const double dx2 = dx*dx;
+    const double dx3 = dx2*dx;
+    W1 = dx/h;
+    W0 = 1.0-W1;
+    W2 = -2.0*h*dx/3.0 + dx2 - dx3/(3.0*h);
+    W3 = -h*dx/3.0 + dx3/(3.0*h);
+  }
+
+  // Whether W has every (ell,m) mode from ell=|s| up to its largest
+  // ell, which `RotateDecompositionBasis` needs
+  bool HasCompleteModes(const GWFrames::Waveform& W) {
+    if(W.NModes()==0) { return true; }
+    const int ellMax = W.EllMax();
+    for(int ell=std::abs(W.SpinWeight()); ell<=ellMax; ++ell) {
+      for(int m=-ell; m<=ell; ++m) {
+        if(W.FindModeIndexWithoutError(ell, m)>=W.NModes()) { return false; }
+      }
+    }
+    return true;
+  }
+
+  // A copy of W with every (ell,m) mode from ell=|s| up to its largest
+  // ell, where the missing modes are zero.  Rotations mix modes only
+  // within each ell, so this has the same values at every point.
+  GWFrames::Waveform WithCompleteModes(const GWFrames::Waveform& W) {
+    GWFrames::Waveform C = W.CopyWithoutData();
+    C.SetTime(W.T());
+    C.SetFrame(W.Frame());
+    const int ellMax = W.EllMax();
+    const int NT = W.NTimes();
+    vector<vector<int> > LM;
+    vector<complex<double> > Data;
+    for(int ell=std::abs(W.SpinWeight()); ell<=ellMax; ++ell) {
+      for(int m=-ell; m<=ell; ++m) {
+        LM.push_back(vector<int>(2));
+        LM.back()[0] = ell;
+        LM.back()[1] = m;
+        const unsigned int i_m = W.FindModeIndexWithoutError(ell, m);
+        if(i_m<W.NModes()) {
+          Data.insert(Data.end(), W(i_m), W(i_m)+NT);
+        } else {
+          Data.resize(Data.size()+NT, complex<double>(0.,0.));
+        }
+      }
+    }
+    C.SetLM(LM);
+    C.SetData(Data.empty() ? 0 : &Data[0], LM.size(), NT);
+    return C;
+  }
+
+  // A copy of W whose modes are given in a time-independent frame, so
+  // that they can be interpolated directly.  Missing modes are taken
+  // to be zero, as they are in `EvaluateAtPoint`.
+  GWFrames::Waveform ModesInConstantFrame(const GWFrames::Waveform& W) {
+    GWFrames::Waveform C(HasCompleteModes(W) ? W : WithCompleteModes(W));
+    C.RotateDecompositionBasis(Quaternions::conjugate(W.Frame()));
+    C.SetFrame(vector<Quaternion>(0));
+    return C;
+  }
+
+}
+#endif // DOXYGEN
+
+/// Evaluate the interpolant for all modes at the given times
+void GWFrames::WaveformInterpolant::Evaluate(const std::vector<double>& NewTime, GWFrames::MatrixC& NewData,
+                                             const unsigned int i0, int i1) const {
+  /// \param NewTime Times at which to evaluate the interpolant
+  /// \param NewData Output data matrix, with NModes() rows and NewTime.size() columns
+  /// \param i0 First index of NewTime to evaluate [Default: 0]
+  /// \param i1 One more than the last index of NewTime to evaluate [Default: NewTime.size()]
+  ///
+  /// Only columns `i0` through `i1-1` of `NewData` are set.  Each
+  /// time is located in the original time series just once, and the
+  /// resulting weights are then applied to every mode.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("WaveformInterpolant::Evaluate");
+  if(i1<0) { i1 = NewTime.size(); }
+  if(NewData.nrows()!=int(NModes()) || NewData.ncols()!=int(NewTime.size())) {
+    INFOTOCERR << "\nError: NewData is " << NewData.nrows() << "x" << NewData.ncols()
+               << "; should be " << NModes() << "x" << NewTime.size() << "." << std::endl;
+    throw(GWFrames_MatrixSizeMismatch);
+  }
+  const int n = t.size();
+  const int NT = i1-int(i0);
+  if(NT<=0) { return; }
+
+  // Locate each new time, and find the weights multiplying y[i],
+  // y[i+1], c[i], and c[i+1] to give the spline value there
+  vector<int> Index(NT);
+  vector<double> W0(NT), W1(NT), W2(NT), W3(NT);
+  int i=0;
+  for(int j=0; j<NT; ++j) {
+    const double x = NewTime[i0+j];
+    if(x<t[0] || x>t[n-1]) {
+      INFOTOCERR << "\nError: Asking for extrapolation; we only do interpolation.\n"
+                 << "NewTime[" << i0+j << "]=" << x << "\tt[0]=" << t[0] << "\tt.back()=" << t[n-1] << std::endl;
+      throw(GWFrames_EmptyIntersection);
+    }
+    SplineIntervalWeights(t, x, i, W0[j], W1[j], W2[j], W3[j]);
+    Index[j] = i;
+  }
+
+  // Evaluate for each mode (in parallel)
+  const int NModes = this->NModes();
+  #pragma omp parallel for schedule(static)
+  for(int i_m=0; i_m<NModes; ++i_m) {
+    const complex<double>* Y = y[i_m];
+    const complex<double>* C = c[i_m];
+    complex<double>* D = NewData[i_m]+i0;
+    for(int j=0; j<NT; ++j) {
+      const int k = Index[j];
+      D[j] = W0[j]*Y[k] + W1[j]*Y[k+1] + W2[j]*C[k] + W3[j]*C[k+1];
+    }
+  }
+  return;
+}
+
+/// Construct the evaluator from a Waveform
+GWFrames::WaveformPointInterpolant::WaveformPointInterpolant(const GWFrames::Waveform& W)
+  : spinWeight(W.SpinWeight()), lm(W.LM()), hasConstantFrame(W.Frame().size()==1),
+    frameInverse(W.Frame().size()==1 ? W.Frame()[0].inverse() : Quaternion(1.0, 0.0, 0.0, 0.0)),
+    interpolant(W.Frame().size()>1 ? WaveformInterpolant(ModesInConstantFrame(W)) : WaveformInterpolant(W))
+{
+  /// \param W Waveform to be evaluated
+  ///
+  /// This stores everything needed to evaluate the Waveform at
+  /// arbitrary (direction, time) points: the natural cubic-spline
+  /// coefficients of every mode (as in `WaveformInterpolant`), the
+  /// modes' indices, and the frame.  If the Waveform has a
+  /// time-dependent frame, its modes are first rotated into the
+  /// inertial frame (with any missing modes taken to be zero), so
+  /// that each mode can be interpolated on its own; otherwise, the
+  /// data are used as they are.  The Waveform
+  /// itself is not needed after construction.
+  ///
+  if(W.FrameType() == GWFrames::UnknownFrameType) {
+    INFOTOCERR << "\nWarning: Asking for a Waveform in the " << GWFrames::WaveformFrameNames[GWFrames::UnknownFrameType] << " frame to be evaluated at a point."
+               << "\n         This assumes that the Waveform::frame member data is correct...\n"
+               << std::endl;
+  }
+}
+
+/// Evaluate the Waveform at a list of (vartheta, varphi, t) points
+std::vector<std::complex<double> > GWFrames::WaveformPointInterpolant::Evaluate(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                                                const std::vector<double>& t) const {
+  ///
+  /// \param vartheta Polar angle of each point
+  /// \param varphi Azimuthal angle of each point
+  /// \param t Time of each point
+  ///
+  /// The three inputs must have the same length, and the result has
+  /// one value for each point.  This is meant for evaluating strain
+  /// at many (direction, time) pairs -- e.g., time-delayed arrivals
+  /// at several detectors -- without rebuilding any splines.  The
+  /// SWSH values are computed just once for each distinct direction,
+  /// and the points are then evaluated in parallel, each directly
+  /// from the spline coefficients of every mode.
+  ///
+  /// The result equals
+  /// `W.Interpolate(t).EvaluateAtPoint(vartheta,varphi)` (up to
+  /// roundoff) for Waveforms with no time-dependent frame; for those
+  /// with one, it is the inertial-frame modes that are interpolated.
+  /// Note that `Waveform::InterpolateToPoint` instead uses a 4-point
+  /// spline around each time, so results differ at the level of the
+  /// interpolation error.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("WaveformPointInterpolant::Evaluate");
+  if(vartheta.size()!=varphi.size() || vartheta.size()!=t.size()) {
+    INFOTOCERR << "\nError: (vartheta.size()=" << vartheta.size() << "), (varphi.size()=" << varphi.size() << "),"
+               << " and (t.size()=" << t.size() << ") should all be equal." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  const vector<double>& T = interpolant.t;
+  const int n = T.size();
+  const int NP = t.size();
+  for(int i=0; i<NP; ++i) {
+    if(t[i]<T[0] || t[i]>T[n-1]) {
+      INFOTOCERR << "\nError: Asking for extrapolation; we only do interpolation.\n"
+                 << "t[" << i << "]=" << t[i] << "\tT(0)=" << T[0] << "\tT().back()=" << T[n-1] << std::endl;
+      throw(GWFrames_EmptyIntersection);
+    }
+  }
+  vector<complex<double> > d(NP, complex<double>(0.,0.));
+  if(NP==0) { return d; }
+
+  // Find the distinct directions
+  vector<int> Direction(NP);
+  vector<double> Theta, Phi;
+  {
+    std::map<std::pair<double,double>, int> Directions;
+    for(int i=0; i<NP; ++i) {
+      const std::pair<double,double> Key(vartheta[i], varphi[i]);
+      std::map<std::pair<double,double>, int>::const_iterator it = Directions.find(Key);
+      if(it==Directions.end()) {
+        it = Directions.insert(std::make_pair(Key, int(Theta.size()))).first;
+        Theta.push_back(vartheta[i]);
+        Phi.push_back(varphi[i]);
+      }
+      Direction[i] = it->second;
+    }
+  }
+
+  // Evaluate the SWSHs once for each direction (in parallel), making
+  // sure the singletons used by SWSH are constructed before any
+  // threads need them
+  const int NM = NModes();
+  const int ND = Theta.size();
+  vector<complex<double> > Ylm(ND*NM);
+  { SphericalFunctions::SWSH Y(spinWeight); }
+  #pragma omp parallel
+  {
+    SphericalFunctions::SWSH Y(spinWeight);
+    #pragma omp for schedule(static)
+    for(int i_d=0; i_d<ND; ++i_d) {
+      const Quaternions::Quaternion R_thetaphi(Theta[i_d], Phi[i_d]);
+      Y.SetRotation(hasConstantFrame ? frameInverse*R_thetaphi : R_thetaphi);
+      for(int i_m=0; i_m<NM; ++i_m) {
+        Ylm[i_d*NM+i_m] = Y(lm[i_m][0], lm[i_m][1]);
+      }
+    }
+  }
+
+  // Evaluate at each point (in parallel)
+  const MatrixC& y = interpolant.y;
+  const MatrixC& c = interpolant.c;
+  #pragma omp parallel
+  {
+    int k=0;
+    #pragma omp for schedule(static)
+    for(int i=0; i<NP; ++i) {
+      double W0, W1, W2, W3;
+      SplineIntervalWeights(T, t[i], k, W0, W1, W2, W3);
+      const complex<double>* Y_i = &Ylm[Direction[i]*NM];
+      complex<double> d_i(0.,0.);
+      for(int i_m=0; i_m<NM; ++i_m) {
+        const complex<double>* Y = y[i_m];
+        const complex<double>* C = c[i_m];
+        d_i += (W0*Y[k] + W1*Y[k+1] + W2*C[k] + W3*C[k+1]) * Y_i[i_m];
+      }
+      d[i] = d_i;
+    }
+  }
+  return d;
+}
+
+#ifndef DOXYGEN
+namespace {
+
+  // Largest magnitude of an encoded integer with the given number of bytes
+  double LargestScaledInteger(const int BytesPerValue) {
+    if(BytesPerValue==1) { return 127.0; }
+    if(BytesPerValue==2) { return 32767.0; }
+    return 2147483647.0;
+  }
+
+  template <typename T>
+  void EncodeScaled(const complex<double>* Data, const unsigned int N, const double Scale, char* Bytes) {
+    T* q = reinterpret_cast<T*>(Bytes);
+    const double InvScale = (Scale==0.0 ? 0.0 : 1.0/Scale);
+    for(unsigned int i=0; i<N; ++i) {
+      q[2*i] = T(std::floor(Data[i].real()*InvScale+0.5));
+      q[2*i+1] = T(std::floor(Data[i].imag()*InvScale+0.5));
+    }
+  }
+
+  template <typename T>
+  void DecodeScaled(const char* Bytes, const double Scale, const int i_t_a, const int i_t_b, complex<double>* Data) {
+    const T* q = reinterpret_cast<const T*>(Bytes);
+    for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+      Data[i_t-i_t_a] = complex<double>(Scale*q[2*i_t], Scale*q[2*i_t+1]);
+    }
+  }
+
+}
+#endif // DOXYGEN
+
+/// Encode the data of a Waveform compactly
+GWFrames::CompressedWaveform::CompressedWaveform(const GWFrames::Waveform& W, const GWFrames::CompressedWaveform::StorageType Storage,
+                                                 const double Tolerance)
+  : header(W.CopyWithoutData()), storage(Storage), bytes(W.NModes()), bytesPerValue(W.NModes()),
+    scale(W.NModes(), 0.0), maxError(W.NModes(), 0.0)
+{
+  /// \param W Waveform to be stored
+  /// \param Storage Encoding of the data (see below)
+  /// \param Tolerance Quantization step relative to the largest value in the data (ScaledInteger only)
+  ///
+  /// With `SinglePrecision` storage, the data are simply stored as
+  /// complex<float>, which halves the memory used, and introduces a
+  /// relative error of at most 2^{-24} in each value.
+  ///
+  /// With `ScaledInteger` storage, each mode is stored as integers
+  /// times a step size.  The step is at most `Tolerance` times the
+  /// largest real or imaginary part of any mode, so small modes (like
+  /// the higher-ell modes of typical data) need fewer bits; 1, 2, or
+  /// 4 bytes are used for each real and imaginary part, as required.
+  /// For the default tolerance, a typical waveform with a dominant
+  /// (2,2) mode takes roughly a quarter of the memory of the original.
+  ///
+  /// In either case, `MaxError(i_Mode)` bounds (up to roundoff) the
+  /// absolute error of any decoded value of that mode.  The data can
+  /// be decoded a mode at a time (or a range of times at once) with
+  /// `DecodeMode`, so kernels can work on the compressed data
+  /// directly without expanding the entire Waveform; `Decompress`
+  /// returns an ordinary Waveform.
+
+  header.SetTime(W.T()).SetFrame(W.Frame()).SetLM(W.LM());
+  header.history << "// Data stored in a CompressedWaveform" << std::endl;
+
+  const unsigned int ntimes = W.NTimes();
+  const int nmodes = W.NModes();
+  if(Storage==SinglePrecision) {
+    for(int i_m=0; i_m<nmodes; ++i_m) {
+      bytesPerValue[i_m] = sizeof(float);
+      bytes[i_m].resize(2*sizeof(float)*ntimes);
+      if(bytes[i_m].empty()) { continue; } // No element to take the address of
+      float* f = reinterpret_cast<float*>(&bytes[i_m][0]);
+      double MaxAbs = 0.0;
+      for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+        f[2*i_t] = float(W.Re(i_m, i_t));
+        f[2*i_t+1] = float(W.Im(i_m, i_t));
+        MaxAbs = std::max(MaxAbs, std::abs(W.Data(i_m, i_t)));
+      }
+      maxError[i_m] = 0.5*std::numeric_limits<float>::epsilon()*MaxAbs;
+    }
+    return;
+  }
+
+  if(Tolerance*LargestScaledInteger(4)<1.0 || Tolerance>=1.0) {
+    INFOTOCERR << "\nError: Tolerance=" << Tolerance << " is not in the range [" << 1.0/LargestScaledInteger(4) << ", 1)."
+               << std::endl;
+    throw(GWFrames_ValueError);
+  }
+
+  // Find the largest real or imaginary part in each mode
+  vector<double> ModeMax(nmodes, 0.0);
+  for(int i_m=0; i_m<nmodes; ++i_m) {
+    const complex<double>* Data = W(i_m);
+    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
+      ModeMax[i_m] = std::max(ModeMax[i_m], std::max(std::abs(Data[i_t].real()), std::abs(Data[i_t].imag())));
+    }
+  }
+  const double Step = Tolerance * (nmodes>0 ? *std::max_element(ModeMax.begin(), ModeMax.end()) : 0.0);
+
+  // Choose the smallest integers that will do for each mode, and
+  // then use the finest step those integers allow
+  #pragma omp parallel for schedule(dynamic)
+  for(int i_m=0; i_m<nmodes; ++i_m) {
+    int BytesPerValue = 1;
+    while(BytesPerValue<4 && ModeMax[i_m]>Step*LargestScaledInteger(BytesPerValue)) { BytesPerValue *= 2; }
+    bytesPerValue[i_m] = BytesPerValue;
+    scale[i_m] = ModeMax[i_m]/LargestScaledInteger(BytesPerValue);
+    maxError[i_m] = std::sqrt(0.5)*scale[i_m];
+    bytes[i_m].resize(2*BytesPerValue*ntimes);
+    if(bytes[i_m].empty()) { continue; } // No element to take the address of
+    if(BytesPerValue==1) {
+      EncodeScaled<signed char>(W(i_m), ntimes, scale[i_m], &bytes[i_m][0]);
+    } else if(BytesPerValue==2) {
+      EncodeScaled<int16_t>(W(i_m), ntimes, scale[i_m], &bytes[i_m][0]);
+    } else {
+      EncodeScaled<int32_t>(W(i_m), ntimes, scale[i_m], &bytes[i_m][0]);
+    }
+  }
+}
+
+/// Bound on the absolute error of any decoded value
+double GWFrames::CompressedWaveform::MaxError() const {
+  return (maxError.size()>0 ? *std::max_element(maxError.begin(), maxError.end()) : 0.0);
+}
+
+/// Number of bytes used to store the data
+std::size_t GWFrames::CompressedWaveform::DataBytes() const {
+  std::size_t N = 0;
+  for(unsigned int i_m=0; i_m<bytes.size(); ++i_m) {
+    N += bytes[i_m].size();
+  }
+  return N;
+}
+
+/// Decode the data of one mode over a range of time indices
+void GWFrames::CompressedWaveform::DecodeMode(const unsigned int i_Mode, std::complex<double>* Data,
+                                              const unsigned int i_t_a, int i_t_b) const {
+  /// \param i_Mode Index of the mode to decode
+  /// \param Data Output array, with room for `i_t_b-i_t_a` values
+  /// \param i_t_a Index of the first time to decode
+  /// \param i_t_b Index one past the last time to decode (if negative, NTimes() is used)
+  if(i_t_b<0) { i_t_b = NTimes(); }
+  if(i_Mode>=NModes() || int(i_t_a)>i_t_b || i_t_b>int(NTimes())) {
+    INFOTOCERR << "\nError: Asked for mode " << i_Mode << " and times [" << i_t_a << ", " << i_t_b << ") of a CompressedWaveform"
+               << "\n       with NModes()=" << NModes() << " and NTimes()=" << NTimes() << "." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  if(int(i_t_a)==i_t_b || bytes[i_Mode].empty()) { return; }
+  const char* Bytes = &bytes[i_Mode][0];
+  if(storage==SinglePrecision) {
+    const float* f = reinterpret_cast<const float*>(Bytes);
+    for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+      Data[i_t-i_t_a] = complex<double>(f[2*i_t], f[2*i_t+1]);
+    }
+  } else if(bytesPerValue[i_Mode]==1) {
+    DecodeScaled<signed char>(Bytes, scale[i_Mode], i_t_a, i_t_b, Data);
+  } else if(bytesPerValue[i_Mode]==2) {
+    DecodeScaled<int16_t>(Bytes, scale[i_Mode], i_t_a, i_t_b, Data);
+  } else {
+    DecodeScaled<int32_t>(Bytes, scale[i_Mode], i_t_a, i_t_b, Data);
+  }
+}
+
+/// Decoded data of one mode
+std::vector<std::complex<double> > GWFrames::CompressedWaveform::Data(const unsigned int i_Mode) const {
+  vector<complex<double> > D(NTimes());
+  if(NTimes()>0) { DecodeMode(i_Mode, &D[0]); }
+  return D;
+}
+
+/// Return the norm (sum of squares of modes) of the decoded waveform
+std::vector<double> GWFrames::CompressedWaveform::Norm(const bool TakeSquareRoot) const {
+  /// \param TakeSquareRoot If true, the square root is taken at each instant before returning
+  ///
+  /// The data are decoded in blocks of time steps as they are used,
+  /// so this never holds more than a few thousand decoded values.
+  ///
+  /// \sa Waveform::Norm
+  const int ntimes = NTimes();
+  const int nmodes = NModes();
+  const int BlockSize = 1024;
+  const int NBlocks = (ntimes+BlockSize-1)/BlockSize;
+  vector<double> norm(ntimes, 0.0);
+  #pragma omp parallel
+  {
+    vector<complex<double> > Buffer(BlockSize);
+    #pragma omp for schedule(static)
+    for(int i_block=0; i_block<NBlocks; ++i_block) {
+      const int i_t_a = i_block*BlockSize;
+      const int i_t_b = std::min(ntimes, i_t_a+BlockSize);
+      for(int i_m=0; i_m<nmodes; ++i_m) {
+        DecodeMode(i_m, &Buffer[0], i_t_a, i_t_b);
+        for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+          norm[i_t] += std::norm(Buffer[i_t-i_t_a]);
+        }
+      }
+      if(TakeSquareRoot) {
+        for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+          norm[i_t] = std::sqrt(norm[i_t]);
+        }
+      }
+    }
+  }
+  return norm;
+}
+
+/// Expand the data into an ordinary Waveform
+GWFrames::Waveform GWFrames::CompressedWaveform::Decompress() const {
+  Waveform W(header);
+  W.history << "// Decompressed with MaxError()=" << MaxError() << std::endl;
+  const int nmodes = NModes();
+  W.data.resize(nmodes, NTimes());
+  #pragma omp parallel for schedule(dynamic)
+  for(int i_m=0; i_m<nmodes; ++i_m) {
+    DecodeMode(i_m, W.data[i_m]);
+  }
+  return W;
+}
+
+
+/// Find the appropriate rotations to fix the attitude of the corotating frame.
+std::vector<Quaternions::Quaternion> GWFrames::Waveform::GetAlignmentsOfDecompositionFrameToModes(const std::vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes Lmodes to use in computing \f$<LL>\f$
+  ///
+  /// This function finds the appropriate pre-multiplied rotation
+  /// \f$R_{\varepsilon}\f$ so that the decomposition frame is aligned
+  /// to the waveform.  This particular version finds the appropriate
+  /// \f$R_{\varepsilon}\f$ at each time in the input Waveform.  This
+  /// is useful in cases where we need to try many such alignments,
+  /// because the setup for interpolation is very slow.
+  ///
+  /// Note that this function has no option to choose the direction of
+  /// X based on some nHat vector, as other similar functions have.
+  /// That issue is assumed to be handled elsewhere.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::GetAlignmentsOfDecompositionFrameToModes");
+
+  if(frameType!=GWFrames::Coprecessing && frameType!=GWFrames::Coorbital && frameType!=GWFrames::Corotating) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
+              << "\nError: GetAlignmentOfDecompositionFrameToModes only takes Waveforms in the "
+              << GWFrames::WaveformFrameNames[GWFrames::Coprecessing] << ", "
+              << GWFrames::WaveformFrameNames[GWFrames::Coorbital] << ", or "
+              << GWFrames::WaveformFrameNames[GWFrames::Corotating] << " frames."
+              << "\n       This Waveform is in the " << GWFrames::WaveformFrameNames[frameType] << " frame." << std::endl;
+    throw(GWFrames_WrongFrameType);
+  }
+
+  if(frame.size()!=NTimes()) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
+              << "\nError: GetAlignmentOfDecompositionFrameToModes requires full information about the Waveform's frame."
+              << "\n       This Waveform has " << NTimes() << " time steps, but " << frame.size() << " rotors in its frame data." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  // This will be the returned quantity
+  std::vector<Quaternion> R_eps(NTimes());
+
+  // Get direction of angular-velocity vector at each time step, in this frame
+  const vector<Quaternion> omegaHat
+    = Quaternions::inverse(frame)
+    * Quaternions::normalized(QuaternionsFromArray(this->SliceOfTimesWithEll2().AngularVelocityArrayRelativeToInertial())) * frame;
 
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    // Choose the normalized eigenvector more parallel to omegaHat than anti-parallel
-    const Quaternion V_hi = (omegaHat[i_t].dot(V_h[i_t]) < 0 ? -Quaternions::normalized(V_h[i_t]) : Quaternions::normalized(V_h[i_t]));
+  const vector<vector<double> > V_h = this->LLDominantEigenvector(Lmodes);
 
-    // R_V_hi is the rotor taking the Z axis onto V_hi
-    const Quaternion R_V_hi = Quaternions::sqrtOfRotor(-V_hi*Quaternions::zHat);
+  // Rotating the basis by R_V_hi at a single instant only changes the
+  // ell=2 modes among themselves, so rather than slicing and rotating
+  // a whole Waveform at each instant, we just compute the rotated
+  // (2,+/-2) modes directly.  The instants are independent, so they
+  // are done in parallel, each thread with its own D matrix.
+  vector<unsigned int> i_2(5);
+  for(int mp=-2; mp<=2; ++mp) {
+    i_2[mp+2] = FindModeIndex(2,mp);
+  }
+  { SphericalFunctions::WignerDMatrix D; } // Construct any singletons before the threads need them
+  const int NT = NTimes();
 
-    // Now rotate Instant so that its z axis is aligned with V_f
-    Waveform Instant = this->SliceOfTimeIndicesWithEll2(i_t);
-    Instant.RotateDecompositionBasis(R_V_hi);
+  #pragma omp parallel
+  {
+    SphericalFunctions::WignerDMatrix D;
+    #pragma omp for schedule(static)
+    for(int i_t=0; i_t<NT; ++i_t) {
+      // Choose the normalized eigenvector more parallel to omegaHat than anti-parallel
+      const Quaternion V_hi = (omegaHat[i_t].dot(V_h[i_t]) < 0 ? -Quaternions::normalized(V_h[i_t]) : Quaternions::normalized(V_h[i_t]));
+
+      // R_V_hi is the rotor taking the Z axis onto V_hi
+      const Quaternion R_V_hi = Quaternions::sqrtOfRotor(-V_hi*Quaternions::zHat);
+
+      // Get the (2,+/-2) modes in the basis rotated so that its z axis is aligned with V_hi
+      D.SetRotation(R_V_hi);
+      complex<double> h_22(0.0,0.0), h_2m2(0.0,0.0);
+      for(int mp=-2; mp<=2; ++mp) {
+        const complex<double> h_2mp = data[i_2[mp+2]][i_t];
+        h_22 += D(2,mp,2) * h_2mp;
+        h_2m2 += D(2,mp,-2) * h_2mp;
+      }
 
-    // Get the phase of the (2,+/-2) modes after rotation
-    const double phase_22 = std::atan2(Instant.Im(i_22,0),Instant.Re(i_22,0));
-    const double phase_2m2 = std::atan2(Instant.Im(i_2m2,0),Instant.Re(i_2m2,0));
+      // Get the phase of the (2,+/-2) modes after rotation
+      const double phase_22 = std::atan2(std::imag(h_22),std::real(h_22));
+      const double phase_2m2 = std::atan2(std::imag(h_2m2),std::real(h_2m2));
 
-    // R_eps is the rotation we will be applying on the right-hand side
-    R_eps[i_t] = R_V_hi * Quaternions::exp(Quaternions::Quaternion(0,0,0,(-(phase_22+phase_2m2)/8.)));
+      // R_eps is the rotation we will be applying on the right-hand side
+      R_eps[i_t] = R_V_hi * Quaternions::exp(Quaternions::Quaternion(0,0,0,(-(phase_22+phase_2m2)/8.)));
+    }
   }
 
   return UnflipRotors(R_eps);
@@ -2159,8 +3732,9 @@ Quaternions::Quaternion GWFrames::Waveform::GetAlignmentOfDecompositionFrameToMo
   int i_t_fid = Quaternions::huntRight(t, t_fid);
   unsigned int i1 = (i_t_fid-5<0 ? 0 : i_t_fid-5);
   unsigned int i2 = (i1+11>int(t.size()) ? t.size() : i1+11);
-  const Waveform Region = (this->SliceOfTimeIndicesWithEll2(i1,i2)).TransformToInertialFrame();
-  Quaternion omegaHat = Quaternion(Region.AngularVelocityVector()[i_t_fid-i1]).normalized();
+  Waveform Region = this->SliceOfTimeIndicesWithEll2(i1,i2);
+  Region.TransformToInertialFrame();
+  Quaternion omegaHat = Quaternion(Region.AngularVelocityArray().Row(i_t_fid-i1)).normalized();
   // omegaHat contains the components of that vector relative to the
   // inertial frame.  To get its components in this Waveform's
   // (possibly rotating) frame, we need to rotate it by the inverse
@@ -2176,7 +3750,7 @@ Quaternions::Quaternion GWFrames::Waveform::GetAlignmentOfDecompositionFrameToMo
   }
 
   // Interpolate the Waveform to t_fid
-  Waveform Instant = this->SliceOfTimeIndices(i1,i2).Interpolate(vector<double>(1,t_fid));
+  Waveform Instant = this->ViewOfTimeIndices(i1,i2).Interpolate(vector<double>(1,t_fid));
   const Quaternion R_f0 = Instant.Frame(0);
 
   // V_f is the dominant eigenvector of <LL>, suggested by O'Shaughnessy et al.
@@ -2237,6 +3811,7 @@ GWFrames::Waveform& GWFrames::Waveform::AlignDecompositionFrameToModes(const dou
   /// Lmodes to [2] or [2,3,4], for example, restricts the range of
   /// the sum.
   ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::AlignDecompositionFrameToModes");
 
   // Find the appropriate rotation
   const Quaternion R_eps = GetAlignmentOfDecompositionFrameToModes(t_fid, nHat_t_fid, Lmodes);
@@ -2263,16 +3838,27 @@ public:
   const double t_mid;
   std::vector<Quaternion> R_epsB;
   bool R_epsB_is_set;
+  std::vector<Quaternion> R_fB; // Frame of W_B, restricted to the times we will need
+  std::vector<double> t_B; // Corresponding times of W_B
+  double t_B_min, t_B_max; // Interpolation times covered by R_fB
   mutable unsigned int nHat_B_i; // Just a guess to speed up hunting for the index
   mutable unsigned int Rbar_epsB_i; // Just a guess to speed up hunting for the index
   mutable bool Flip;
+  int Branch; // 1 or 2 to minimize just f1 or f2 below; 0 to minimize the smaller of the two
   const bool Debug;
+  mutable unsigned int NEvaluations; // Number of calls to EvaluateMinimizationQuantity
+  double GradientSteps[4]; // Finite-difference steps in (deltat, deltax, deltay, deltaz)
 public:
   WaveformAligner(const GWFrames::Waveform& W_A, const GWFrames::Waveform& iW_B,
                   const double t_1, const double t_2, const bool iDebug)
     : R_fA(W_A.Frame()), t_A(W_A.T()), W_B(iW_B), t_mid((t_1+t_2)/2.),
-      R_epsB(0), R_epsB_is_set(false), nHat_B_i(0), Rbar_epsB_i(0), Flip(false), Debug(iDebug)
+      R_epsB(0), R_epsB_is_set(false), R_fB(0), t_B(0), t_B_min(0.0), t_B_max(0.0),
+      nHat_B_i(0), Rbar_epsB_i(0), Flip(false), Branch(0), Debug(iDebug), NEvaluations(0)
   {
+    GradientSteps[0] = 1.0e-4;
+    GradientSteps[1] = 1.0e-6;
+    GradientSteps[2] = 1.0e-6;
+    GradientSteps[3] = 1.0e-6;
     // Check to make sure we have sufficient times before any offset.
     // (This is necessary but not sufficient for the method to work.)
     if(t_1<t_A[0]) {
@@ -2327,24 +3913,67 @@ public:
     return;
   }
 
+  // Store the part of W_B's frame needed to interpolate to times in
+  // [t_min,t_max].  Squad only looks at the two input points on
+  // either side of each output time, so -- with a few points of
+  // padding -- interpolating from this piece gives exactly the same
+  // result as interpolating from the whole frame, without walking
+  // through (or multiplying) all of W_B's frame on every call.  This
+  // needs to be called again if W_B's time is changed.
+  void SetInterpolationWindow(const double t_min, const double t_max) {
+    const std::vector<double>& T = W_B.T();
+    const int N = T.size();
+    const int Padding = 3;
+    if(N<2 || W_B.Frame().size()!=T.size() || t_min>t_max) {
+      R_fB.clear();
+      t_B.clear();
+      return;
+    }
+    const int i_min = int(std::upper_bound(T.begin(), T.end(), t_min)-T.begin())-1;
+    const int i_max = int(std::lower_bound(T.begin(), T.end(), t_max)-T.begin());
+    const int i_begin = std::max(0, i_min-Padding);
+    const int i_end = std::min(N-1, i_max+Padding);
+    t_B.assign(T.begin()+i_begin, T.begin()+i_end+1);
+    R_fB.assign(W_B.Frame().begin()+i_begin, W_B.Frame().begin()+i_end+1);
+    t_B_min = t_min;
+    t_B_max = t_max;
+    return;
+  }
+
+  bool WindowContains(const std::vector<double>& t) const {
+    return (t_B.size()>0 && t.size()>0 && t[0]>=t_B_min && t.back()<=t_B_max);
+  }
+
   std::vector<Quaternion> Rbar_fB(const std::vector<double>& t) const {
+    if(WindowContains(t)) {
+      return Quaternions::conjugate(Quaternions::Squad(R_fB, t_B, t));
+    }
     return Quaternions::conjugate(Quaternions::Squad(W_B.Frame(), W_B.T(), t));
   }
 
   Quaternion Rbar_epsB(const double t) const {
+    return Rbar_epsB(t, Rbar_epsB_i);
+  }
+
+  // Thread-safe version, using the caller's guess for the index
+  Quaternion Rbar_epsB(const double t, unsigned int& i_guess) const {
     if(!R_epsB_is_set) {
       std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": R_epsB has not yet been set." << std::endl;
       throw(GWFrames_ValueError);
     }
-    Rbar_epsB_i = Quaternions::hunt(W_B.T(), t, Rbar_epsB_i);
-    return Quaternions::conjugate(R_epsB[Rbar_epsB_i]);
+    i_guess = Quaternions::hunt(W_B.T(), t, i_guess);
+    return Quaternions::conjugate(R_epsB[i_guess]);
   }
 
   double EvaluateMinimizationQuantity(const double deltat, const double deltax, const double deltay, const double deltaz) const {
     using namespace Quaternions; // Allow me to subtract a double from a vector<double> below
+    ++NEvaluations;
     const Quaternions::Quaternion R_eps = W_B.GetAlignmentOfDecompositionFrameToModes(t_mid+deltat, Quaternions::xHat);
     const Quaternions::Quaternion R_delta = Quaternions::exp(Quaternions::Quaternion(0, deltax, deltay, deltaz));
-    const std::vector<Quaternions::Quaternion> R_Bprime = Quaternions::Squad(R_delta * W_B.Frame() * R_eps, W_B.T(), t_A+deltat);
+    const std::vector<double> t_Aprime = t_A+deltat;
+    const std::vector<Quaternions::Quaternion> R_Bprime = (WindowContains(t_Aprime)
+                                                           ? Quaternions::Squad(R_delta * R_fB * R_eps, t_B, t_Aprime)
+                                                           : Quaternions::Squad(R_delta * W_B.Frame() * R_eps, W_B.T(), t_Aprime));
     const unsigned int Size=R_Bprime.size();
     double f1 = 0.0;
     double f2 = 0.0;
@@ -2366,9 +3995,30 @@ public:
       myfile << deltat << " " << f1 << " " << f2 << std::endl;
       myfile.close();
     }
+    if(Branch==1) {
+      Flip = false;
+      return f1;
+    }
+    if(Branch==2) {
+      Flip = true;
+      return f2;
+    }
     Flip = (f2<f1);
     return std::min(f1,f2);
   }
+
+  // Central-difference gradient of the minimization quantity
+  void EvaluateMinimizationGradient(const double* delta, double* gradient) const {
+    for(unsigned int i=0; i<4; ++i) {
+      double deltaplus[4] = {delta[0], delta[1], delta[2], delta[3]};
+      double deltaminus[4] = {delta[0], delta[1], delta[2], delta[3]};
+      deltaplus[i] += GradientSteps[i];
+      deltaminus[i] -= GradientSteps[i];
+      gradient[i] = (EvaluateMinimizationQuantity(deltaplus[0], deltaplus[1], deltaplus[2], deltaplus[3])
+                     - EvaluateMinimizationQuantity(deltaminus[0], deltaminus[1], deltaminus[2], deltaminus[3]))
+        / (2*GradientSteps[i]);
+    }
+  }
 };
 double minfunc (const gsl_vector* delta, void* params) {
   WaveformAligner* Aligner = (WaveformAligner*) params;
@@ -2377,11 +4027,25 @@ double minfunc (const gsl_vector* delta, void* params) {
                                                gsl_vector_get(delta,2),
                                                gsl_vector_get(delta,3));
 }
+void dminfunc (const gsl_vector* delta, void* params, gsl_vector* gradient) {
+  WaveformAligner* Aligner = (WaveformAligner*) params;
+  const double d[4] = {gsl_vector_get(delta,0), gsl_vector_get(delta,1), gsl_vector_get(delta,2), gsl_vector_get(delta,3)};
+  double g[4];
+  Aligner->EvaluateMinimizationGradient(d, g);
+  for(unsigned int i=0; i<4; ++i) {
+    gsl_vector_set(gradient, i, g[i]);
+  }
+}
+void fdminfunc (const gsl_vector* delta, void* params, double* f, gsl_vector* gradient) {
+  *f = minfunc(delta, params);
+  dminfunc(delta, params, gradient);
+}
 #endif // DOXYGEN
 
 /// Do everything necessary to align two waveform objects
 void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
-                              const double t_1, const double t_2, unsigned int InitialEvaluations, std::vector<double> nHat_A, const bool Debug)
+                              const double t_1, const double t_2, unsigned int InitialEvaluations, std::vector<double> nHat_A, const bool Debug,
+                              const bool UseBFGS)
 {
   /// \param W_A Fixed waveform (though modes are re-aligned)
   /// \param W_B Adjusted waveform (modes are re-aligned and frame and time are offset)
@@ -2389,6 +4053,8 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   /// \param t_2 End of alignment interval
   /// \param InitialEvaluations Number of evaluations for dumb initial optimization
   /// \param nHat_A Approximate nHat vector at (t_1+t_2)/2. [optional]
+  /// \param Debug Write the objective function to files in /tmp [default: false]
+  /// \param UseBFGS Refine with BFGS rather than Nelder-Mead [default: false]
   ///
   /// This function aligns the frame to the waveform modes for both
   /// input Waveform objects at time t_mid = (t_1+t_2)/2.  It also
@@ -2422,6 +4088,18 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   /// (Mike Boyle) do hereby guarantee that this algorithm will find
   /// the optimal alignment in both time and attitude.  Or your money
   /// back.
+  ///
+  /// The second stage of the optimization is, by default, done with
+  /// the Nelder-Mead simplex algorithm.  If `UseBFGS` is true, it
+  /// instead uses GSL's BFGS minimizer, with gradients found by
+  /// central differences.  Each gradient costs eight evaluations of
+  /// the objective, but far fewer steps are usually needed.  The
+  /// objective is the smaller of two smooth functions (one for each
+  /// sign of the z axis of `W_B`), which has a kink where they cross,
+  /// so BFGS minimizes each of the two separately, and the better
+  /// result is used.  The number of evaluations of the objective
+  /// function is reported in either case.
+  GWFrames_INSTRUMENT_SCOPE("AlignWaveforms");
 
   if(nHat_A.size()==0) {
     nHat_A = Quaternions::xHat.vec();
@@ -2486,21 +4164,19 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   const std::vector<double>& t_A = Aligner.t_A;
   const std::vector<Quaternions::Quaternion>& R_fA = Aligner.R_fA;
 
-  struct timeval now;
-  gettimeofday(&now, NULL); unsigned long long tNow = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
-
   // First, minimize the dumb way, by just evaluating at every deltat
   // in W_B so that we don't have to interpolate (which takes a *lot*
   // of time).  This should get us a very good estimate of the true
   // minimum.
   {
+    GWFrames_INSTRUMENT_SCOPE("AlignWaveforms (first stage)");
     // R_epsB is an array of R_eps rotors for waveform B, assuming the
     // various deltat values
     Aligner.SetR_epsB(W_B.GetAlignmentsOfDecompositionFrameToModes());
 
     // Evaluate Xi_c for every deltat that won't require interpolating
     // W_B to find R_eps_B (because interpolation is really slow)
-    const GWFrames::Waveform W_B_Interval = W_B.SliceOfTimesWithoutModes(t_mid+deltat_1, t_mid+deltat_2);
+    const GWFrames::WaveformView W_B_Interval = W_B.ViewOfTimesWithoutModes(t_mid+deltat_1, t_mid+deltat_2);
     using namespace GWFrames; // To subtract double from vector<double> below
     vector<double> deltats = W_B_Interval.T()-t_mid;
     if(InitialEvaluations>0 && InitialEvaluations<deltats.size()) { // make sure deltats is small enough
@@ -2512,12 +4188,39 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
       }
       deltats_tmp.swap(deltats);
     }
-    vector<Quaternion> XiIntegral1(deltats.size());
-    vector<Quaternion> XiIntegral2(deltats.size());
-    for(unsigned int i=0; i<XiIntegral1.size(); ++i) {
-      XiIntegral1[i] = Quaternions::DefiniteIntegral(R_fA*Aligner.Rbar_epsB(t_mid+deltats[i])*Aligner.Rbar_fB(t_A+deltats[i]), t_A);
-      XiIntegral2[i] = Quaternions::DefiniteIntegral(R_fA*(-Quaternions::zHat)*Aligner.Rbar_epsB(t_mid+deltats[i])*Aligner.Rbar_fB(t_A+deltats[i]), t_A);
+    if(deltats.size()==0) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": No time offsets to search in W_B." << std::endl;
+      throw(GWFrames_EmptyIntersection);
     }
+    Aligner.SetInterpolationWindow(t_A[0]+deltats[0], t_A.back()+deltats.back());
+    const int NDeltats = deltats.size();
+    vector<Quaternion> XiIntegral1(NDeltats);
+    vector<Quaternion> XiIntegral2(NDeltats);
+    int ErrorCode = 0;
+    #pragma omp parallel
+    {
+      unsigned int i_guess = 0;
+      #pragma omp for schedule(dynamic)
+      for(int i=0; i<NDeltats; ++i) {
+        try {
+          const Quaternion Rbar_epsB = Aligner.Rbar_epsB(t_mid+deltats[i], i_guess);
+          const vector<Quaternion> Rbar_fB = Aligner.Rbar_fB(t_A+deltats[i]);
+          XiIntegral1[i] = Quaternions::DefiniteIntegral(R_fA*Rbar_epsB*Rbar_fB, t_A);
+          XiIntegral2[i] = Quaternions::DefiniteIntegral(R_fA*(-Quaternions::zHat)*Rbar_epsB*Rbar_fB, t_A);
+        } catch(int e) {
+          #pragma omp critical(GWFrames_AlignWaveformsError)
+          {
+            ErrorCode = e;
+          }
+        } catch(...) {
+          #pragma omp critical(GWFrames_AlignWaveformsError)
+          {
+            ErrorCode = GWFrames_UnknownException;
+          }
+        }
+      }
+    }
+    if(ErrorCode) { throw(ErrorCode); }
 
     if(Debug) {
       INFOTOCERR << "\tOutput to /tmp/XiIntegral.dat" << std::endl;
@@ -2558,16 +4261,18 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
     W_B.SetTime(W_B.T()-deltat);
     R_delta = (Flip ? XiIntegral2[i_Xi_c_min].normalized() : XiIntegral1[i_Xi_c_min].normalized());
 
+    // W_B's times have moved, so reset the window for the refinement
+    // below to cover the same range of offsets
+    Aligner.SetInterpolationWindow(t_A[0]+deltats[0]-deltat, t_A.back()+deltats.back()-deltat);
+
     INFOTOCOUT << "Objective function=" << Xi_c_min << " at " << deltat << " with" << (Flip ? " " : " no ") << "flip." << std::endl;
   }
 
-  gettimeofday(&now, NULL); unsigned long long tThen = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
-  INFOTOCOUT << "\tFirst stage took " << (tThen-tNow)/1000000.0L << " seconds." << std::endl;
-
   // Next, minimize algorithmically, in four dimensions, accounting
   // for all adjustments in generality.  This is very slow, but we've
   // gotten a very good initial guess from the dumb way above.
   {
+    GWFrames_INSTRUMENT_SCOPE("AlignWaveforms (second stage)");
     const unsigned int NDimensions = 4;
     const unsigned int MaxIterations = 2000;
     const double MinSimplexSize = 2.0e-9; // This can be less than sqrt(machine precision) because of the integral nature of our objective function
@@ -2604,81 +4309,419 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
       gsl_vector_set(x, 3, NegativeR_delta_log[3]);
     }
 
-    // Set initial step sizes
-    ss = gsl_vector_alloc(NDimensions);
-    gsl_vector_set(ss, 0, InitialTrialTimeStep);
-    gsl_vector_set(ss, 1, InitialTrialAngleStep);
-    gsl_vector_set(ss, 2, InitialTrialAngleStep);
-    gsl_vector_set(ss, 3, InitialTrialAngleStep);
+    // The refinement is done either with Nelder-Mead, or with BFGS
+    // using finite-difference gradients
+    double xMin[NDimensions];
+    double fMin = 0.0;
+    bool ReachedMaxIterations = false;
+    Aligner.GradientSteps[0] = 1.0e-4*InitialTrialTimeStep;
+    Aligner.GradientSteps[1] = 1.0e-4*InitialTrialAngleStep;
+    Aligner.GradientSteps[2] = 1.0e-4*InitialTrialAngleStep;
+    Aligner.GradientSteps[3] = 1.0e-4*InitialTrialAngleStep;
+
+    if(UseBFGS) {
+      const double GradientTolerance = 1.0e-8*(t_2-t_1);
+      gsl_multimin_function_fdf min_func_fdf;
+      min_func_fdf.n = NDimensions;
+      min_func_fdf.f = &minfunc;
+      min_func_fdf.df = &dminfunc;
+      min_func_fdf.fdf = &fdminfunc;
+      min_func_fdf.params = (void*) &Aligner;
+
+      // Minimize each branch of the objective, keeping the better one
+      int BestBranch = 1;
+      for(int Branch=1; Branch<=2; ++Branch) {
+        Aligner.Branch = Branch;
+        size_t iter_branch = 0;
+        status = GSL_CONTINUE;
+
+        gsl_multimin_fdfminimizer* sfdf = gsl_multimin_fdfminimizer_alloc(gsl_multimin_fdfminimizer_vector_bfgs2, NDimensions);
+        gsl_multimin_fdfminimizer_set(sfdf, &min_func_fdf, x, InitialTrialAngleStep, 0.1);
+
+        // Run the minimization
+        while(status == GSL_CONTINUE && iter_branch < MaxIterations) {
+          iter_branch++;
+          status = gsl_multimin_fdfminimizer_iterate(sfdf);
+
+          if(status==GSL_EBADFUNC) {
+            INFOTOCERR << ":\nThe iteration encountered a singular point where the function evaluated to Inf or NaN"
+                       << "\nwhile minimizing at (" << gsl_vector_get(sfdf->x, 0) << ", " << gsl_vector_get(sfdf->x, 1)
+                       << ", " << gsl_vector_get(sfdf->x, 2) << ", " << gsl_vector_get(sfdf->x, 3) << ")." << std::endl;
+          }
 
-    min_func.n = NDimensions;
-    min_func.f = &minfunc;
-    min_func.params = (void*) &Aligner;
+          if(status==GSL_ENOPROG) {
+            // BFGS reports this when the line search can no longer
+            // improve the objective, which is normal at the minimum
+            status = GSL_SUCCESS;
+            break;
+          }
 
-    s = gsl_multimin_fminimizer_alloc(T, NDimensions);
-    gsl_multimin_fminimizer_set(s, &min_func, x, ss);
+          if(status) break;
+          status = gsl_multimin_test_gradient(sfdf->gradient, GradientTolerance);
+        }
 
-    // Run the minimization
-    while(status == GSL_CONTINUE && iter < MaxIterations) {
-      iter++;
-      status = gsl_multimin_fminimizer_iterate(s);
+        if(Branch==1 || sfdf->f<fMin) {
+          for(unsigned int i=0; i<NDimensions; ++i) {
+            xMin[i] = gsl_vector_get(sfdf->x, i);
+          }
+          fMin = sfdf->f;
+          BestBranch = Branch;
+        }
+        gsl_multimin_fdfminimizer_free(sfdf);
 
-      if(status==GSL_EBADFUNC) {
-        INFOTOCERR << ":\nThe iteration encountered a singular point where the function evaluated to Inf or NaN"
-                   << "\nwhile minimizing at (" << gsl_vector_get(s->x, 0) << ", " << gsl_vector_get(s->x, 1)
-                   << ", " << gsl_vector_get(s->x, 2) << ", " << gsl_vector_get(s->x, 3) << ")." << std::endl;
+        if(iter_branch==MaxIterations) { ReachedMaxIterations = true; }
+        iter += iter_branch;
       }
+      Aligner.Branch = BestBranch;
 
-      if(status==GSL_FAILURE) {
-        INFOTOCERR << ":\nThe algorithm could not improve the current best approximation or bounding interval." << std::endl;
-      }
+    } else {
 
-      if(status==GSL_ENOPROG) {
-        INFOTOCERR << ":\nThe minimizer is unable to improve on its current estimate, either due to"
-                   << "\nnumerical difficulty or because a genuine local minimum has been reached." << std::endl;
+      // Set initial step sizes
+      ss = gsl_vector_alloc(NDimensions);
+      gsl_vector_set(ss, 0, InitialTrialTimeStep);
+      gsl_vector_set(ss, 1, InitialTrialAngleStep);
+      gsl_vector_set(ss, 2, InitialTrialAngleStep);
+      gsl_vector_set(ss, 3, InitialTrialAngleStep);
+
+      min_func.n = NDimensions;
+      min_func.f = &minfunc;
+      min_func.params = (void*) &Aligner;
+
+      s = gsl_multimin_fminimizer_alloc(T, NDimensions);
+      gsl_multimin_fminimizer_set(s, &min_func, x, ss);
+
+      // Run the minimization
+      while(status == GSL_CONTINUE && iter < MaxIterations) {
+        iter++;
+        status = gsl_multimin_fminimizer_iterate(s);
+
+        if(status==GSL_EBADFUNC) {
+          INFOTOCERR << ":\nThe iteration encountered a singular point where the function evaluated to Inf or NaN"
+                     << "\nwhile minimizing at (" << gsl_vector_get(s->x, 0) << ", " << gsl_vector_get(s->x, 1)
+                     << ", " << gsl_vector_get(s->x, 2) << ", " << gsl_vector_get(s->x, 3) << ")." << std::endl;
+        }
+
+        if(status==GSL_FAILURE) {
+          INFOTOCERR << ":\nThe algorithm could not improve the current best approximation or bounding interval." << std::endl;
+        }
+
+        if(status==GSL_ENOPROG) {
+          INFOTOCERR << ":\nThe minimizer is unable to improve on its current estimate, either due to"
+                     << "\nnumerical difficulty or because a genuine local minimum has been reached." << std::endl;
+        }
+
+        if(status) break;
+        size = gsl_multimin_fminimizer_size(s);
+        status = gsl_multimin_test_size(size, MinSimplexSize);
       }
+      if(iter==MaxIterations) { ReachedMaxIterations = true; }
 
-      if(status) break;
-      size = gsl_multimin_fminimizer_size(s);
-      status = gsl_multimin_test_size(size, MinSimplexSize);
+      for(unsigned int i=0; i<NDimensions; ++i) {
+        xMin[i] = gsl_vector_get(s->x, i);
+      }
+      fMin = s->fval;
+      gsl_vector_free(ss);
+      gsl_multimin_fminimizer_free(s);
     }
 
-    if(iter==MaxIterations) {
+    if(ReachedMaxIterations) {
       INFOTOCERR << "\nWarning: Minimization ended because it went through " << MaxIterations << " iterations."
                  << "\n         This may indicate failure.  You may want to try with a better initial guess." << std::endl;
     }
 
     // Get time shift and rotation
-    deltat = gsl_vector_get(s->x, 0);
-    R_delta = Quaternions::exp(Quaternions::Quaternion(0.0, gsl_vector_get(s->x, 1), gsl_vector_get(s->x, 2), gsl_vector_get(s->x, 3)));
-    Aligner.EvaluateMinimizationQuantity(gsl_vector_get(s->x,0), gsl_vector_get(s->x,1), gsl_vector_get(s->x,2), gsl_vector_get(s->x,3));
+    deltat = xMin[0];
+    R_delta = Quaternions::exp(Quaternions::Quaternion(0.0, xMin[1], xMin[2], xMin[3]));
+    const unsigned int NEvaluations = Aligner.NEvaluations;
+    Aligner.EvaluateMinimizationQuantity(xMin[0], xMin[1], xMin[2], xMin[3]);
     const bool Flip = Aligner.Flip;
+    Aligner.Branch = 0;
 
-    INFOTOCOUT << "Objective function=" << s->fval << " at " << deltat << std::endl;
+    INFOTOCOUT << "Objective function=" << fMin << " at " << deltat << std::endl;
 
     // Free allocated memory
     gsl_vector_free(x);
-    gsl_vector_free(ss);
-    gsl_multimin_fminimizer_free(s);
 
     // Now, apply the transformations
     W_B.AlignDecompositionFrameToModes(t_mid+deltat, (Flip ? -Quaternions::xHat : Quaternions::xHat));
     W_B.SetTime(W_B.T()-deltat);
     W_B.SetFrame(R_delta*W_B.Frame());
 
-    gettimeofday(&now, NULL); unsigned long long tWhen = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
-    INFOTOCOUT << "\tSecond stage took " << (tWhen-tThen)/1000000.0L << " seconds with " << iter << " iterations." << std::endl;
+    GWFrames_INSTRUMENT_COUNT("AlignWaveforms objective-function evaluations", NEvaluations);
+    INFOTOCOUT << "\tSecond stage took " << iter << " iterations and "
+               << NEvaluations << " objective-function evaluations (" << (UseBFGS ? "BFGS" : "Nelder-Mead") << ")." << std::endl;
   }
 
   return;
 }
 
+#ifndef DOXYGEN
+namespace {
+  // Find the weights w_i such that the constant term of the
+  // least-squares fit of a polynomial of order N in x to any data y
+  // is sum_i w_i y_i.  The columns of the design matrix are
+  // normalized before the SVD (as in `numpy.polyfit`), because the
+  // powers of 1/r differ by many orders of magnitude.  A (of size at
+  // least x.size() by N+1), V (at least N+1 by N+1), and S (at least
+  // N+1) are workspace, so that repeated calls do not allocate.
+  void ExtrapolationWeights(const std::vector<double>& x, const int N,
+                            gsl_matrix* A, gsl_matrix* V, gsl_vector* S, std::vector<double>& w)
+  {
+    const unsigned int NR = x.size();
+    const unsigned int NC = N+1;
+    gsl_matrix_view Av = gsl_matrix_submatrix(A, 0, 0, NR, NC);
+    gsl_matrix_view Vv = gsl_matrix_submatrix(V, 0, 0, NC, NC);
+    gsl_vector_view Sv = gsl_vector_subvector(S, 0, NC);
+    for(unsigned int i_R=0; i_R<NR; ++i_R) {
+      double xk = 1.0;
+      for(unsigned int k=0; k<NC; ++k) {
+        gsl_matrix_set(&Av.matrix, i_R, k, xk);
+        xk *= x[i_R];
+      }
+    }
+    std::vector<double> ColumnNorms(NC, 0.0);
+    for(unsigned int k=0; k<NC; ++k) {
+      for(unsigned int i_R=0; i_R<NR; ++i_R) {
+        ColumnNorms[k] += gsl_matrix_get(&Av.matrix, i_R, k)*gsl_matrix_get(&Av.matrix, i_R, k);
+      }
+      ColumnNorms[k] = std::sqrt(ColumnNorms[k]);
+      if(ColumnNorms[k]==0.0) { ColumnNorms[k] = 1.0; }
+      for(unsigned int i_R=0; i_R<NR; ++i_R) {
+        gsl_matrix_set(&Av.matrix, i_R, k, gsl_matrix_get(&Av.matrix, i_R, k)/ColumnNorms[k]);
+      }
+    }
+    // A = U S V^T, with U overwriting A
+    gsl_linalg_SV_decomp_jacobi(&Av.matrix, &Vv.matrix, &Sv.vector);
+    // Row 0 of the pseudo-inverse V S^{-1} U^T, dropping singular
+    // values below the same tolerance `numpy.polyfit` uses
+    const double Tolerance = NR*std::numeric_limits<double>::epsilon()*gsl_vector_get(&Sv.vector, 0);
+    w.resize(NR);
+    for(unsigned int i_R=0; i_R<NR; ++i_R) {
+      double w_i = 0.0;
+      for(unsigned int k=0; k<NC; ++k) {
+        const double s_k = gsl_vector_get(&Sv.vector, k);
+        if(s_k>Tolerance) {
+          w_i += gsl_matrix_get(&Vv.matrix, 0, k) * gsl_matrix_get(&Av.matrix, i_R, k) / s_k;
+        }
+      }
+      w[i_R] = w_i / ColumnNorms[0];
+    }
+  }
+}
+#endif // DOXYGEN
+
+/// Extrapolate finite-radius Waveforms to infinite radius
+std::vector<GWFrames::Waveform> GWFrames::Extrapolate(const std::vector<GWFrames::Waveform>& FiniteRadiusWaveforms,
+                                                      const std::vector<std::vector<double> >& Radii,
+                                                      const std::vector<int>& ExtrapolationOrders)
+{
+  /// \param FiniteRadiusWaveforms Waveforms extracted at a series of radii, all on the same times and modes
+  /// \param Radii Extraction radius of each Waveform, as a function of time
+  /// \param ExtrapolationOrders Polynomial orders of the fits (a negative order N returns the data at the N-th radius from the end)
+  ///
+  /// At each time and for each mode, the real and imaginary parts of
+  /// the data are fit with a polynomial of order N in 1/r, and the
+  /// constant term of that fit is the extrapolated value.  This gives
+  /// the same results as the `numpy.polyfit` loop previously used in
+  /// `GWFrames/Extrapolation.py`.
+  ///
+  /// That constant term is a fixed linear combination of the data at
+  /// the different radii, which depends only on the radii and N.  So
+  /// the least-squares problem is solved (by SVD) just once per order
+  /// and time step, and the weights are applied to every mode.  If
+  /// the radii do not change from one time step to the next, the
+  /// weights are not recomputed.  Time steps are divided among the
+  /// OpenMP threads in contiguous chunks.
+  ///
+  /// Note that the option of the Python code to scale the radii by
+  /// 1/(m*Omega) is not offered here, because rescaling the
+  /// independent variable does not change the constant term of a
+  /// least-squares polynomial fit.
+  ///
+  /// The input must already be on a common set of times (e.g., using
+  /// `InterpolateInPlace`), with the same modes in the same order.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Extrapolate");
+
+  const int NFiniteRadii = FiniteRadiusWaveforms.size();
+  const int NExtrapolations = ExtrapolationOrders.size();
+  if(NFiniteRadii==0 || NExtrapolations==0) {
+    INFOTOCERR << "\nError: Asking to Extrapolate " << NFiniteRadii << " Waveforms to " << NExtrapolations << " orders." << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  const int MaxN = *std::max_element(ExtrapolationOrders.begin(), ExtrapolationOrders.end());
+  const int MinN = *std::min_element(ExtrapolationOrders.begin(), ExtrapolationOrders.end());
+  const int NTimes = FiniteRadiusWaveforms[0].NTimes();
+  const int NModes = FiniteRadiusWaveforms[0].NModes();
+
+  // Make sure everyone is playing with a full deck
+  if(std::abs(MinN)>NFiniteRadii) {
+    INFOTOCERR << "\nError: Asking for finite-radius waveform " << MinN << ", but only got " << NFiniteRadii
+               << " finite-radius Waveform objects; need at least " << std::abs(MinN) << "." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  if(MaxN>0 && (MaxN+1)>=NFiniteRadii) {
+    INFOTOCERR << "\nError: Asking for extrapolation up to order " << MaxN << ", but only got " << NFiniteRadii
+               << " finite-radius Waveform objects; need at least " << MaxN+2 << "." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  if(int(Radii.size())!=NFiniteRadii) {
+    INFOTOCERR << "\nError: Mismatch in data to be extrapolated; there are different numbers of waveforms and radius vectors."
+               << "\n       FiniteRadiusWaveforms.size()=" << NFiniteRadii << "; Radii.size()=" << Radii.size() << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  for(int i_W=0; i_W<NFiniteRadii; ++i_W) {
+    if(int(FiniteRadiusWaveforms[i_W].NTimes())!=NTimes || int(Radii[i_W].size())!=NTimes) {
+      INFOTOCERR << "\nError: NTimes mismatch in data to be extrapolated."
+                 << "\n       FiniteRadiusWaveforms[0].NTimes()=" << NTimes
+                 << "\n       FiniteRadiusWaveforms[" << i_W << "].NTimes()=" << FiniteRadiusWaveforms[i_W].NTimes()
+                 << "\n       Radii[" << i_W << "].size()=" << Radii[i_W].size() << std::endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+    if(int(FiniteRadiusWaveforms[i_W].NModes())!=NModes) {
+      INFOTOCERR << "\nError: NModes mismatch in data to be extrapolated."
+                 << "\n       FiniteRadiusWaveforms[0].NModes()=" << NModes
+                 << "\n       FiniteRadiusWaveforms[" << i_W << "].NModes()=" << FiniteRadiusWaveforms[i_W].NModes() << std::endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+  }
+
+  // Set up the output data, recording everything but the mode data
+  const Waveform& W_outer = FiniteRadiusWaveforms[NFiniteRadii-1];
+  std::vector<Waveform> ExtrapolatedWaveforms(NExtrapolations);
+  for(int i_N=0; i_N<NExtrapolations; ++i_N) {
+    const int N = ExtrapolationOrders[i_N];
+    if(N<0) {
+      ExtrapolatedWaveforms[i_N] = FiniteRadiusWaveforms[NFiniteRadii+N];
+    } else {
+      { Waveform Copy = W_outer.CopyWithoutData(); ExtrapolatedWaveforms[i_N].swap(Copy); }
+      ExtrapolatedWaveforms[i_N].HistoryStream() << "### Extrapolating with N=" << N << std::endl;
+      ExtrapolatedWaveforms[i_N].SetT(W_outer.T()).SetFrame(W_outer.Frame()).SetLM(W_outer.LM());
+    }
+  }
+  if(MaxN<0) {
+    return ExtrapolatedWaveforms;
+  }
+
+  // Pointers to the rows of data, so that the inner loop need not go
+  // through the Waveform interface
+  std::vector<std::vector<const std::complex<double>*> > In(NModes, std::vector<const std::complex<double>*>(NFiniteRadii));
+  for(int i_m=0; i_m<NModes; ++i_m) {
+    for(int i_W=0; i_W<NFiniteRadii; ++i_W) {
+      In[i_m][i_W] = FiniteRadiusWaveforms[i_W](i_m);
+    }
+  }
+  // The extrapolated data for each order are collected mode by mode
+  // in one array, and then given to the Waveform with `SetData`
+  std::vector<std::vector<std::complex<double> > > OutData(NExtrapolations);
+  std::vector<std::complex<double>*> Out(NExtrapolations*NModes, (std::complex<double>*)0);
+  for(int i_N=0; i_N<NExtrapolations; ++i_N) {
+    if(ExtrapolationOrders[i_N]<0) { continue; }
+    OutData[i_N].resize(std::size_t(NModes)*NTimes);
+    for(int i_m=0; i_m<NModes; ++i_m) {
+      Out[i_N*NModes+i_m] = &OutData[i_N][0] + std::size_t(i_m)*NTimes;
+    }
+  }
+
+  #pragma omp parallel
+  {
+    // Workspace for each thread, reused for every order and time step
+    gsl_matrix* A = gsl_matrix_alloc(NFiniteRadii, MaxN+1);
+    gsl_matrix* V = gsl_matrix_alloc(MaxN+1, MaxN+1);
+    gsl_vector* S = gsl_vector_alloc(MaxN+1);
+    std::vector<double> OneOverRadii(NFiniteRadii), LastOneOverRadii(NFiniteRadii, 0.0);
+    std::vector<std::vector<double> > Weights(NExtrapolations);
+    bool HaveWeights = false;
+    #pragma omp for schedule(static)
+    for(int i_t=0; i_t<NTimes; ++i_t) {
+      for(int i_W=0; i_W<NFiniteRadii; ++i_W) {
+        OneOverRadii[i_W] = 1.0/Radii[i_W][i_t];
+      }
+      if(!HaveWeights || OneOverRadii!=LastOneOverRadii) {
+        for(int i_N=0; i_N<NExtrapolations; ++i_N) {
+          if(ExtrapolationOrders[i_N]>=0) {
+            ExtrapolationWeights(OneOverRadii, ExtrapolationOrders[i_N], A, V, S, Weights[i_N]);
+          }
+        }
+        LastOneOverRadii = OneOverRadii;
+        HaveWeights = true;
+      }
+      for(int i_N=0; i_N<NExtrapolations; ++i_N) {
+        if(ExtrapolationOrders[i_N]<0) { continue; }
+        const double* w = &Weights[i_N][0];
+        for(int i_m=0; i_m<NModes; ++i_m) {
+          const std::complex<double>* const* In_m = &In[i_m][0];
+          std::complex<double> Sum(0.0, 0.0);
+          for(int i_W=0; i_W<NFiniteRadii; ++i_W) {
+            Sum += w[i_W] * In_m[i_W][i_t];
+          }
+          Out[i_N*NModes+i_m][i_t] = Sum;
+        }
+      }
+    }
+    gsl_vector_free(S);
+    gsl_matrix_free(V);
+    gsl_matrix_free(A);
+  }
+
+  for(int i_N=0; i_N<NExtrapolations; ++i_N) {
+    if(ExtrapolationOrders[i_N]<0) { continue; }
+    ExtrapolatedWaveforms[i_N].SetData(OutData[i_N].empty() ? 0 : &OutData[i_N][0], NModes, NTimes);
+    std::vector<std::complex<double> >().swap(OutData[i_N]);
+  }
+
+  return ExtrapolatedWaveforms;
+}
+
+#ifndef DOXYGEN
+namespace {
+  // If t1 and t2 contain exactly the same times over their overlap
+  // (beyond MinTime), with no step smaller than MinStep, return those
+  // times; otherwise, return an empty vector.  In the former case,
+  // that is a better version of what `Intersection` would return,
+  // because it involves no roundoff in the times.
+  vector<double> SharedTimes(const vector<double>& t1, const vector<double>& t2, const double MinStep, const double MinTime) {
+    if(t1.size()==0 || t2.size()==0) { return vector<double>(0); }
+    const double tMin = std::max(std::max(t1[0], t2[0]), MinTime);
+    const double tMax = std::min(t1.back(), t2.back());
+    if(tMin>tMax) { return vector<double>(0); }
+    vector<double>::const_iterator a1 = std::lower_bound(t1.begin(), t1.end(), tMin);
+    vector<double>::const_iterator b1 = std::upper_bound(a1, t1.end(), tMax);
+    vector<double>::const_iterator a2 = std::lower_bound(t2.begin(), t2.end(), tMin);
+    vector<double>::const_iterator b2 = std::upper_bound(a2, t2.end(), tMax);
+    if(b1-a1<2 || b1-a1!=b2-a2 || !std::equal(a1, b1, a2)) { return vector<double>(0); }
+    for(vector<double>::const_iterator it=a1+1; it!=b1; ++it) {
+      if(*it-*(it-1)<MinStep) { return vector<double>(0); }
+    }
+    return vector<double>(a1, b1);
+  }
+
+  // If the times tSub are a contiguous range of the times t, return
+  // the index in t of tSub[0]; otherwise, return -1
+  int SubrangeOffset(const vector<double>& t, const vector<double>& tSub) {
+    if(tSub.size()==0 || tSub.size()>t.size()) { return -1; }
+    const vector<double>::const_iterator a = std::lower_bound(t.begin(), t.end(), tSub[0]);
+    if(a==t.end() || std::size_t(t.end()-a)<tSub.size() || !std::equal(tSub.begin(), tSub.end(), a)) { return -1; }
+    return int(a-t.begin());
+  }
+}
+#endif // DOXYGEN
+
 /// Return a Waveform with differences between the two inputs.
 GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, const double MinTimeStep, const double MinTime) const {
   /// This function simply subtracts the data in this Waveform from
   /// the data in Waveform A, and finds the rotation needed to take
   /// this frame into frame A.  Note that the waveform data are stored
   /// as complex numbers, rather than as modulus and phase.
+  ///
+  /// If the two Waveforms have exactly the same times over their
+  /// overlap (as when one is a slice of the other, or both were set
+  /// to the same times), the output is on those times, and the data
+  /// are simply subtracted, with no interpolation.  Otherwise, the
+  /// output is on their `Intersection`, and each input is
+  /// interpolated only if that is not just a range of its own times,
+  /// as the difference is computed.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Compare");
 
   // Make B a convenient alias for *this
   const GWFrames::Waveform& B = *this;
@@ -2693,7 +4736,7 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
   }
 
   // Make sure we have the same number of modes in the input data
-  if(NModes() != B.NModes()) {
+  if(A.NModes() != B.NModes()) {
     std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Trying to Compare Waveforms with mismatched LM data."
               << "\nA.NModes()=" << A.NModes() << "\tB.NModes()=" << B.NModes() << std::endl;
     throw(GWFrames_WaveformMissingLMIndex);
@@ -2708,8 +4751,17 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
             << "#### B.history.str():\n" << B.history.str()
             << "#### End of old histories from `Compare`" << std::endl;
 
-  // The new time axis will be the intersection of the two old ones
-  C.t = GWFrames::Intersection(A.t, B.t);
+  // The new time axis will be the intersection of the two old ones,
+  // or just their shared times, if they are the same over the overlap
+  C.t = SharedTimes(A.t, B.t, MinTimeStep, MinTime);
+  if(C.t.size()==0) {
+    C.t = GWFrames::Intersection(A.t, B.t, MinTimeStep, MinTime);
+  }
+
+  // Find where the new times are just a range of the old ones, so that
+  // the data need not be interpolated
+  const int i_t_A = SubrangeOffset(A.t, C.t);
+  const int i_t_B = SubrangeOffset(B.t, C.t);
 
   // Copy the basics
   C.frameType = frameType;
@@ -2719,12 +4771,15 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
   // We'll assume that {A.lm}=={B.lm} as sets, and account for
   // disordering below
   C.lm = A.lm;
+  C.lmIndex = A.lmIndex;
 
   // Process the frame, depending on the sizes of the input frames
   if(A.Frame().size()>1 && B.Frame().size()>1) {
     // Find the frames interpolated to the appropriate times
-    const vector<Quaternion> Aframe = Quaternions::Squad(A.frame, A.t, C.t);
-    const vector<Quaternion> Bframe = Quaternions::Squad(B.frame, B.t, C.t);
+    const vector<Quaternion> Aframe = (i_t_A>=0 ? vector<Quaternion>(A.frame.begin()+i_t_A, A.frame.begin()+i_t_A+C.NTimes())
+                                       : Quaternions::Squad(A.frame, A.t, C.t));
+    const vector<Quaternion> Bframe = (i_t_B>=0 ? vector<Quaternion>(B.frame.begin()+i_t_B, B.frame.begin()+i_t_B+C.NTimes())
+                                       : Quaternions::Squad(B.frame, B.t, C.t));
     // Assign the data
     C.frame.resize(C.NTimes());
     for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
@@ -2732,7 +4787,8 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
     }
   } else if(A.Frame().size()==1 && B.Frame().size()>1) {
     // Find the frames interpolated to the appropriate times
-    const vector<Quaternion> Bframe = Quaternions::Squad(B.frame, B.t, C.t);
+    const vector<Quaternion> Bframe = (i_t_B>=0 ? vector<Quaternion>(B.frame.begin()+i_t_B, B.frame.begin()+i_t_B+C.NTimes())
+                                       : Quaternions::Squad(B.frame, B.t, C.t));
     // Assign the data
     C.frame.resize(C.NTimes());
     for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
@@ -2740,7 +4796,8 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
     }
   } else if(A.Frame().size()>1 && B.Frame().size()==1) {
     // Find the frames interpolated to the appropriate times
-    const vector<Quaternion> Aframe = Quaternions::Squad(A.frame, A.t, C.t);
+    const vector<Quaternion> Aframe = (i_t_A>=0 ? vector<Quaternion>(A.frame.begin()+i_t_A, A.frame.begin()+i_t_A+C.NTimes())
+                                       : Quaternions::Squad(A.frame, A.t, C.t));
     // Assign the data
     C.frame.resize(C.NTimes());
     for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
@@ -2771,52 +4828,79 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
     }
   }
 
-  // Reserve space for the data
-  C.data.resize(C.lm.size(), C.t.size());
-  // Construct the GSL interpolators for the data
-  gsl_interp_accel* accReA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accReB = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImB = gsl_interp_accel_alloc();
-  gsl_spline* splineReA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineImA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineReB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
-  gsl_spline* splineImB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
+  // Assume that all the ell,m data are the same, but not necessarily in the same order
+  const int NModes = A.NModes();
+  const int NTimes = C.NTimes();
+  vector<unsigned int> BModes(NModes);
+  for(int Mode=0; Mode<NModes; ++Mode) {
+    BModes[Mode] = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
+  }
 
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int Mode=0; Mode<A.NModes(); ++Mode) {
-    // Assume that all the ell,m data are the same, but not necessarily in the same order
-    const unsigned int BMode = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> ReA = A.Re(Mode);
-    const vector<double> ImA = A.Im(Mode);
-    const vector<double> ReB = B.Re(BMode);
-    const vector<double> ImB = B.Im(BMode);
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineReA, &(A.t)[0], &ReA[0], A.NTimes());
-    gsl_spline_init(splineImA, &(A.t)[0], &ImA[0], A.NTimes());
-    gsl_spline_init(splineReB, &(B.t)[0], &ReB[0], B.NTimes());
-    gsl_spline_init(splineImB, &(B.t)[0], &ImB[0], B.NTimes());
-    // Assign the data from the transition
-    for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
-      C.data[Mode][i_t] = complex<double>( gsl_spline_eval(splineReA, C.t[i_t], accReA), gsl_spline_eval(splineImA, C.t[i_t], accImA) )
-        - complex<double>( gsl_spline_eval(splineReB, C.t[i_t], accReB), gsl_spline_eval(splineImB, C.t[i_t], accImB) );
+  // Now loop over each mode filling in the waveform data, taking the
+  // data directly from the input where possible, and otherwise
+  // interpolating it at each time as the difference is taken.  The
+  // modes are independent, so each thread gets its own splines.
+  C.data.resize(NModes, NTimes);
+  #pragma omp parallel
+  {
+    gsl_interp_accel* accReA = gsl_interp_accel_alloc();
+    gsl_interp_accel* accImA = gsl_interp_accel_alloc();
+    gsl_interp_accel* accReB = gsl_interp_accel_alloc();
+    gsl_interp_accel* accImB = gsl_interp_accel_alloc();
+    gsl_spline* splineReA = (i_t_A<0 ? gsl_spline_alloc(gsl_interp_cspline, A.NTimes()) : 0);
+    gsl_spline* splineImA = (i_t_A<0 ? gsl_spline_alloc(gsl_interp_cspline, A.NTimes()) : 0);
+    gsl_spline* splineReB = (i_t_B<0 ? gsl_spline_alloc(gsl_interp_cspline, B.NTimes()) : 0);
+    gsl_spline* splineImB = (i_t_B<0 ? gsl_spline_alloc(gsl_interp_cspline, B.NTimes()) : 0);
+    #pragma omp for schedule(dynamic)
+    for(int Mode=0; Mode<NModes; ++Mode) {
+      const unsigned int BMode = BModes[Mode];
+      complex<double>* Data = C.data[Mode];
+      if(i_t_A>=0) {
+        const complex<double>* DataA = A.data[Mode]+i_t_A;
+        for(int i_t=0; i_t<NTimes; ++i_t) {
+          Data[i_t] = DataA[i_t];
+        }
+      } else {
+        // Extract the real and imaginary parts of the data separately for GSL
+        const vector<double> ReA = A.Re(Mode);
+        const vector<double> ImA = A.Im(Mode);
+        GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 2);
+        gsl_spline_init(splineReA, &(A.t)[0], &ReA[0], A.NTimes());
+        gsl_spline_init(splineImA, &(A.t)[0], &ImA[0], A.NTimes());
+        gsl_interp_accel_reset(accReA);
+        gsl_interp_accel_reset(accImA);
+        for(int i_t=0; i_t<NTimes; ++i_t) {
+          Data[i_t] = complex<double>( gsl_spline_eval(splineReA, C.t[i_t], accReA), gsl_spline_eval(splineImA, C.t[i_t], accImA) );
+        }
+      }
+      if(i_t_B>=0) {
+        const complex<double>* DataB = B.data[BMode]+i_t_B;
+        for(int i_t=0; i_t<NTimes; ++i_t) {
+          Data[i_t] -= DataB[i_t];
+        }
+      } else {
+        const vector<double> ReB = B.Re(BMode);
+        const vector<double> ImB = B.Im(BMode);
+        GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 2);
+        gsl_spline_init(splineReB, &(B.t)[0], &ReB[0], B.NTimes());
+        gsl_spline_init(splineImB, &(B.t)[0], &ImB[0], B.NTimes());
+        gsl_interp_accel_reset(accReB);
+        gsl_interp_accel_reset(accImB);
+        for(int i_t=0; i_t<NTimes; ++i_t) {
+          Data[i_t] -= complex<double>( gsl_spline_eval(splineReB, C.t[i_t], accReB), gsl_spline_eval(splineImB, C.t[i_t], accImB) );
+        }
+      }
     }
-    gsl_interp_accel_reset(accReA);
-    gsl_interp_accel_reset(accImA);
-    gsl_interp_accel_reset(accReB);
-    gsl_interp_accel_reset(accImB);
+    gsl_interp_accel_free(accReA);
+    gsl_interp_accel_free(accImA);
+    gsl_interp_accel_free(accReB);
+    gsl_interp_accel_free(accImB);
+    if(splineReA) { gsl_spline_free(splineReA); }
+    if(splineImA) { gsl_spline_free(splineImA); }
+    if(splineReB) { gsl_spline_free(splineReB); }
+    if(splineImB) { gsl_spline_free(splineImB); }
   }
 
-  gsl_interp_accel_free(accReA);
-  gsl_interp_accel_free(accImA);
-  gsl_interp_accel_free(accReB);
-  gsl_interp_accel_free(accImB);
-  gsl_spline_free(splineReA);
-  gsl_spline_free(splineImA);
-  gsl_spline_free(splineReB);
-  gsl_spline_free(splineImB);
-
   return C;
 }
 
@@ -2847,6 +4931,7 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
   ///
   /// Note that this function does NOT operate in place; a new
   /// Waveform object is constructed and returned.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Hybridize");
 
   // Make A a convenient alias
   const GWFrames::Waveform& A = *this;
@@ -2931,6 +5016,7 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
   C.t = GWFrames::Union(A.t, B.t, tMinStep);
   // We'll assume that A.lm==B.lm, though we'll account for disordering below
   C.lm = A.lm;
+  C.lmIndex = A.lmIndex;
   // Make sure the time stops at the end of B's time (in case A extended further)
   int i_t=C.t.size()-1;
   while(C.T(i_t)>B.t.back() && i_t>0) { --i_t; }
@@ -2979,6 +5065,7 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
     const vector<double> ReB = B.Re(BMode);
     const vector<double> ImB = B.Im(BMode);
     // Initialize the interpolators for this data set
+    GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 4);
     gsl_spline_init(splineReA, &(A.t)[0], &ReA[0], A.NTimes());
     gsl_spline_init(splineImA, &(A.t)[0], &ImA[0], A.NTimes());
     gsl_spline_init(splineReB, &(B.t)[0], &ReB[0], B.NTimes());
@@ -3028,13 +5115,9 @@ std::vector<std::complex<double> > GWFrames::Waveform::EvaluateAtPoint(const dou
   /// Waveforms in rotating frames, without first rotating the
   /// Waveform into the inertial frame.  This saves significant
   /// computational cost.
+  /// \sa WaveformView::EvaluateAtPoint
   ///
 
-  if(frameType == GWFrames::UnknownFrameType) {
-    INFOTOCERR << "\nWarning: Asking for a Waveform in the " << GWFrames::WaveformFrameNames[GWFrames::UnknownFrameType] << " frame to be evaluated at a point."
-               << "\n         This assumes that the Waveform::frame member data is correct...\n"
-               << std::endl;
-  }
   if(i_1==-1) {
     i_1 = NTimes();
   }
@@ -3048,9 +5131,38 @@ std::vector<std::complex<double> > GWFrames::Waveform::EvaluateAtPoint(const dou
     throw(GWFrames_IndexOutOfBounds);
   }
 
+  // Build the view of exactly [i_0,i_1) directly, rather than with
+  // `ViewOfTimeIndices`, which has its own convention for i_t_b==0
+  vector<unsigned int> Modes(NModes());
+  for(unsigned int i_m=0; i_m<Modes.size(); ++i_m) {
+    Modes[i_m] = i_m;
+  }
+  return WaveformView(*this, i_0, i_1, Modes).EvaluateAtPoint(vartheta, varphi);
+}
+
+/// Evaluate the viewed data at a particular sky location
+std::vector<std::complex<double> > GWFrames::WaveformView::EvaluateAtPoint(const double vartheta, const double varphi) const {
+  ///
+  /// \param vartheta Polar angle of detector
+  /// \param varphi Azimuthal angle of detector
+  ///
+  /// Only the modes in the view contribute to the sum.  As with
+  /// `Waveform::EvaluateAtPoint`, rotating frames are accounted for
+  /// automatically.
+  ///
+  /// \sa Waveform::EvaluateAtPoint
+
+  if(W->frameType == GWFrames::UnknownFrameType) {
+    INFOTOCERR << "\nWarning: Asking for a Waveform in the " << GWFrames::WaveformFrameNames[GWFrames::UnknownFrameType] << " frame to be evaluated at a point."
+               << "\n         This assumes that the Waveform::frame member data is correct...\n"
+               << std::endl;
+  }
+
   const int NM = NModes();
+  const int NT = NTimes();
+  const vector<Quaternion>& frame = W->frame;
 
-  vector<complex<double> > d(i_1-i_0, complex<double>(0.,0.)); // Be sure to initialize to 0.0
+  vector<complex<double> > d(NT, complex<double>(0.,0.)); // Be sure to initialize to 0.0
   const Quaternions::Quaternion R_thetaphi(vartheta, varphi);
   SphericalFunctions::SWSH Y(SpinWeight()); // Y can be evaluated in terms of a unit quaternion
 
@@ -3064,17 +5176,18 @@ std::vector<std::complex<double> > GWFrames::Waveform::EvaluateAtPoint(const dou
       const int ell = LM(i_m)[0];
       const int m   = LM(i_m)[1];
       const complex<double> Ylm = Y(ell,m);
-      for(int i_t=i_0; i_t<i_1; ++i_t) {
-        d[i_t-i_0] += Data(i_m, i_t) * Ylm;
+      const complex<double>* Data = (*this)(i_m);
+      for(int i_t=0; i_t<NT; ++i_t) {
+        d[i_t] += Data[i_t] * Ylm;
       }
     }
   } else {
-    for(unsigned int i_t=i_0; i_t<i_1; ++i_t) {
-      Y.SetRotation(frame[i_t].inverse()*R_thetaphi);
+    for(int i_t=0; i_t<NT; ++i_t) {
+      Y.SetRotation(frame[i_t_a+i_t].inverse()*R_thetaphi);
       for(int i_m=0; i_m<NM; ++i_m) {
         const int ell = LM(i_m)[0];
         const int m   = LM(i_m)[1];
-        d[i_t-i_0] += Data(i_m, i_t) * Y(ell,m);
+        d[i_t] += Data(i_m, i_t) * Y(ell,m);
       }
     }
   }
@@ -3082,6 +5195,227 @@ std::vector<std::complex<double> > GWFrames::Waveform::EvaluateAtPoint(const dou
   return d;
 }
 
+/// Evaluate Waveform at a list of sky locations
+std::vector<std::vector<std::complex<double> > > GWFrames::Waveform::EvaluateAtPoints(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                                                     const unsigned int i_0, int i_1) const {
+  ///
+  /// \param vartheta Polar angles of detectors
+  /// \param varphi Azimuthal angles of detectors
+  /// \param i_0 Optional initial index to evaluate
+  /// \param i_1 Optional one-past-final index to evaluate
+  ///
+  /// This returns the same values as calling `EvaluateAtPoint` for
+  /// each direction, as a directions-by-times array, but is much
+  /// faster for many directions.  The SWSH values are evaluated just
+  /// once per direction, and the result is then a dense product of
+  /// that (directions-by-modes) matrix with the (modes-by-times)
+  /// data.  Waveforms in a time-dependent rotating frame are first
+  /// rotated into the inertial frame over the requested times (one
+  /// Wigner-D matrix per time step) so that the same product applies;
+  /// if any (ell,m) mode is missing, so that the modes can't be
+  /// rotated, the SWSHs are evaluated at each time step instead.
+  ///
+  /// \sa EvaluateAtPoint
+
+  if(vartheta.size()!=varphi.size()) {
+    INFOTOCERR << "\nError: (vartheta.size()=" << vartheta.size() << ") != (varphi.size()=" << varphi.size() << ")." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  if(frameType == GWFrames::UnknownFrameType) {
+    INFOTOCERR << "\nWarning: Asking for a Waveform in the " << GWFrames::WaveformFrameNames[GWFrames::UnknownFrameType] << " frame to be evaluated at a point."
+               << "\n         This assumes that the Waveform::frame member data is correct...\n"
+               << std::endl;
+  }
+  if(i_1==-1) {
+    i_1 = NTimes();
+  }
+  if(i_0>=i_1) {
+    INFOTOCERR << "\nError: Asking to EvaluateAtPoints on indices (i_0=" << i_0 << ") >= (i_1=" << i_1 << ")."
+               << "\n       This is impossible; i_1 should be at least 1 more than i_0." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  if(i_1>NTimes()) {
+    INFOTOCERR << "\nError: Asking to EvaluateAtPoints on indices [i_0,i_1)=[" << i_0 << "," << i_1 << ") in a Waveform with " << NTimes() << " time steps." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+
+  // For a time-dependent frame, get the inertial-frame modes on just
+  // the requested times; otherwise use the data directly.  If some
+  // modes are missing, the basis can't be rotated, so the SWSHs are
+  // instead evaluated at each time step, as in `EvaluateAtPoint`.
+  Waveform Inertial;
+  const Waveform* W = this;
+  unsigned int j_0 = i_0;
+  const bool EvaluateEachTime = (frame.size()>1 && !HasCompleteModes(*this));
+  if(frame.size()>1 && !EvaluateEachTime) {
+    { Waveform Slice = SliceOfTimeIndices(i_0, i_1); Inertial.swap(Slice); }
+    Inertial.RotateDecompositionBasis(Quaternions::conjugate(Inertial.frame));
+    Inertial.frame = vector<Quaternion>(0);
+    W = &Inertial;
+    j_0 = 0;
+  }
+
+  const int NM = NModes();
+  const int ND = vartheta.size();
+  const int NT = i_1-i_0;
+  vector<vector<complex<double> > > d(ND, vector<complex<double> >(NT, complex<double>(0.,0.)));
+  if(ND==0) { return d; }
+
+  // Make sure the singletons used by SWSH are constructed before any
+  // threads need them
+  { SphericalFunctions::SWSH Y(SpinWeight()); }
+  #pragma omp parallel
+  {
+    SphericalFunctions::SWSH Y(SpinWeight());
+    vector<complex<double> > Ylm(NM);
+    #pragma omp for schedule(static)
+    for(int i_d=0; i_d<ND; ++i_d) {
+      const Quaternions::Quaternion R_thetaphi(vartheta[i_d], varphi[i_d]);
+      if(EvaluateEachTime) {
+        complex<double>* d_i = &d[i_d][0];
+        for(int i_t=0; i_t<NT; ++i_t) {
+          Y.SetRotation(frame[i_0+i_t].inverse()*R_thetaphi);
+          for(int i_m=0; i_m<NM; ++i_m) {
+            d_i[i_t] += data[i_m][i_0+i_t] * Y(LM(i_m)[0], LM(i_m)[1]);
+          }
+        }
+        continue;
+      }
+      if(frame.size()==1) {
+        Y.SetRotation(frame[0].inverse()*R_thetaphi);
+      } else {
+        Y.SetRotation(R_thetaphi);
+      }
+      for(int i_m=0; i_m<NM; ++i_m) {
+        Ylm[i_m] = Y(LM(i_m)[0], LM(i_m)[1]);
+      }
+      complex<double>* d_i = &d[i_d][0];
+      for(int i_m=0; i_m<NM; ++i_m) {
+        const complex<double> Y_i = Ylm[i_m];
+        const complex<double>* Data_i = (*W)(i_m)+j_0;
+        for(int i_t=0; i_t<NT; ++i_t) {
+          d_i[i_t] += Data_i[i_t] * Y_i;
+        }
+      }
+    }
+  }
+
+  return d;
+}
+
+/// Interpolate to new times and evaluate at a sky location, without storing the interpolated modes
+std::vector<std::complex<double> > GWFrames::Waveform::InterpolateAtPoint(const std::vector<double>& NewTime, const double vartheta, const double varphi,
+                                                                          const bool AllowTimesOutsideCurrentDomain, const unsigned int ChunkSize) const {
+  ///
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param vartheta Polar angle of detector
+  /// \param varphi Azimuthal angle of detector
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  /// \param ChunkSize [Default: 16384] Number of times interpolated at once
+  ///
+  /// This is equivalent to
+  /// `Interpolate(NewTime,AllowTimesOutsideCurrentDomain).EvaluateAtPoint(vartheta,varphi)`,
+  /// but the interpolated modes are only ever stored for `ChunkSize`
+  /// times at a time, so that the memory needed is dominated by the
+  /// returned scalar time series and the spline coefficients on the
+  /// original times.
+  ///
+  /// The interpolant is only built over the times spanning
+  /// `NewTime`, plus a margin on each side.
+  ///
+  /// \sa WaveformInterpolant, for the version of this function
+  /// taking an interpolant, which can be reused.
+  ///
+  if(NewTime.size()==0) {
+    INFOTOCERR << ": Asking for empty Waveform." << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  // The end conditions of a natural spline change its coefficients by
+  // a factor of about 2-sqrt(3) less at each node away from the end,
+  // so this margin makes the spline on the window indistinguishable
+  // (at double precision) from the spline on all the times
+  const int Margin = 32;
+  const int n = NTimes();
+  const int j_a = std::max(0, int(std::upper_bound(t.begin(), t.end(), NewTime[0])-t.begin())-1-Margin);
+  const int j_b = std::min(n, int(std::lower_bound(t.begin(), t.end(), NewTime.back())-t.begin())+1+Margin);
+  const WaveformView Window = ViewOfTimeIndices(j_a, j_b);
+  const WaveformInterpolant Interpolant(Window);
+  return Window.InterpolateAtPointInChunks(Interpolant, NewTime, vartheta, varphi, AllowTimesOutsideCurrentDomain, ChunkSize);
+}
+
+/// Interpolate to new times and evaluate at a sky location, without storing the interpolated modes
+std::vector<std::complex<double> > GWFrames::Waveform::InterpolateAtPoint(const GWFrames::WaveformInterpolant& Interpolant, const std::vector<double>& NewTime,
+                                                                          const double vartheta, const double varphi,
+                                                                          const bool AllowTimesOutsideCurrentDomain, const unsigned int ChunkSize) const {
+  ///
+  /// \param Interpolant Interpolant constructed from this Waveform
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param vartheta Polar angle of detector
+  /// \param varphi Azimuthal angle of detector
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  /// \param ChunkSize [Default: 16384] Number of times interpolated at once
+  ///
+  /// Chunks lying entirely outside the current domain are just set
+  /// to zero (if `AllowTimesOutsideCurrentDomain` is true).
+  ///
+  CheckInterpolant(Interpolant);
+  return View().InterpolateAtPointInChunks(Interpolant, NewTime, vartheta, varphi, AllowTimesOutsideCurrentDomain, ChunkSize);
+}
+
+// Interpolate to new times in chunks and evaluate at a sky location,
+// given an interpolant constructed from this view
+std::vector<std::complex<double> > GWFrames::WaveformView::InterpolateAtPointInChunks(const GWFrames::WaveformInterpolant& Interpolant,
+                                                                                      const std::vector<double>& NewTime,
+                                                                                      const double vartheta, const double varphi,
+                                                                                      const bool AllowTimesOutsideCurrentDomain,
+                                                                                      const unsigned int ChunkSize) const {
+  /// \sa Waveform::InterpolateAtPoint
+  GWFrames_INSTRUMENT_SCOPE("Waveform::InterpolateAtPoint");
+  if(NewTime.size()==0) {
+    INFOTOCERR << ": Asking for empty Waveform." << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  if(ChunkSize==0) {
+    INFOTOCERR << "\nError: ChunkSize must be positive." << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  const unsigned int N = NewTime.size();
+  const int n = NTimes();
+  const vector<double>::const_iterator t_a = W->t.begin()+i_t_a;
+  const vector<double>::const_iterator t_b = W->t.begin()+i_t_b;
+  const double t0 = T(0);
+  const double tN = T(n-1);
+  vector<complex<double> > d(N, complex<double>(0.,0.));
+  for(unsigned int i_a=0; i_a<N; i_a+=ChunkSize) {
+    const unsigned int i_b = std::min(N, i_a+ChunkSize);
+    if(AllowTimesOutsideCurrentDomain && (NewTime[i_b-1]<t0 || NewTime[i_a]>tN)) {
+      continue;
+    }
+    const vector<double> ChunkTime(NewTime.begin()+i_a, NewTime.begin()+i_b);
+    // The frame is only interpolated over the times spanning this
+    // chunk, plus the two steps on each side that Squad uses for the
+    // intermediate rotors at the ends
+    const int j_a = std::max(0, int(std::upper_bound(t_a, t_b, ChunkTime[0])-t_a)-3);
+    const int j_b = std::min(n, int(std::lower_bound(t_a, t_b, ChunkTime.back())-t_a)+3);
+    const WaveformView Window(*W, i_t_a+j_a, i_t_a+j_b, modes);
+    unsigned int i0, i1;
+    Waveform C = Window.CopyForInterpolation(ChunkTime, AllowTimesOutsideCurrentDomain, i0, i1);
+    const unsigned int i2 = ChunkTime.size();
+    for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
+      for(unsigned int i_t=0; i_t<i0; ++i_t) {
+        C.data[i_m][i_t] = complex<double>( 0., 0. );
+      }
+      for(unsigned int i_t=i1; i_t<i2; ++i_t) {
+        C.data[i_m][i_t] = complex<double>( 0., 0. );
+      }
+    }
+    Interpolant.Evaluate(ChunkTime, C.data, i0, i1);
+    const vector<complex<double> > d_chunk = C.EvaluateAtPoint(vartheta, varphi);
+    std::copy(d_chunk.begin(), d_chunk.end(), d.begin()+i_a);
+  }
+  return d;
+}
+
 /// Evaluate Waveform at a particular sky location and an instant of time
 std::complex<double> GWFrames::Waveform::InterpolateToPoint(const double vartheta, const double varphi, const double t_i,
                                                             gsl_interp_accel* accRe, gsl_interp_accel* accIm, gsl_spline* splineRe, gsl_spline* splineIm) const {
@@ -3098,6 +5432,9 @@ std::complex<double> GWFrames::Waveform::InterpolateToPoint(const double varthet
   ///
   /// Pointers to GSL interpolation objects can be passed in, which
   /// eliminates the need to re-allocate them for each interpolation.
+  ///
+  /// \sa WaveformPointInterpolant, to evaluate at many points
+  /// without rebuilding any splines.
 
   bool ThisFunctionOwnsThePointers = (accRe==0);
 
@@ -3143,6 +5480,7 @@ std::complex<double> GWFrames::Waveform::InterpolateToPoint(const double varthet
     splineRe = gsl_spline_alloc(gsl_interp_cspline, dRe.size());
     splineIm = gsl_spline_alloc(gsl_interp_cspline, dIm.size());
   }
+  GWFrames_INSTRUMENT_COUNT("gsl_spline_init", 2);
   gsl_spline_init(splineRe, &(t)[i_t_0], &dRe[0], dRe.size());
   gsl_spline_init(splineIm, &(t)[i_t_0], &dIm[0], dIm.size());
   const complex<double> value( gsl_spline_eval(splineRe, t_i, accRe), gsl_spline_eval(splineIm, t_i, accIm) );
@@ -3156,6 +5494,17 @@ std::complex<double> GWFrames::Waveform::InterpolateToPoint(const double varthet
   return value;
 }
 
+#ifndef DOXYGEN
+namespace {
+  // The first index of the NStencil-point stencil that
+  // Waveform::InterpolateToPoint would use to interpolate to t_i
+  inline int StencilStart(const std::vector<double>& t, const double t_i, const int NStencil) {
+    const int i = int(std::upper_bound(t.begin(), t.end(), t_i) - t.begin()) - 1;
+    return std::min(std::max(i-(NStencil/2-1), 0), int(t.size())-NStencil);
+  }
+}
+#endif // DOXYGEN
+
 /// Translate the waveform data by some series of spatial translations
 GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<double> >& deltax) const {
   /// \param deltax Array of 3-vectors by which to translate (function of time)
@@ -3171,11 +5520,17 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   /// more expensive to transform it first.  (Basically, try not to
   /// bother transforming the Waveform before calling this function.)
   ///
-  /// This function is very slow because it has to interpolate to
-  /// NTimes*(2*ellMax+1)^2 different completely unique points.  Since
-  /// interpolation is so slow, this takes a lot of time.  The
-  /// function also has to transform back from physical space to
-  /// modes, which is another significant chunk of time.
+  /// The data must be interpolated to NTimes*(2*ellMax+1)^2 different
+  /// completely unique points.  To make this fast, the waveform is
+  /// first evaluated on the fixed equi-angular grid at the original
+  /// times (for a block of times at once), and then each grid point
+  /// is interpolated in time with the same 4-point cubic splines as
+  /// `InterpolateToPoint`, using weights that are precomputed once per
+  /// stencil and shared by all grid points.  The output time steps
+  /// are independent, so they are computed in parallel, and the
+  /// transformations back to modes use the cached spinsfast
+  /// workspaces of `SpinsfastWorkspaceLease`.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Translate");
 
   if(frameType == GWFrames::UnknownFrameType) {
     INFOTOCERR << "\nWarning: Asking to Translate a Waveform in an `" << GWFrames::WaveformFrameNames[frameType] << "` frame."
@@ -3206,43 +5561,61 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   B.frame = std::vector<Quaternions::Quaternion>(0);
   B.frameType = GWFrames::Inertial;
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.t = A.t; // B.t will get reset later
 
+  if(ntimes<4) {
+    INFOTOCERR << "\nError: " << ntimes << " is not enough points to interpolate.\n"
+               << std::endl;
+    throw(GWFrames_BadWaveformInformation);
+  }
+
   // These numbers determine the equi-angular grid on which we will do
   // the interpolation.  For best accuracy, have N_phi > 2*ellMax and
   // N_theta > 2*ellMax; but for speed, don't make them much greater.
   const int ellMax(EllMax());
-  const unsigned int N_phi = 2*ellMax + 1;
-  const unsigned int N_theta = 2*ellMax + 1;
+  const int N_phi = 2*ellMax + 1;
+  const int N_theta = 2*ellMax + 1;
+  const int N_g = N_theta*N_phi;
   const double dtheta = M_PI/double(N_theta-1); // theta should return to M_PI
   const double dphi = 2*M_PI/double(N_phi); // phi should not return to 2*M_PI
-  vector<complex<double> > Grid(N_phi*N_theta);
+  vector<double> Theta(N_g), Phi(N_g), rHat_x(N_g), rHat_y(N_g), rHat_z(N_g);
+  for(int i_g=0, i_theta=0; i_theta<N_theta; ++i_theta) {
+    for(int i_phi=0; i_phi<N_phi; ++i_phi, ++i_g) {
+      Theta[i_g] = dtheta*i_theta;
+      Phi[i_g] = dphi*i_phi;
+      rHat_x[i_g] = std::sin(Theta[i_g])*std::cos(Phi[i_g]);
+      rHat_y[i_g] = std::sin(Theta[i_g])*std::sin(Phi[i_g]);
+      rHat_z[i_g] = std::cos(Theta[i_g]);
+    }
+  }
 
   // Find earliest and latest times we can use for our new data set
   unsigned int iEarliest = 0;
   unsigned int iLatest = ntimes-1;
   const double tEarliest = t[0];
   const double tLatest = t.back();
+  vector<double> deltaxMag(ntimes);
+  for(unsigned int i=0; i<ntimes; ++i) {
+    deltaxMag[i] = std::sqrt(deltax[i][0]*deltax[i][0] + deltax[i][1]*deltax[i][1] + deltax[i][2]*deltax[i][2]);
+  }
   { // Do the 0th point explicitly for earliest time only
     const unsigned int i=0;
-    const double deltaxiMag = std::sqrt(deltax[i][0]*deltax[i][0] + deltax[i][1]*deltax[i][1] + deltax[i][2]*deltax[i][2]);
-    if(t[i]-deltaxiMag<tEarliest) {
+    if(t[i]-deltaxMag[i]<tEarliest) {
       iEarliest = std::max(iEarliest, i+1);
     }
   }
   for(unsigned int i=1; i<ntimes-1; ++i) { // Do all points in between
-    const double deltaxiMag = std::sqrt(deltax[i][0]*deltax[i][0] + deltax[i][1]*deltax[i][1] + deltax[i][2]*deltax[i][2]);
-    if(t[i]-deltaxiMag<tEarliest) {
+    if(t[i]-deltaxMag[i]<tEarliest) {
       iEarliest = std::max(iEarliest, i+1);
     }
-    if(t[i]+deltaxiMag>tLatest) {
+    if(t[i]+deltaxMag[i]>tLatest) {
       iLatest = std::min(iLatest, i-1);
     }
   }
   { // Do the last point explicitly for latest time
     const unsigned int i=ntimes-1;
-    const double deltaxiMag = std::sqrt(deltax[i][0]*deltax[i][0] + deltax[i][1]*deltax[i][1] + deltax[i][2]*deltax[i][2]);
-    if(t[i]+deltaxiMag>tLatest) {
+    if(t[i]+deltaxMag[i]>tLatest) {
       iLatest = std::min(iLatest, i-1);
     }
   }
@@ -3260,269 +5633,365 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   B.t.erase(B.t.begin(), B.t.begin()+iEarliest);
   B.data.resize(NModes(), B.NTimes()); // Each row (first index, nn) corresponds to a mode
 
-  // We allocate just once, for speed, and pass these to InterpolateToPoint
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, 4);
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, 4);
+  // Output mode index in B for each mode returned by spinsfast
+  vector<int> OutputIndex(N_lm(ellMax), -1);
+  for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m, ++i_mode) {
+      OutputIndex[i_mode] = B.FindModeIndex(ell,m);
+    }
+  }
 
-  // Main loop over time steps
-  for(unsigned int i_t_B=0; i_t_B<B.NTimes(); ++i_t_B) {
-    // These will hold the input and output data.  Note that spinsfast
-    // has had some weird behavior in the past when the output data is
-    // not initialized to zero, so just do this each time, even though
-    // it's slow.
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
+  const int NStencil = 4;
 
-    // Construct the data on the translated grid
-    for(int i_g=0, i_theta=0; i_theta<N_theta; ++i_theta) {
-      for(int i_phi=0; i_phi<N_phi; ++i_phi, ++i_g) {
-        const double theta = dtheta*i_theta;
-        const double phi = dphi*i_phi;
+  // Work on blocks of output times, so that the grid data on the
+  // original times need only be stored for one block at a time
+  const int NTimesB = B.NTimes();
+  const int BlockSize = 1024;
+  for(int i_t_B_a=0; i_t_B_a<NTimesB; i_t_B_a+=BlockSize) {
+    const int i_t_B_b = std::min(NTimesB, i_t_B_a+BlockSize);
 
-        const double rHat_dot_deltax =
-          deltax[i_t_B][0]*std::sin(theta)*std::cos(phi)
-          + deltax[i_t_B][1]*std::sin(theta)*std::sin(phi)
-          + deltax[i_t_B][2]*std::cos(theta);
+    // Find the range of original times needed for this block
+    double tMin = B.t[i_t_B_a], tMax = B.t[i_t_B_a];
+    for(int i_t_B=i_t_B_a; i_t_B<i_t_B_b; ++i_t_B) {
+      tMin = std::min(tMin, B.t[i_t_B]-deltaxMag[iEarliest+i_t_B]);
+      tMax = std::max(tMax, B.t[i_t_B]+deltaxMag[iEarliest+i_t_B]);
+    }
+    const int j_a = StencilStart(t, tMin, NStencil);
+    const int j_b = StencilStart(t, tMax, NStencil) + NStencil;
+
+    // Evaluate the data on the grid at those times, and find the
+    // spline weights for each stencil
+    const vector<vector<complex<double> > > GridData = EvaluateAtPoints(Theta, Phi, j_a, j_b);
+    vector<CubicSplineWeights> Stencils;
+    Stencils.reserve(j_b-j_a-NStencil+1);
+    for(int j=j_a; j+NStencil<=j_b; ++j) {
+      Stencils.push_back(CubicSplineWeights(vector<double>(t.begin()+j, t.begin()+j+NStencil)));
+    }
 
-        // Evaluate the data for the translated frame at this point
-        Grid[i_g] = A.InterpolateToPoint(theta, phi, B.T(i_t_B)-rHat_dot_deltax, accRe, accIm, splineRe, splineIm);
+    // Main loop over time steps
+    int ErrorCode = 0;
+    #pragma omp parallel
+    {
+      vector<complex<double> > Grid(N_g), M(N_lm(ellMax));
+      vector<double> w(NStencil), z(NStencil);
+      #pragma omp for schedule(dynamic)
+      for(int i_t_B=i_t_B_a; i_t_B<i_t_B_b; ++i_t_B) {
+        try {
+          const vector<double>& deltax_i = deltax[iEarliest+i_t_B];
+          // Construct the data on the translated grid
+          for(int i_g=0; i_g<N_g; ++i_g) {
+            const double rHat_dot_deltax = deltax_i[0]*rHat_x[i_g] + deltax_i[1]*rHat_y[i_g] + deltax_i[2]*rHat_z[i_g];
+            const double t_i = B.t[i_t_B]-rHat_dot_deltax;
+            const int j = StencilStart(t, t_i, NStencil);
+            Stencils[j-j_a](t_i, w, z);
+            const complex<double>* G = &GridData[i_g][j-j_a];
+            Grid[i_g] = w[0]*G[0] + w[1]*G[1] + w[2]*G[2] + w[3]*G[3];
+          }
+          // Decompose the data into modes, and set new data at this time step
+          SpinsfastWorkspaceLease Transform(ellMax, N_theta, N_phi);
+          Transform.map2salm(&Grid[0], &M[0], SpinWeight());
+          for(int i_mode=0; i_mode<N_lm(ellMax); ++i_mode) {
+            if(OutputIndex[i_mode]>=0) {
+              B.data[OutputIndex[i_mode]][i_t_B] = M[i_mode];
+            }
+          }
+        } catch(int e) {
+          #pragma omp critical(GWFrames_TranslateError)
+          {
+            ErrorCode = e;
+          }
+        } catch(...) {
+          #pragma omp critical(GWFrames_TranslateError)
+          {
+            ErrorCode = GWFrames_UnknownException;
+          }
+        }
       }
     }
+    if(ErrorCode) { throw(ErrorCode); }
 
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes[0]),
-                       SpinWeight(), N_theta, N_phi, ellMax);
+  } // block loop
 
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        B.SetData(B.FindModeIndex(ell,m), i_t_B, Modes[i_mode]);
-      }
-    }
+  return B;
+}
 
-  } // i_t_B loop
+#ifndef DOXYGEN
+namespace {
+  // The parts of BoostPsi4 and BoostHFaked that depend only on the
+  // geometry of the boost.  The null tetrad basis vectors are built
+  // once, and for each point of the boosted frame's equi-angular grid
+  // (given by the rotor taking z to that point in the boosted frame),
+  // `Coefficients` finds the corresponding point (theta,phi) in the
+  // present frame, and the coefficients A and B such that the value
+  // of Psi_4 in the boosted frame is A*Psi_4+B*conj(Psi_4).  This
+  // allocates nothing and only reads its members, so one object can
+  // be shared by all threads.
+  class BoostTetrad {
+  private:
+    SpacetimeAlgebra::vector tPz, tMz, xPiyRe, xPiyIm, xMiyRe, xMiyIm;
+  public:
+    BoostTetrad() {
+      tPz.set_gamma_0(1./std::sqrt(2));
+      tPz.set_gamma_3(1./std::sqrt(2));
+      tMz.set_gamma_0(1./std::sqrt(2));
+      tMz.set_gamma_3(-1./std::sqrt(2));
+      xPiyRe.set_gamma_1(1./std::sqrt(2));
+      xPiyIm.set_gamma_2(1./std::sqrt(2));
+      xMiyRe.set_gamma_1(1./std::sqrt(2));
+      xMiyIm.set_gamma_2(-1./std::sqrt(2));
+    }
+    // The rotor taking the z axis to (theta,phi)
+    static SpacetimeAlgebra::spinor RotationRotor(const double theta, const double phi) {
+      SpacetimeAlgebra::spinor Rotor_theta;
+      Rotor_theta.set_scalar(std::cos(theta/2));
+      Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
+      SpacetimeAlgebra::spinor Rotor_phi;
+      Rotor_phi.set_scalar(std::cos(phi/2));
+      Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
+      return SpacetimeAlgebra::spinor(Rotor_phi * Rotor_theta);
+    }
+    // The boost rotor for three-velocity beta*vHat
+    static SpacetimeAlgebra::spinor BoostRotor(const double gamma, const double vHat[3]) {
+      const double sqrtplus = std::sqrt((gamma+1)/2);
+      const double sqrtminus = std::sqrt((gamma-1)/2);
+      SpacetimeAlgebra::spinor Rotor;
+      Rotor.set_scalar(sqrtplus);
+      Rotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
+      Rotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
+      Rotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
+      return Rotor;
+    }
+    void Coefficients(const SpacetimeAlgebra::spinor& BoostRotor, const SpacetimeAlgebra::spinor& RotationRotorRotated,
+                      double& theta, double& phi, complex<double>& A, complex<double>& B) const {
+      // This is the complete transformation rotor for going from
+      // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
+      // boosted frame:
+      const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
+
+      // The following give the important tetrad elements in the boosted frame
+      const int Filler=0; // Useless constant for Gaigen code
+      const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+      const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+      const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+      const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+
+      // Figure out the coordinates in the present frame
+      // corresponding to the given coordinates in the boosted frame
+      const double r[3] = { lRotated.get_gamma_1(), lRotated.get_gamma_2(), lRotated.get_gamma_3() };
+      const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
+      theta = std::acos(r[2]/rMag);
+      phi = std::atan2(r[1],r[0]);
+
+      // This gives us the rotor to get from the z axis to the
+      // spherical coordinates in the present frame
+      const SpacetimeAlgebra::spinor Rotor(RotationRotor(theta, phi));
+
+      // The following give the important tetrad elements in the present frame
+      const SpacetimeAlgebra::vector l(Rotor*tPz*SpacetimeAlgebra::reverse(Rotor), Filler);
+      const SpacetimeAlgebra::vector mRe(Rotor*xPiyRe*SpacetimeAlgebra::reverse(Rotor), Filler);
+      const SpacetimeAlgebra::vector mIm(Rotor*xPiyIm*SpacetimeAlgebra::reverse(Rotor), Filler);
+      const SpacetimeAlgebra::vector mBarRe(Rotor*xMiyRe*SpacetimeAlgebra::reverse(Rotor), Filler);
+      const SpacetimeAlgebra::vector mBarIm(Rotor*xMiyIm*SpacetimeAlgebra::reverse(Rotor), Filler);
+
+      // Get the components of the other frame's tetrad in the basis
+      // of this tetrad.  In particular, these are *not* the dot
+      // products of the other frame's basis vectors with this
+      // frame's basis vectors.  Instead, we expand, e.g., nRotated
+      // in terms of this frame's (l,n,m,mbar) basis, and just take
+      // the coefficients in that expansion.  [This distinction
+      // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
+      // that we will not need any components involving the l vector
+      // in either frame, because that will just give us terms
+      // proportional to Psi3, etc., which are assumed to fall off
+      // more quickly than we care to bother with.
+      const complex<double> i_complex(0.,1.);
+      const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
+      const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
+      const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
+      const complex<double> mBarRotated_n =
+        - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
+      const complex<double> mBarRotated_m =
+        SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
+        + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
+      const complex<double> mBarRotated_mBar =
+        SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
+        + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
+
+      // The coefficients of Psi_4 and its conjugate in the boosted frame
+      A = (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
+           - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
+           - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
+           + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n);
+      B = (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
+           - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
+           - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
+           + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n);
+    }
+  };
 
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
+  void PrintBoostCoordinatesNote(const char* File, const int Line) {
+    std::cerr << "\n\n" << File << ":" << Line << ":\n"
+              << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
+              << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
+              << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
+              << "    comes out as 0, even though phiRotated may not be.\n\n"
+              << "    Fortunately, I think both these problems are handled automatically by taking the\n"
+              << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+  }
 
-  return B;
 }
+#endif // DOXYGEN
 
-/// Apply a boost to Psi4 data
-GWFrames::Waveform& GWFrames::Waveform::BoostPsi4(const std::vector<std::vector<double> >& v) {
-  /// This function does three things.  First, it evaluates the
-  /// Waveform on what will become an equi-angular grid after
-  /// transformation by the boost.  Second, at each point of that
-  /// grid, it takes the appropriate combinations of the present value
-  /// of Psi_4 and its conjugate to give the value of Psi_4 as
-  /// observed in the boosted frame.  Finally, it transforms back to
-  /// Fourier space using that new equi-angular grid.
-  ///
-  /// The input three-velocities are assumed to give the velocities of
-  /// the boosted frame relative to the present frame.
+// Transform Psi_4 (times gamma to the given power) to the boosted frame at each time step
+void GWFrames::Waveform::BoostModes(const std::vector<std::vector<double> >& v, const int GammaPower) {
+  /// This is the work of both `BoostPsi4` (with `GammaPower=0`) and
+  /// `BoostHFaked` (with `GammaPower=-2`); `GammaPower` must not be
+  /// positive.  The time steps are
+  /// independent, so they are done in parallel.  Each thread reuses
+  /// its own grid, mode buffers, and SWSH object, and the
+  /// transformations back to modes use the cached spinsfast
+  /// workspaces of `SpinsfastWorkspaceLease`.
 
   // Check the size of the input velocity
   if(v.size()!=NTimes()) {
     std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": (v.size()=" << v.size() << ") != (NTimes()=" << NTimes() << ")" << std::endl;
     throw(GWFrames_VectorSizeMismatch);
   }
+  const int NT = NTimes();
+  for(int i_t=0; i_t<NT; ++i_t) {
+    if(v[i_t].size()!=3) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v[i_t].size()
+                << ".  Input is assumed to be a vector of three-velocities." << std::endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+  }
 
   // Set up storage and calculate useful constants
   const int ellMax = this->EllMax();
   const int n_thetaRotated= 2*ellMax+1;
   const int n_phiRotated = 2*ellMax+1;
+  const int N_g = n_phiRotated*n_thetaRotated;
   const double dthetaRotated = M_PI/double(n_thetaRotated-1); // thetaRotated should return to M_PI
   const double dphiRotated = 2*M_PI/double(n_phiRotated); // phiRotated should not return to 2*M_PI
-  vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
-  SphericalFunctions::SWSH sYlm(SpinWeight());
-
-  SpacetimeAlgebra::vector tPz;
-  tPz.set_gamma_0(1./std::sqrt(2));
-  tPz.set_gamma_3(1./std::sqrt(2));
-  SpacetimeAlgebra::vector tMz;
-  tMz.set_gamma_0(1./std::sqrt(2));
-  tMz.set_gamma_3(-1./std::sqrt(2));
-  SpacetimeAlgebra::vector xPiyRe;
-  xPiyRe.set_gamma_1(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xPiyIm;
-  xPiyIm.set_gamma_2(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xMiyRe;
-  xMiyRe.set_gamma_1(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xMiyIm;
-  xMiyIm.set_gamma_2(-1./std::sqrt(2));
+  const BoostTetrad Tetrad;
 
-  // Main loop over time steps
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    const vector<double>& v_i = v[i_t];
-    if(v_i.size()!=3) {
-      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v_i.size()
-                << ".  Input is assumed to be a vector of three-velocities." << std::endl;
-      throw(GWFrames_VectorSizeMismatch);
+  // The rotation rotors for the equi-angular grid in the boosted frame
+  vector<SpacetimeAlgebra::spinor> RotationRotorsRotated(N_g);
+  for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
+    for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
+      RotationRotorsRotated[i_g] = BoostTetrad::RotationRotor(dthetaRotated*i_thetaRotated, dphiRotated*i_phiRotated);
+    }
+  }
+
+  // Mode index in this Waveform for each mode in spinsfast order (or
+  // -1 for the modes with ell<|s|, which are zero)
+  vector<int> ModeIndex(N_lm(ellMax), -1);
+  for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m, ++i_mode) {
+      ModeIndex[i_mode] = FindModeIndex(ell,m);
     }
+  }
+
+  if(NT>0 && std::sqrt(v[0][0]*v[0][0] + v[0][1]*v[0][1] + v[0][2]*v[0][2])>=1.e-9) {
+    PrintBoostCoordinatesNote(__FILE__, __LINE__);
+  }
 
-    const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
-    if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
-    vector<double> vHat(3);
-    vHat[0] = v_i[0]/beta;
-    vHat[1] = v_i[1]/beta;
-    vHat[2] = v_i[2]/beta;
-    const double gamma = 1.0/std::sqrt(1.0-beta*beta);
-    const double sqrtplus = std::sqrt((gamma+1)/2);
-    const double sqrtminus = std::sqrt((gamma-1)/2);
-
-    // Calculate the boost rotor
-    SpacetimeAlgebra::spinor BoostRotor;
-    BoostRotor.set_scalar(sqrtplus);
-    BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
-    BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
-    BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
-
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
-    vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
-
-    // Fill the Modes data for this time step
-    for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
-      // Explicitly zero the modes with ell<|s|
-      Modes[i_mode] = 0.0;
-    }
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      // Now, fill modes with ell>=|s| in the correct order
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        Modes[i_mode] = this->Data(FindModeIndex(ell,m), i_t);
-      }
-    }
-
-    // Construct the data on the distorted grid
-    for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
-      for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
-        const double thetaRotated = dthetaRotated*i_thetaRotated;
-        const double phiRotated = dphiRotated*i_phiRotated;
-
-        // Calculate the rotation rotors
-        SpacetimeAlgebra::spinor Rotor_thetaRotated;
-        Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
-        Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
-        SpacetimeAlgebra::spinor Rotor_phiRotated;
-        Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
-        Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
-        const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
-
-        // This is the complete transformation rotor for going from
-        // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
-        // boosted frame:
-        const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
-
-        // The following give the important tetrad elements in the boosted frame
-        const int Filler=0; // Useless constant for Gaigen code
-        const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-
-        // Figure out the coordinates in the present frame
-        // corresponding to the given coordinates in the boosted frame
-        vector<double> r(3);
-        r[0] = lRotated.get_gamma_1();
-        r[1] = lRotated.get_gamma_2();
-        r[2] = lRotated.get_gamma_3();
-        const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
-        const double theta = std::acos(r[2]/rMag);
-        const double phi = std::atan2(r[1],r[0]);
-
-        if(i_g==0 && i_t==0) {
-          std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
-                    << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
-                    << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
-                    << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
-                    << "    comes out as 0, even though phiRotated may not be.\n\n"
-                    << "    Fortunately, I think both these problems are handled automatically by taking the\n"
-                    << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+  // Make sure the data are owned (not mapped) before threads write to
+  // them, and that the singletons used by SWSH are constructed
+  // before any threads need them
+  data.detach();
+  { SphericalFunctions::SWSH sYlm(SpinWeight()); }
+
+  // Main loop over time steps
+  int ErrorCode = 0;
+  #pragma omp parallel
+  {
+    SphericalFunctions::SWSH sYlm(SpinWeight());
+    vector<complex<double> > Grid(N_g), M(N_lm(ellMax));
+    vector<complex<double> > ModeData(N_lm(ellMax), 0.0);
+    #pragma omp for schedule(dynamic)
+    for(int i_t=0; i_t<NT; ++i_t) {
+      try {
+        const vector<double>& v_i = v[i_t];
+        const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
+        if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
+        const double vHat[3] = { v_i[0]/beta, v_i[1]/beta, v_i[2]/beta };
+        const double gamma = 1.0/std::sqrt(1.0-beta*beta);
+        // The data are divided by gamma^(-GammaPower) formed by repeated
+        // multiplication, which is exactly `gamma*gamma` for h, and
+        // exactly 1 for Psi_4
+        double GammaDivisor = 1.0;
+        for(int p=0; p<-GammaPower; ++p) { GammaDivisor *= gamma; }
+
+        // Calculate the boost rotor
+        const SpacetimeAlgebra::spinor BoostRotor(BoostTetrad::BoostRotor(gamma, vHat));
+
+        // Fill the mode data for this time step, in the order
+        // expected by SWSH (with zeros for ell<|s|)
+        for(int i_mode=0; i_mode<N_lm(ellMax); ++i_mode) {
+          ModeData[i_mode] = (ModeIndex[i_mode]>=0 ? data[ModeIndex[i_mode]][i_t] : 0.0);
         }
 
-        // This gives us the rotor to get from the z axis to the
-        // spherical coordinates in the present frame
-        SpacetimeAlgebra::spinor Rotor_theta;
-        Rotor_theta.set_scalar(std::cos(theta/2));
-        Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
-        SpacetimeAlgebra::spinor Rotor_phi;
-        Rotor_phi.set_scalar(std::cos(phi/2));
-        Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
-        const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
-
-        // The following give the important tetrad elements in the present frame
-        const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-
-        // Get the value of Psi4 in this frame at the appropriate
-        // point of this frame
-        const Quaternion Rp(theta, phi);
-        sYlm.SetRotation(Rp);
-        const complex<double> Psi_4 = sYlm.Evaluate(Modes);
-
-        // Get the components of the other frame's tetrad in the basis
-        // of this tetrad.  In particular, these are *not* the dot
-        // products of the other frame's basis vectors with this
-        // frame's basis vectors.  Instead, we expand, e.g., nRotated
-        // in terms of this frame's (l,n,m,mbar) basis, and just take
-        // the coefficients in that expansion.  [This distinction
-        // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
-        // that we will not need any components involving the l vector
-        // in either frame, because that will just give us terms
-        // proportional to Psi3, etc., which are assumed to fall off
-        // more quickly than we care to bother with.
-        const complex<double> i_complex(0.,1.);
-        const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
-        const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
-        const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
-        const complex<double> mBarRotated_n =
-          - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
-        const complex<double> mBarRotated_m =
-          SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
-        const complex<double> mBarRotated_mBar =
-          SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
-
-        // Evaluate the data for the boosted frame at this point
-        Grid[i_g] =
-          (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
-           - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
-           - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
-           + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * Psi_4
-          + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
-             - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
-             - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
-             + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(Psi_4);
+        // Construct the data on the distorted grid
+        for(int i_g=0; i_g<N_g; ++i_g) {
+          double theta, phi;
+          complex<double> A, B;
+          Tetrad.Coefficients(BoostRotor, RotationRotorsRotated[i_g], theta, phi, A, B);
 
-        // if(i_t%5000==0) {
-        //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
-        //             << "; \t" << Grid[i_g] << "," << Psi_4 << std::endl;
-        // }
-      }
-    }
+          // Get the value of the data in this frame at the
+          // appropriate point of this frame
+          sYlm.SetRotation(Quaternion(theta, phi));
+          const complex<double> Psi_4 = sYlm.Evaluate(ModeData);
 
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes2[0]),
-                       SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
+          // Evaluate the data for the boosted frame at this point
+          Grid[i_g] = ( A * Psi_4 + B * std::conj(Psi_4) ) / GammaDivisor;
+        }
 
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        this->SetData(this->FindModeIndex(ell,m), i_t, Modes2[i_mode]);
+        // Decompose the data into modes, and set new data at this time step
+        SpinsfastWorkspaceLease Transform(ellMax, n_thetaRotated, n_phiRotated);
+        Transform.map2salm(&Grid[0], &M[0], SpinWeight());
+        for(int i_mode=0; i_mode<N_lm(ellMax); ++i_mode) {
+          if(ModeIndex[i_mode]>=0) {
+            data[ModeIndex[i_mode]][i_t] = M[i_mode];
+          }
+        }
+      } catch(int e) {
+        #pragma omp critical(GWFrames_BoostError)
+        {
+          ErrorCode = e;
+        }
+      } catch(...) {
+        #pragma omp critical(GWFrames_BoostError)
+        {
+          ErrorCode = GWFrames_UnknownException;
+        }
       }
     }
-
   }
+  if(ErrorCode) { throw(ErrorCode); }
 
+  return;
+}
+
+/// Apply a boost to Psi4 data
+GWFrames::Waveform& GWFrames::Waveform::BoostPsi4(const std::vector<std::vector<double> >& v) {
+  /// This function does three things.  First, it evaluates the
+  /// Waveform on what will become an equi-angular grid after
+  /// transformation by the boost.  Second, at each point of that
+  /// grid, it takes the appropriate combinations of the present value
+  /// of Psi_4 and its conjugate to give the value of Psi_4 as
+  /// observed in the boosted frame.  Finally, it transforms back to
+  /// Fourier space using that new equi-angular grid.
+  ///
+  /// The input three-velocities are assumed to give the velocities of
+  /// the boosted frame relative to the present frame.
+  ///
+  /// The time steps are independent, so they are done in parallel.
+  /// Each thread reuses its own grid, mode buffers, and SWSH object,
+  /// and the transformations back to modes use the cached spinsfast
+  /// workspaces of `SpinsfastWorkspaceLease`.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::BoostPsi4");
+  BoostModes(v, 0);
   return *this;
 }
 
@@ -3545,233 +6014,412 @@ GWFrames::Waveform& GWFrames::Waveform::BoostHFaked(const std::vector<std::vecto
   /// at each point.  This, of course, assumes that \f$\ddot{h} =
   /// \Psi_4\f$ in both frames.  That need not be the case, which is
   /// why "Faked" is in the name of this function.
-
-  // Check the size of the input velocity
-  if(v.size()!=NTimes()) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": (v.size()=" << v.size() << ") != (NTimes()=" << NTimes() << ")" << std::endl;
-    throw(GWFrames_VectorSizeMismatch);
-  }
-
+  ///
+  /// The time steps are done in parallel, as in `BoostPsi4`.
+  GWFrames_INSTRUMENT_SCOPE("Waveform::BoostHFaked");
   INFOTOCERR << "\nCAUTION!!!  This function relies on an imperfect formula."
              << "\nIt assumes that the second time derivative of h equals"
              << "\n(plus or minus) Psi_4, which need not be exactly true.\n" << std::endl;
+  BoostModes(v, -2);
+  return *this;
+}
 
-  // Set up storage and calculate useful constants
-  const int ellMax = this->EllMax();
-  const int n_thetaRotated= 2*ellMax+1;
-  const int n_phiRotated = 2*ellMax+1;
-  const double dthetaRotated = M_PI/double(n_thetaRotated-1); // thetaRotated should return to M_PI
-  const double dphiRotated = 2*M_PI/double(n_phiRotated); // phiRotated should not return to 2*M_PI
-  vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
-  SphericalFunctions::SWSH sYlm(SpinWeight());
-
-  SpacetimeAlgebra::vector tPz;
-  tPz.set_gamma_0(1./std::sqrt(2));
-  tPz.set_gamma_3(1./std::sqrt(2));
-  SpacetimeAlgebra::vector tMz;
-  tMz.set_gamma_0(1./std::sqrt(2));
-  tMz.set_gamma_3(-1./std::sqrt(2));
-  SpacetimeAlgebra::vector xPiyRe;
-  xPiyRe.set_gamma_1(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xPiyIm;
-  xPiyIm.set_gamma_2(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xMiyRe;
-  xMiyRe.set_gamma_1(1./std::sqrt(2));
-  SpacetimeAlgebra::vector xMiyIm;
-  xMiyIm.set_gamma_2(-1./std::sqrt(2));
 
-  // Main loop over time steps
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    const vector<double>& v_i = v[i_t];
-    if(v_i.size()!=3) {
-      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v_i.size()
-                << ".  Input is assumed to be a vector of three-velocities." << std::endl;
-      throw(GWFrames_VectorSizeMismatch);
+
+#ifndef DOXYGEN
+namespace {
+  // Format x into p as by `printf("%.*g")`, followed by the separator,
+  // and return the end of the written characters.  At most
+  // precision+9 characters are written.
+  inline char* FormatNumberForOutput(char* p, const int precision, const double x, const char separator) {
+    p += std::sprintf(p, "%.*g", precision, x);
+    *p++ = separator;
+    return p;
+  }
+}
+#endif // DOXYGEN
+
+/// Output Waveform object to data file.
+const GWFrames::Waveform& GWFrames::Waveform::Output(const std::string& FileName, const unsigned int precision) const {
+  ///
+  /// \param FileName Relative path to the output file
+  /// \param precision Number of significant digits [default: 14]
+  ///
+  /// The file begins with the history and a description of the
+  /// columns, followed by one line for each time step with the time
+  /// and the real and imaginary parts of each mode.  Numbers are
+  /// written as by `printf("%.*g")`, which is the same text `ostream`
+  /// produces with `setprecision`; 17 digits suffice to read back
+  /// every double exactly.
+  ///
+  /// The data are transposed into a small buffer a block of time
+  /// steps at a time, so each line is formatted from contiguous
+  /// memory, and the text is written with one `fwrite` per block
+  /// rather than through the stream operators.
+  ///
+  /// \sa OutputBinary, which is faster still; OutputWaveforms, to
+  /// write several Waveforms in parallel
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::Output");
+  FILE* fp = fopen(FileName.c_str(), "w");
+  if(!fp) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "' for writing" << endl;
+    throw(GWFrames_BadFileName);
+  }
+
+  // Write the header
+  {
+    const std::string Descriptor = DescriptorString();
+    stringstream Header;
+    Header << history.str() << "this->Output(" << FileName << ", " << precision << ")" << endl;
+    Header << "# [1] = Time" << endl;
+    for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
+      Header << "# [" << 2*i_m+2 << "] = Re{" << Descriptor << "(" << lm[i_m][0] << "," << lm[i_m][1] << ")}" << endl;
+      Header << "# [" << 2*i_m+3 << "] = Im{" << Descriptor << "(" << lm[i_m][0] << "," << lm[i_m][1] << ")}" << endl;
+    }
+    const string HeaderStr = Header.str();
+    fwrite(HeaderStr.c_str(), 1, HeaderStr.size(), fp);
+  }
+
+  // Write the data in blocks of time steps
+  const unsigned int NT = NTimes();
+  const unsigned int NM = NModes();
+  const unsigned int BlockSize = 256;
+  const int Precision = precision;
+  vector<complex<double> > Block(BlockSize*NM);
+  vector<char> Buffer(BlockSize*(2*NM+1)*(precision+9)+1);
+  for(unsigned int i_t_a=0; i_t_a<NT; i_t_a+=BlockSize) {
+    const unsigned int i_t_b = std::min(i_t_a+BlockSize, NT);
+    for(unsigned int i_m=0; i_m<NM; ++i_m) {
+      const complex<double>* Mode = data[i_m];
+      for(unsigned int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+        Block[(i_t-i_t_a)*NM+i_m] = Mode[i_t];
+      }
     }
+    char* p = &Buffer[0];
+    for(unsigned int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+      const complex<double>* Line = &Block[(i_t-i_t_a)*NM];
+      p = FormatNumberForOutput(p, Precision, t[i_t], (NM>0 ? ' ' : '\n'));
+      for(unsigned int i_m=0; i_m<NM; ++i_m) {
+        p = FormatNumberForOutput(p, Precision, Line[i_m].real(), ' ');
+        p = FormatNumberForOutput(p, Precision, Line[i_m].imag(), (i_m+1<NM ? ' ' : '\n'));
+      }
+    }
+    fwrite(&Buffer[0], 1, p-&Buffer[0], fp);
+  }
 
-    const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
-    if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
-    vector<double> vHat(3);
-    vHat[0] = v_i[0]/beta;
-    vHat[1] = v_i[1]/beta;
-    vHat[2] = v_i[2]/beta;
-    const double gamma = 1.0/std::sqrt(1.0-beta*beta);
-    const double sqrtplus = std::sqrt((gamma+1)/2);
-    const double sqrtminus = std::sqrt((gamma-1)/2);
-
-    // Calculate the boost rotor
-    SpacetimeAlgebra::spinor BoostRotor;
-    BoostRotor.set_scalar(sqrtplus);
-    BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
-    BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
-    BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
-
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
-    vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
-
-    // Fill the Modes data for this time step
-    for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
-      // Explicitly zero the modes with ell<|s|
-      Modes[i_mode] = 0.0;
-    }
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      // Now, fill modes with ell>=|s| in the correct order
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        Modes[i_mode] = this->Data(FindModeIndex(ell,m), i_t);
-      }
-    }
-
-    // Construct the data on the distorted grid
-    for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
-      for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
-        const double thetaRotated = dthetaRotated*i_thetaRotated;
-        const double phiRotated = dphiRotated*i_phiRotated;
-
-        // Calculate the rotation rotors
-        SpacetimeAlgebra::spinor Rotor_thetaRotated;
-        Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
-        Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
-        SpacetimeAlgebra::spinor Rotor_phiRotated;
-        Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
-        Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
-        const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
-
-        // This is the complete transformation rotor for going from
-        // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
-        // boosted frame:
-        const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
-
-        // The following give the important tetrad elements in the boosted frame
-        const int Filler=0; // Useless constant for Gaigen code
-        const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-
-        // Figure out the coordinates in the present frame
-        // corresponding to the given coordinates in the boosted frame
-        vector<double> r(3);
-        r[0] = lRotated.get_gamma_1();
-        r[1] = lRotated.get_gamma_2();
-        r[2] = lRotated.get_gamma_3();
-        const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
-        const double theta = std::acos(r[2]/rMag);
-        const double phi = std::atan2(r[1],r[0]);
-
-        if(i_g==0 && i_t==0) {
-          std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
-                    << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
-                    << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
-                    << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
-                    << "    comes out as 0, even though phiRotated may not be.\n\n"
-                    << "    Fortunately, I think both these problems are handled automatically by taking the\n"
-                    << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
-        }
+  const bool Failed = ferror(fp);
+  if(fclose(fp) || Failed) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed to write '" << FileName << "'" << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+  return *this;
+}
 
-        // This gives us the rotor to get from the z axis to the
-        // spherical coordinates in the present frame
-        SpacetimeAlgebra::spinor Rotor_theta;
-        Rotor_theta.set_scalar(std::cos(theta/2));
-        Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
-        SpacetimeAlgebra::spinor Rotor_phi;
-        Rotor_phi.set_scalar(std::cos(phi/2));
-        Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
-        const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
-
-        // The following give the important tetrad elements in the present frame
-        const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-
-        // Get the value of h in this frame at the appropriate point
-        // of this frame
-        const Quaternion Rp(theta, phi);
-        sYlm.SetRotation(Rp);
-        const complex<double> h = sYlm.Evaluate(Modes);
-
-        // Get the components of the other frame's tetrad in the basis
-        // of this tetrad.  In particular, these are *not* the dot
-        // products of the other frame's basis vectors with this
-        // frame's basis vectors.  Instead, we expand, e.g., nRotated
-        // in terms of this frame's (l,n,m,mbar) basis, and just take
-        // the coefficients in that expansion.  [This distinction
-        // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
-        // that we will not need any components involving the l vector
-        // in either frame, because that will just give us terms
-        // proportional to Psi3, etc., which are assumed to fall off
-        // more quickly than we care to bother with.
-        const complex<double> i_complex(0.,1.);
-        const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
-        const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
-        const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
-        const complex<double> mBarRotated_n =
-          - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
-        const complex<double> mBarRotated_m =
-          SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
-        const complex<double> mBarRotated_mBar =
-          SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
-
-        // Evaluate the data for the boosted frame at this point
-        Grid[i_g] =
-          ( (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
-             - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
-             - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
-             + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * h
-            + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
-               - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
-               - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
-               + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(h) ) / (gamma*gamma);
-
-        // if(i_t%5000==0) {
-        //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
-        //             << "; \t" << Grid[i_g] << "," << h << std::endl;
-        // }
-      }
-    }
-
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes2[0]),
-                       SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
-
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        this->SetData(this->FindModeIndex(ell,m), i_t, Modes2[i_mode]);
+/// Output several Waveform objects to data files in parallel
+void GWFrames::OutputWaveforms(const std::vector<GWFrames::Waveform>& Waveforms, const std::vector<std::string>& FileNames,
+                               const unsigned int precision)
+{
+  ///
+  /// \param Waveforms Waveforms to write
+  /// \param FileNames Corresponding files to write to
+  /// \param precision Number of significant digits [default: 14]
+  ///
+  /// Each file is written with `Waveform::Output`, and different
+  /// files are written by different OpenMP threads, since formatting
+  /// the numbers takes much longer than writing them.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("OutputWaveforms");
+  if(Waveforms.size()!=FileNames.size()) {
+    INFOTOCERR << "\nError: Waveforms.size()=" << Waveforms.size() << " but FileNames.size()=" << FileNames.size() << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  const int NW = Waveforms.size();
+  int ErrorCode = 0;
+  #pragma omp parallel for schedule(dynamic)
+  for(int i_W=0; i_W<NW; ++i_W) {
+    try {
+      Waveforms[i_W].Output(FileNames[i_W], precision);
+    } catch(int e) {
+      #pragma omp critical(GWFrames_OutputWaveformsError)
+      {
+        ErrorCode = e;
+      }
+    } catch(...) {
+      #pragma omp critical(GWFrames_OutputWaveformsError)
+      {
+        ErrorCode = GWFrames_UnknownException;
       }
     }
+  }
+  if(ErrorCode) { throw(ErrorCode); }
+}
 
+#ifndef DOXYGEN
+namespace {
+  // Layout of the binary Waveform file format.  All quantities are
+  // stored little-endian.  The fixed-size header is followed by the
+  // arrays, each of which starts on an 8-byte boundary:
+  //
+  //   char     Magic[8]          "GWFrames"
+  //   uint32   Version           BinaryWaveformVersion
+  //   uint32   EndianTest        BinaryWaveformEndianTest
+  //   int32    spinweight, boostweight, frameType, dataType, rIsScaledOut, mIsScaledOut
+  //   uint64   NTimes, NModes, NFrame, NHistory
+  //   int32    lm[NModes][2]
+  //   double   t[NTimes]
+  //   double   frame[NFrame][4]
+  //   double   data[NModes][NTimes][2]  (mode-major, like MatrixC)
+  //   char     history[NHistory]
+  const char BinaryWaveformMagic[8] = { 'G', 'W', 'F', 'r', 'a', 'm', 'e', 's' };
+  const uint32_t BinaryWaveformVersion = 1;
+  const uint32_t BinaryWaveformEndianTest = 0x01020304;
+  const unsigned int BinaryWaveformHeaderSize = 8 + 2*4 + 6*4 + 4*8;
+
+  void WriteOrThrow(const void* ptr, const size_t size, const size_t count, FILE* fp, const std::string& FileName) {
+    if(count>0 && fwrite(ptr, size, count, fp)!=count) {
+      fclose(fp);
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed writing to '" << FileName << "'" << endl;
+      throw(GWFrames_FailedSystemCall);
+    }
   }
 
-  return *this;
+  void ReadOrThrow(void* ptr, const size_t size, const size_t count, FILE* fp, const std::string& FileName) {
+    if(count>0 && fread(ptr, size, count, fp)!=count) {
+      fclose(fp);
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed reading from '" << FileName << "'; file is truncated or corrupt" << endl;
+      throw(GWFrames_BadWaveformInformation);
+    }
+  }
 }
+#endif // DOXYGEN
 
+/// Read Waveform data from a file written by OutputBinary.
+void GWFrames::Waveform::ReadBinary(const std::string& FileName, const bool MapData) {
+  ///
+  /// \param FileName Relative path to data file
+  /// \param MapData If true, memory-map the mode data rather than reading them
+  ///
+  /// This is the workhorse of the constructor when the 'Binary'
+  /// format is requested; it replaces all the data in this object
+  /// except for history, which has the history stored in the file
+  /// appended as "Previous History".
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::ReadBinary");
+  FILE* fp = fopen(FileName.c_str(), "rb");
+  if(!fp) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "'" << endl;
+    throw(GWFrames_BadFileName);
+  }
 
+  // Read and check the header
+  char Magic[8];
+  uint32_t Version, EndianTest;
+  int32_t Ints[6];
+  uint64_t Sizes[4];
+  ReadOrThrow(Magic, 1, 8, fp, FileName);
+  ReadOrThrow(&Version, sizeof(uint32_t), 1, fp, FileName);
+  ReadOrThrow(&EndianTest, sizeof(uint32_t), 1, fp, FileName);
+  if(std::memcmp(Magic, BinaryWaveformMagic, 8)!=0) {
+    fclose(fp);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' is not a binary Waveform file" << endl;
+    throw(GWFrames_BadWaveformInformation);
+  }
+  if(EndianTest!=BinaryWaveformEndianTest) {
+    fclose(fp);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' has the wrong byte order for this machine" << endl;
+    throw(GWFrames_NotYetImplemented);
+  }
+  if(Version!=BinaryWaveformVersion) {
+    fclose(fp);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' has unknown binary format version " << Version << endl;
+    throw(GWFrames_BadWaveformInformation);
+  }
+  ReadOrThrow(Ints, sizeof(int32_t), 6, fp, FileName);
+  ReadOrThrow(Sizes, sizeof(uint64_t), 4, fp, FileName);
 
-/// Output Waveform object to data file.
-const GWFrames::Waveform& GWFrames::Waveform::Output(const std::string& FileName, const unsigned int precision) const {
-  const std::string Descriptor = DescriptorString();
-  ofstream ofs(FileName.c_str(), ofstream::out);
-  ofs << setprecision(precision) << flush;
-  ofs << history.str() << "this->Output(" << FileName << ", " << precision << ")" << endl;
-  ofs << "# [1] = Time" << endl;
-  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-    ofs << "# [" << 2*i_m+2 << "] = Re{" << Descriptor << "(" << lm[i_m][0] << "," << lm[i_m][1] << ")}" << endl;
-    ofs << "# [" << 2*i_m+3 << "] = Im{" << Descriptor << "(" << lm[i_m][0] << "," << lm[i_m][1] << ")}" << endl;
+  // Make sure the file is big enough for the sizes in the header
+  // before allocating or mapping anything.  Each size is compared to
+  // the file length separately first, so that the total can't
+  // overflow.
+  {
+    struct stat st;
+    if(fstat(fileno(fp), &st)!=0) {
+      fclose(fp);
+      INFOTOCERR << "Couldn't get the size of '" << FileName << "'" << endl;
+      throw(GWFrames_FailedSystemCall);
+    }
+    const uint64_t FileSize = st.st_size;
+    const uint64_t Limit = std::min(FileSize, uint64_t(UINT_MAX));
+    if(Sizes[0]>Limit/sizeof(double) || Sizes[1]>Limit/(2*sizeof(int32_t)) || Sizes[2]>Limit/(4*sizeof(double))
+       || Sizes[3]>Limit || (Sizes[0]>0 && Sizes[1]>FileSize/(sizeof(complex<double>)*Sizes[0]))
+       || BinaryWaveformHeaderSize + 2*sizeof(int32_t)*Sizes[1] + sizeof(double)*(Sizes[0]+4*Sizes[2])
+          + sizeof(complex<double>)*Sizes[1]*Sizes[0] + Sizes[3] > FileSize) {
+      fclose(fp);
+      INFOTOCERR << "The header of '" << FileName << "' gives NTimes=" << Sizes[0] << ", NModes=" << Sizes[1]
+                 << ", NFrame=" << Sizes[2] << ", NHistory=" << Sizes[3] << ", which do not fit in its "
+                 << FileSize << " bytes; file is truncated or corrupt" << endl;
+      throw(GWFrames_BadWaveformInformation);
+    }
+  }
+  const unsigned int NTimes = Sizes[0];
+  const unsigned int NModes = Sizes[1];
+  const unsigned int NFrame = Sizes[2];
+  const unsigned int NHistory = Sizes[3];
+  spinweight = Ints[0];
+  boostweight = Ints[1];
+  frameType = WaveformFrameType(Ints[2]);
+  dataType = WaveformDataType(Ints[3]);
+  rIsScaledOut = bool(Ints[4]);
+  mIsScaledOut = bool(Ints[5]);
+
+  // Read the (ell,m) data
+  {
+    vector<int32_t> LM(2*NModes);
+    if(NModes>0) {
+      ReadOrThrow(&LM[0], sizeof(int32_t), 2*NModes, fp, FileName);
+    }
+    lm = vector<vector<int> >(NModes, vector<int>(2,0));
+    for(unsigned int i_m=0; i_m<NModes; ++i_m) {
+      lm[i_m][0] = LM[2*i_m];
+      lm[i_m][1] = LM[2*i_m+1];
+    }
+    IndexModes();
+  }
+
+  // Read the time and frame data
+  t.resize(NTimes);
+  if(NTimes>0) {
+    ReadOrThrow(&t[0], sizeof(double), NTimes, fp, FileName);
+  }
+  {
+    vector<double> Frame(4*NFrame);
+    if(NFrame>0) {
+      ReadOrThrow(&Frame[0], sizeof(double), 4*NFrame, fp, FileName);
+    }
+    frame.resize(NFrame);
+    for(unsigned int i_f=0; i_f<NFrame; ++i_f) {
+      frame[i_f] = Quaternion(Frame[4*i_f], Frame[4*i_f+1], Frame[4*i_f+2], Frame[4*i_f+3]);
+    }
+  }
+
+  // Read the complex data straight into the (contiguous) data matrix,
+  // or just map them and skip ahead to the history
+  if(MapData) {
+    const size_t Offset = BinaryWaveformHeaderSize + 2*sizeof(int32_t)*NModes + sizeof(double)*(NTimes+4*NFrame);
+    const size_t DataSize = sizeof(complex<double>)*size_t(NModes)*size_t(NTimes);
+    try {
+      data.mapfile(FileName, Offset, NModes, NTimes);
+    } catch(...) {
+      fclose(fp);
+      throw;
+    }
+    if(fseek(fp, Offset+DataSize, SEEK_SET)!=0) {
+      fclose(fp);
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed seeking in '" << FileName << "'" << endl;
+      throw(GWFrames_BadWaveformInformation);
+    }
+  } else {
+    data.resize(NModes, NTimes);
+    if(NModes>0 && NTimes>0) {
+      ReadOrThrow(data[0], sizeof(complex<double>), size_t(NModes)*size_t(NTimes), fp, FileName);
+    }
+  }
+
+  // Read the previous history and save to 'history'
+  {
+    string Hist(NHistory, ' ');
+    if(NHistory>0) {
+      ReadOrThrow(&Hist[0], 1, NHistory, fp, FileName);
+    }
+    history << "#### Begin Previous History\n";
+    istringstream HistStream(Hist);
+    string Temp;
+    while(getline(HistStream, Temp)) {
+      history << "#" << Temp << "\n";
+    }
+    history << "#### End Previous History\n";
+  }
+
+  fclose(fp);
+  return;
+}
+
+/// Output Waveform object to binary data file.
+const GWFrames::Waveform& GWFrames::Waveform::OutputBinary(const std::string& FileName) const {
+  ///
+  /// \param FileName Relative path to data file
+  ///
+  /// The file stores all information contained in this object, in a
+  /// simple little-endian layout that can be read back with the
+  /// constructor `Waveform(FileName, "Binary")`.  The data for each
+  /// mode are stored contiguously, in the same order as they are held
+  /// in memory, so reading and writing are just block copies.
+  ///
+  GWFrames_INSTRUMENT_SCOPE("Waveform::OutputBinary");
+  const unsigned int NT = NTimes();
+  const unsigned int NM = NModes();
+  const unsigned int NF = frame.size();
+  {
+    // Check for this before opening the file, so as not to clobber it
+    uint32_t EndianTest = BinaryWaveformEndianTest;
+    if(*reinterpret_cast<unsigned char*>(&EndianTest)!=0x04) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": The binary Waveform format is not yet implemented on big-endian machines" << endl;
+      throw(GWFrames_NotYetImplemented);
+    }
+  }
+  FILE* fp = fopen(FileName.c_str(), "wb");
+  if(!fp) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "' for writing" << endl;
+    throw(GWFrames_BadFileName);
   }
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    ofs << T(i_t) << " ";
-    for(unsigned int i_m=0; i_m<NModes()-1; ++i_m) {
-      ofs << data[i_m][i_t].real() << " " << data[i_m][i_t].imag() << " ";
+  stringstream Hist;
+  Hist << history.str() << "this->OutputBinary(" << FileName << ")" << endl;
+  const string HistStr = Hist.str();
+
+  // Write the header
+  const int32_t Ints[6] = { spinweight, boostweight, frameType, dataType, rIsScaledOut, mIsScaledOut };
+  const uint64_t Sizes[4] = { NT, NM, NF, HistStr.size() };
+  WriteOrThrow(BinaryWaveformMagic, 1, 8, fp, FileName);
+  WriteOrThrow(&BinaryWaveformVersion, sizeof(uint32_t), 1, fp, FileName);
+  WriteOrThrow(&BinaryWaveformEndianTest, sizeof(uint32_t), 1, fp, FileName);
+  WriteOrThrow(Ints, sizeof(int32_t), 6, fp, FileName);
+  WriteOrThrow(Sizes, sizeof(uint64_t), 4, fp, FileName);
+
+  // Write the arrays
+  {
+    vector<int32_t> LM(2*NM);
+    for(unsigned int i_m=0; i_m<NM; ++i_m) {
+      LM[2*i_m] = lm[i_m][0];
+      LM[2*i_m+1] = lm[i_m][1];
+    }
+    if(NM>0) {
+      WriteOrThrow(&LM[0], sizeof(int32_t), 2*NM, fp, FileName);
+    }
+  }
+  if(NT>0) {
+    WriteOrThrow(&t[0], sizeof(double), NT, fp, FileName);
+  }
+  {
+    vector<double> Frame(4*NF);
+    for(unsigned int i_f=0; i_f<NF; ++i_f) {
+      for(unsigned int j=0; j<4; ++j) {
+        Frame[4*i_f+j] = frame[i_f][j];
+      }
+    }
+    if(NF>0) {
+      WriteOrThrow(&Frame[0], sizeof(double), 4*NF, fp, FileName);
     }
-    ofs << data[NModes()-1][i_t].real() << " " << data[NModes()-1][i_t].imag() << endl;
   }
-  ofs.close();
+  if(NM>0 && NT>0) {
+    WriteOrThrow(data[0], sizeof(complex<double>), size_t(NM)*size_t(NT), fp, FileName);
+  }
+  WriteOrThrow(HistStr.data(), 1, HistStr.size(), fp, FileName);
+
+  if(fclose(fp)!=0) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed closing '" << FileName << "'" << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
   return *this;
 }
 
@@ -3925,6 +6573,59 @@ GWFrames::Waveform GWFrames::Waveform::operator/(const double b) const {
   return C;
 }
 
+/// Set the data of this object to the product A*B, found in spectral space
+void GWFrames::Waveform::SetSpectralProductData(const GWFrames::Waveform& A, const GWFrames::Waveform& B, const int lMax) {
+  /// This is the spectral branch of `BinaryOp`, which has already set
+  /// up everything but the data.  Modes of A and B above `lMax` are
+  /// ignored, as on the grid.  The time steps are taken in blocks, so
+  /// that each coupling coefficient is applied to a contiguous run of
+  /// data in each mode, and the blocks are done in parallel.
+  const GWFrames::SpectralProductTable& Table
+    = GWFrames::CachedSpectralProductTable(A.SpinWeight(), lMax, B.SpinWeight(), lMax, lMax);
+  const int Nlm = N_lm(lMax);
+  const int RowOffsetC = SpinWeight()*SpinWeight();
+
+  // Rows of A and B holding each (ell,m); missing modes are skipped
+  vector<int> RowA(Nlm, -1);
+  vector<int> RowB(Nlm, -1);
+  for(int i=0, l=0; l<=lMax; ++l) {
+    for(int m=-l; m<=l; ++m, ++i) {
+      const unsigned int iA = A.FindModeIndexWithoutError(l, m);
+      if(iA<A.NModes()) { RowA[i] = iA; }
+      const unsigned int iB = B.FindModeIndexWithoutError(l, m);
+      if(iB<B.NModes()) { RowB[i] = iB; }
+    }
+  }
+
+  const int ntimes = NTimes();
+  const int BlockSize = 256;
+  const int NBlocks = (ntimes+BlockSize-1)/BlockSize;
+  data.assign(lm.size(), ntimes, complex<double>(0.0,0.0));
+  #pragma omp parallel for schedule(dynamic)
+  for(int i_block=0; i_block<NBlocks; ++i_block) {
+    const int i_t_a = i_block*BlockSize;
+    const int i_t_b = std::min(ntimes, i_t_a+BlockSize);
+    for(int i_A=0; i_A<Nlm; ++i_A) {
+      if(RowA[i_A]<0) { continue; }
+      const complex<double>* a = A.data[RowA[i_A]];
+      for(int k=Table.Begin[i_A]; k<Table.Begin[i_A+1]; ++k) {
+        if(RowB[Table.IndexB[k]]<0) { continue; }
+        const complex<double>* b = B.data[RowB[Table.IndexB[k]]];
+        complex<double>* c = data[Table.IndexC[k]-RowOffsetC];
+        const double Coefficient = Table.Coefficient[k];
+        for(int i_t=i_t_a; i_t<i_t_b; ++i_t) {
+          c[i_t] += Coefficient * (a[i_t]*b[i_t]);
+        }
+      }
+    }
+  }
+}
 
-GWFrames::Waveform GWFrames::Waveform::operator*(const GWFrames::Waveform& B) const { return BinaryOp<std::multiplies<std::complex<double> > >(B); }
-GWFrames::Waveform GWFrames::Waveform::operator/(const GWFrames::Waveform& B) const { return BinaryOp<std::divides<std::complex<double> > >(B); }
+GWFrames::Waveform GWFrames::Waveform::operator*(const GWFrames::Waveform& B) const {
+  GWFrames_INSTRUMENT_SCOPE("Waveform::operator*");
+  return BinaryOp<std::multiplies<std::complex<double> > >(B);
+}
+GWFrames::Waveform GWFrames::Waveform::operator/(const GWFrames::Waveform& B) const {
+  GWFrames_INSTRUMENT_SCOPE("Waveform::operator/");
+  return BinaryOp<std::divides<std::complex<double> > >(B);
+}
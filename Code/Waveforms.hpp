@@ -5,6 +5,7 @@
 #define WAVEFORMS_HPP
 
 #include <complex>
+#include <functional>
 #ifndef DOXYGEN
 #ifdef __restrict
 #define restrict __restrict
@@ -25,6 +26,7 @@ extern "C" {
 
 #include "Quaternions.hpp"
 #include "Utilities.hpp"
+#include "SphericalTransforms.hpp"
 #include "Errors.hpp"
 
 namespace GWFrames {
@@ -35,14 +37,34 @@ namespace GWFrames {
   static const std::string WaveformDataNames[4] = { "UnknownDataType", "h", "hdot", "Psi4" };
   static const std::string WaveformDataNamesLaTeX[4] = { "\\mathrm{unknown data type}", "h", "\\dot{h}", "\\Psi_4" };
   const int WeightError = 1000;
+  const int WaveformSpectralProductEllMax = 8; // Largest ellMax for which Waveform products are done in spectral space
+
+  class WaveformInterpolant;
+  class WaveformPointInterpolant;
+  class WaveformView;
+  class Waveform;
+
+  /// Norm, parity violations, and antisymmetry of a Waveform at each instant
+  struct WaveformParityDiagnostics {
+    std::vector<double> Norm;
+    std::vector<double> XParityViolationNormalized;
+    std::vector<double> YParityViolationNormalized;
+    std::vector<double> ZParityViolationNormalized;
+    std::vector<double> ParityViolationNormalized;
+    std::vector<double> NormalizedAntisymmetry;
+  };
 
   /// Object storing data and other information for a single waveform
   class Waveform {
 
+    friend class WaveformView;
+    friend class CompressedWaveform;
+
   protected:  // Member data
     int spinweight;
     int boostweight;
     std::stringstream history;
+    bool recordHistory; // If false, `history` is left empty and nothing is formatted into it
     std::vector<double> t;
     std::vector<Quaternions::Quaternion> frame;
     WaveformFrameType frameType;
@@ -50,8 +72,21 @@ namespace GWFrames {
     bool rIsScaledOut;
     bool mIsScaledOut;
     std::vector<std::vector<int> > lm;
+    std::vector<int> lmIndex; // Index in `lm` of mode (ell,m) is lmIndex[ell*(ell+1)+m], or -1 if absent
     MatrixC data; // Each row (first index, nn) corresponds to a mode
 
+  protected:  // Helper functions
+    void ReadBinary(const std::string& FileName, const bool MapData=false);
+    void ResetHistoryStream();
+    void IndexModes();
+    void SetSpectralProductData(const Waveform& A, const Waveform& B, const int lMax);
+    Waveform CopyForInterpolation(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                  unsigned int& i0, unsigned int& i1) const;
+    void CheckInterpolant(const WaveformInterpolant& Interpolant) const;
+    void BoostModes(const std::vector<std::vector<double> >& v, const int GammaPower);
+    void LdtAndLL(std::vector<int> Lmodes, std::vector<double>* Ldt, std::vector<double>* LL,
+                  const unsigned int i_t_a=0, int i_t_b=-1) const;
+
   public:  // Constructors and Destructor
     Waveform();
     Waveform(const Waveform& W);
@@ -60,6 +95,10 @@ namespace GWFrames {
              const std::vector<std::vector<std::complex<double> > >& Data);
     ~Waveform() { }
     Waveform& operator=(const Waveform&);
+    #if __cplusplus >= 201103L
+    Waveform(Waveform&& W) noexcept;
+    Waveform& operator=(Waveform&& W) noexcept;
+    #endif
 
   public:  // Copy-ish constructoroids
     Waveform CopyWithoutData() const;
@@ -69,8 +108,18 @@ namespace GWFrames {
     Waveform SliceOfTimes(const double t_a=-1e300, const double t_b=1e300) const;
     Waveform SliceOfTimesWithEll2(const double t_a=-1e300, const double t_b=1e300) const;
     Waveform SliceOfTimesWithoutModes(const double t_a=-1e300, const double t_b=1e300) const;
+    WaveformView View() const;
+    WaveformView ViewOfTimeIndices(const unsigned int i_t_a, unsigned int i_t_b=0) const;
+    WaveformView ViewOfTimeIndicesWithEll2(const unsigned int i_t_a, unsigned int i_t_b=0) const;
+    WaveformView ViewOfTimeIndicesWithoutModes(const unsigned int i_t_a, unsigned int i_t_b=0) const;
+    WaveformView ViewOfTimes(const double t_a=-1e300, const double t_b=1e300) const;
+    WaveformView ViewOfTimesWithEll2(const double t_a=-1e300, const double t_b=1e300) const;
+    WaveformView ViewOfTimesWithoutModes(const double t_a=-1e300, const double t_b=1e300) const;
     Waveform Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain=false) const;
+    Waveform Interpolate(const WaveformInterpolant& Interpolant, const std::vector<double>& NewTime,
+                         const bool AllowTimesOutsideCurrentDomain=false) const;
     Waveform& InterpolateInPlace(const std::vector<double>& NewTime);
+    Waveform& InterpolateInPlace(const WaveformInterpolant& Interpolant, const std::vector<double>& NewTime);
 
   public: // Data alteration functions -- USE AT YOUR OWN RISK!
     Waveform& DropTimesOutside(const double ta, const double tb);
@@ -80,7 +129,9 @@ namespace GWFrames {
     inline Waveform& SetSpinWeight(const int NewSpinWeight) { spinweight=NewSpinWeight; return *this; }
     inline Waveform& SetBoostWeight(const int NewBoostWeight) { boostweight=NewBoostWeight; return *this; }
     inline Waveform& AppendHistory(const std::string& Hist) { history << Hist; return *this; }
-    inline Waveform& SetHistory(const std::string& Hist) { history.str(Hist); history.seekp(0, std::ios_base::end); return *this; }
+    inline Waveform& SetHistory(const std::string& Hist) { if(recordHistory) { history.str(Hist); history.seekp(0, std::ios_base::end); } return *this; }
+    Waveform& SetRecordHistory(const bool Record);
+    static void SetRecordHistoryByDefault(const bool Record);
     inline Waveform& SetT(const std::vector<double>& a) { t = a; return *this; }
     inline Waveform& SetTime(const std::vector<double>& a) { t = a; return *this; }
     inline Waveform& SetFrame(const std::vector<Quaternions::Quaternion>& a) { frame = a; return *this; }
@@ -88,9 +139,10 @@ namespace GWFrames {
     inline Waveform& SetDataType(const WaveformDataType Type) { dataType = Type; return *this; }
     inline Waveform& SetRIsScaledOut(const bool Scaled) { rIsScaledOut = Scaled; return *this; }
     inline Waveform& SetMIsScaledOut(const bool Scaled) { mIsScaledOut = Scaled; return *this; }
-    inline Waveform& SetLM(const std::vector<std::vector<int> >& a) { lm = a; return *this; }
+    inline Waveform& SetLM(const std::vector<std::vector<int> >& a) { lm = a; IndexModes(); return *this; }
     inline Waveform& SetData(const std::vector<std::vector<std::complex<double> > >& a) { data = MatrixC(a); return *this; }
-    inline Waveform& SetData(const unsigned int i_Mode, const unsigned int i_Time, const std::complex<double>& a) { data[i_Mode][i_Time] = a; return *this; }
+    inline Waveform& SetData(const unsigned int i_Mode, const unsigned int i_Time, const std::complex<double>& a) { data.detach(); data[i_Mode][i_Time] = a; return *this; }
+    Waveform& SetData(const std::complex<double>* Data, const int NModes, const int NTimes);
     inline Waveform& ResizeData(const unsigned int NModes, const unsigned int NTimes) { data.resize(NModes, NTimes); return *this; }
     void swap(Waveform& b);
 
@@ -101,6 +153,8 @@ namespace GWFrames {
     inline int BoostWeight() const { return boostweight; }
     inline std::string HistoryStr() const { return history.str(); }
     inline std::stringstream& HistoryStream() { return history; }
+    inline bool RecordsHistory() const { return recordHistory; }
+    static bool RecordHistoryByDefault();
     inline int FrameType() const { return frameType; }
     inline int DataType() const { return dataType; }
     inline std::string FrameTypeString() const { return WaveformFrameNames[frameType]; }
@@ -109,6 +163,7 @@ namespace GWFrames {
     std::string DescriptorString() const;
     inline bool RIsScaledOut() const { return rIsScaledOut; }
     inline bool MIsScaledOut() const { return mIsScaledOut; }
+    inline bool DataIsMapped() const { return data.ismapped(); }
     inline double T(const unsigned int TimeIndex) const { return t[TimeIndex]; }
     inline Quaternions::Quaternion Frame(const unsigned int TimeIndex) const { return (frame.size()>1 ? frame[TimeIndex] : frame[0]); }
     inline double Re(const unsigned int Mode, const unsigned int TimeIndex) const { return std::real(data[Mode][TimeIndex]); }
@@ -134,6 +189,11 @@ namespace GWFrames {
     std::vector<std::vector<double> > Arg() const;
     std::vector<std::vector<double> > ArgUnwrapped() const;
     std::vector<std::vector<std::complex<double> > > Data() const;
+    GWFrames::Array2D ReArray() const;
+    GWFrames::Array2D ImArray() const;
+    GWFrames::Array2D AbsArray() const;
+    GWFrames::Array2D ArgArray() const;
+    GWFrames::Array2D ArgUnwrappedArray() const;
 
   public: // Data characterization
     int EllMax() const;
@@ -174,7 +234,9 @@ namespace GWFrames {
   public:
     std::vector<double> NormalizedAntisymmetry(std::vector<int> LModesForAsymmetry=std::vector<int>(0)) const;
     std::vector<std::vector<double> > DipoleMoment(int ellMax=0) const;
+    GWFrames::Array2D DipoleMomentArray(int ellMax=0) const;
     std::vector<double> MinimalParityViolation() const;
+    WaveformParityDiagnostics ParityDiagnostics(std::vector<int> Lmodes=std::vector<int>(0)) const;
     inline Waveform XParityInvolution() const {
       return Involution(&Waveform::XParityConjugate, &Quaternions::XParityConjugateSpinor);
     }
@@ -256,11 +318,16 @@ namespace GWFrames {
     Waveform& RotateDecompositionBasis(const std::vector<Quaternions::Quaternion>& R_frame);
 
     std::vector<std::vector<double> > LdtVector(std::vector<int> Lmodes=std::vector<int>(0)) const;
+    GWFrames::Array2D LdtArray(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
     std::vector<Matrix> LLMatrix(std::vector<int> Lmodes=std::vector<int>(0)) const;
     std::vector<std::vector<double> > LLDominantEigenvector(const std::vector<int>& Lmodes=std::vector<int>(0),
                                                             const Quaternions::Quaternion& RoughInitialEllDirection=Quaternions::zHat) const;
     std::vector<std::vector<double> > AngularVelocityVector(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
+    GWFrames::Array2D AngularVelocityArray(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
+    void LdtLLAndAngularVelocity(const std::vector<int>& Lmodes, std::vector<double>& Ldt,
+                                 std::vector<double>& LL, std::vector<double>& omega) const;
     std::vector<std::vector<double> > AngularVelocityVectorRelativeToInertial(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
+    GWFrames::Array2D AngularVelocityArrayRelativeToInertial(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
     std::vector<Quaternions::Quaternion> CorotatingFrame(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
 
     // Convenient transformations
@@ -284,6 +351,13 @@ namespace GWFrames {
     // Pointwise operations and spin-weight operators
     std::vector<std::complex<double> > EvaluateAtPoint(const double vartheta, const double varphi,
                                                        const unsigned int i_0=0, int i_1=-1) const;
+    std::vector<std::vector<std::complex<double> > > EvaluateAtPoints(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                                      const unsigned int i_0=0, int i_1=-1) const;
+    std::vector<std::complex<double> > InterpolateAtPoint(const std::vector<double>& NewTime, const double vartheta, const double varphi,
+                                                          const bool AllowTimesOutsideCurrentDomain=false, const unsigned int ChunkSize=16384) const;
+    std::vector<std::complex<double> > InterpolateAtPoint(const WaveformInterpolant& Interpolant, const std::vector<double>& NewTime,
+                                                          const double vartheta, const double varphi,
+                                                          const bool AllowTimesOutsideCurrentDomain=false, const unsigned int ChunkSize=16384) const;
     std::complex<double> InterpolateToPoint(const double vartheta, const double varphi, const double t_i,
                                             gsl_interp_accel* accRe=0, gsl_interp_accel* accIm=0, gsl_spline* splineRe=0, gsl_spline* splineIm=0) const;
     template <typename Op> Waveform BinaryOp(const Waveform& b) const;
@@ -300,13 +374,142 @@ namespace GWFrames {
 
     // Output to data file
     const Waveform& Output(const std::string& FileName, const unsigned int precision=14) const;
+    const Waveform& OutputBinary(const std::string& FileName) const;
 
   }; // class Waveform
   inline Waveform operator*(const double b, const Waveform& A) { return A*b; }
+
+  /// Non-owning view of a range of times and a subset of modes of a Waveform
+  class WaveformView {
+    /// A view just records a pointer to the parent Waveform, the
+    /// range of time indices `[i_t_a, i_t_b)`, and the indices of the
+    /// parent's modes that are included.  No time, frame, or mode
+    /// data are copied, so views are cheap to create; the read-only
+    /// methods below act directly on the parent's data.  The parent
+    /// must outlive the view, and must not be altered while the view
+    /// is in use.  Use `Copy()` to get an independent Waveform,
+    /// equivalent to the corresponding `Waveform::SliceOf...` method.
+    ///
+    /// \sa Waveform::ViewOfTimeIndices
+    /// \sa Waveform::ViewOfTimes
+
+    friend class Waveform;
+
+  private:
+    const Waveform* W;
+    unsigned int i_t_a, i_t_b;
+    std::vector<unsigned int> modes;
+    std::string description; // How the view was made, for histories; empty for the whole Waveform
+    std::string HistoryPrefix() const;
+    Waveform CopyForInterpolation(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                  unsigned int& i0, unsigned int& i1) const;
+    std::vector<std::complex<double> > InterpolateAtPointInChunks(const WaveformInterpolant& Interpolant, const std::vector<double>& NewTime,
+                                                                  const double vartheta, const double varphi,
+                                                                  const bool AllowTimesOutsideCurrentDomain, const unsigned int ChunkSize) const;
+
+  public:  // Constructor
+    WaveformView(const Waveform& Parent, const unsigned int I_t_a, const unsigned int I_t_b,
+                 const std::vector<unsigned int>& Modes, const std::string& Description="");
+
+  public:  // Data access functions
+    inline const Waveform& Parent() const { return *W; }
+    inline unsigned int TimeIndexOffset() const { return i_t_a; }
+    inline unsigned int NTimes() const { return i_t_b-i_t_a; }
+    inline unsigned int NModes() const { return modes.size(); }
+    inline unsigned int ParentModeIndex(const unsigned int Mode) const { return modes[Mode]; }
+    inline int SpinWeight() const { return W->SpinWeight(); }
+    inline int FrameType() const { return W->FrameType(); }
+    inline int DataType() const { return W->DataType(); }
+    inline double T(const unsigned int TimeIndex) const { return W->T(i_t_a+TimeIndex); }
+    inline Quaternions::Quaternion Frame(const unsigned int TimeIndex) const { return W->Frame(i_t_a+TimeIndex); }
+    inline const std::vector<int>& LM(const unsigned int Mode) const { return W->LM(modes[Mode]); }
+    inline std::complex<double> Data(const unsigned int Mode, const unsigned int TimeIndex) const { return W->Data(modes[Mode], i_t_a+TimeIndex); }
+    inline std::complex<double> operator()(const unsigned int Mode, const unsigned int TimeIndex) const { return W->Data(modes[Mode], i_t_a+TimeIndex); }
+    inline const std::complex<double>* operator()(const unsigned int Mode) const { return (*W)(modes[Mode])+i_t_a; }
+    std::vector<double> T() const;
+    Waveform Copy() const;
+
+  public:  // Read-only calculations
+    std::vector<double> Norm(const bool TakeSquareRoot=false) const;
+    std::vector<std::complex<double> > EvaluateAtPoint(const double vartheta, const double varphi) const;
+    Waveform Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain=false) const;
+    std::vector<std::vector<double> > LdtVector(std::vector<int> Lmodes=std::vector<int>(0)) const;
+    GWFrames::Array2D LdtArray(std::vector<int> Lmodes=std::vector<int>(0)) const;
+
+  }; // class WaveformView
+
+  /// Cubic-spline interpolant of all modes of a Waveform, for reuse
+  class WaveformInterpolant {
+    friend class WaveformPointInterpolant;
+  private:
+    std::vector<double> t;
+    MatrixC y; // Copy of the data; each row corresponds to a mode
+    MatrixC c; // Spline coefficients (half the second derivative) at each node
+    void SetCoefficients(const WaveformView& W);
+  public:
+    WaveformInterpolant(const Waveform& W);
+    WaveformInterpolant(const WaveformView& W);
+    inline unsigned int NTimes() const { return t.size(); }
+    inline unsigned int NModes() const { return y.nrows(); }
+    inline const std::vector<double>& T() const { return t; }
+    void Evaluate(const std::vector<double>& NewTime, MatrixC& NewData, const unsigned int i0=0, int i1=-1) const;
+  }; // class WaveformInterpolant
+
+  /// Reusable evaluator of a Waveform at many sky locations and times
+  class WaveformPointInterpolant {
+  private:
+    int spinWeight;
+    std::vector<std::vector<int> > lm;
+    bool hasConstantFrame;
+    Quaternions::Quaternion frameInverse; // Inverse of the constant frame, if any
+    WaveformInterpolant interpolant; // Interpolant of the modes in that constant (or inertial) frame
+  public:
+    WaveformPointInterpolant(const Waveform& W);
+    inline unsigned int NTimes() const { return interpolant.NTimes(); }
+    inline unsigned int NModes() const { return interpolant.NModes(); }
+    inline const std::vector<double>& T() const { return interpolant.T(); }
+    std::vector<std::complex<double> > Evaluate(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                const std::vector<double>& t) const;
+  }; // class WaveformPointInterpolant
+
+  /// Compact, read-only copy of a Waveform, for keeping many resident in memory
+  class CompressedWaveform {
+  public:
+    enum StorageType { SinglePrecision, ScaledInteger };
+  private:
+    Waveform header; // Everything but the data
+    StorageType storage;
+    std::vector<std::vector<char> > bytes; // Encoded data of each mode
+    std::vector<int> bytesPerValue; // Size of each encoded real or imaginary part
+    std::vector<double> scale; // Quantization step of each mode (ScaledInteger only)
+    std::vector<double> maxError; // Bound on the absolute error of each decoded mode
+  public:
+    CompressedWaveform(const Waveform& W, const StorageType Storage=ScaledInteger, const double Tolerance=1.e-6);
+    inline unsigned int NTimes() const { return header.NTimes(); }
+    inline unsigned int NModes() const { return bytes.size(); }
+    inline StorageType Storage() const { return storage; }
+    inline const std::vector<double>& T() const { return header.T(); }
+    inline const std::vector<int>& LM(const unsigned int i_Mode) const { return header.LM(i_Mode); }
+    inline double MaxError(const unsigned int i_Mode) const { return maxError[i_Mode]; }
+    double MaxError() const;
+    std::size_t DataBytes() const;
+    void DecodeMode(const unsigned int i_Mode, std::complex<double>* Data, const unsigned int i_t_a=0, int i_t_b=-1) const;
+    std::vector<std::complex<double> > Data(const unsigned int i_Mode) const;
+    std::vector<double> Norm(const bool TakeSquareRoot=false) const;
+    Waveform Decompress() const;
+  }; // class CompressedWaveform
   #include "Waveforms_BinaryOp.ipp"
 
+  void OutputWaveforms(const std::vector<Waveform>& Waveforms, const std::vector<std::string>& FileNames,
+                       const unsigned int precision=14);
+
+  std::vector<Waveform> Extrapolate(const std::vector<Waveform>& FiniteRadiusWaveforms,
+                                    const std::vector<std::vector<double> >& Radii,
+                                    const std::vector<int>& ExtrapolationOrders);
+
   void AlignWaveforms(Waveform& A, Waveform& B, const double t_1, const double t_2, unsigned int InitialEvaluations=0,
-                      std::vector<double> nHat_A=std::vector<double>(0), const bool Debug=false);
+                      std::vector<double> nHat_A=std::vector<double>(0), const bool Debug=false,
+                      const bool UseBFGS=false);
 
 } // namespace GWFrames
 
@@ -4,9 +4,13 @@
 #include "Utilities.hpp"
 #include "fft.hpp"
 #include "Errors.hpp"
+#include "Instrumentation.hpp"
 
 #include "Waveforms.hpp"
 #include <complex>
+#include <limits>
+#include <algorithm>
+#include <cmath>
 
 namespace WU = WaveformUtilities;
 using std::vector;
@@ -29,6 +33,137 @@ namespace {
     return 1.0 / (1.0 + exp(1.0/t - 1.0/(1-t)));
   }
 
+  void CheckMatchCompatibility(const GWFrames::WaveformAtAPointFT& A,
+                               const GWFrames::WaveformAtAPointFT& B,
+                               const vector<double>& InversePSD)
+  {
+    const unsigned int n = A.NFreq();
+    if(n != B.NFreq() || n != InversePSD.size()) {
+      cerr << "Waveform sizes, " << n << " and " << B.NFreq()
+           << ", are not compatible with InversePSD size, " << InversePSD.size() << "." << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+    const double eps = 1e-8;
+    const double df = A.F(1)-A.F(0);
+    const double df_B = B.F(1)-B.F(0);
+    const double rel_diff_df = std::fabs(1 - df/df_B);
+    if(rel_diff_df > eps) {
+      cerr << "Waveform frequency steps, " << df << " and " << df_B
+           << ", are not compatible in Match: rel_diff="<< rel_diff_df << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+  }
+
+  // The core of the match calculation, with no checks.  The `data`
+  // buffer must have size 2*(A.NFreq()-1); it is overwritten, so that
+  // one buffer can be reused for many matches.
+  void MatchWithBuffer(const GWFrames::WaveformAtAPointFT& A,
+                       const GWFrames::WaveformAtAPointFT& B,
+                       const vector<double>& InversePSD,
+                       WU::FFTWBuffer& data,
+                       double& timeOffset, double& phaseOffset, double& match)
+  {
+    GWFrames_INSTRUMENT_SCOPE("WaveformAtAPointFT::Match");
+    const unsigned int n = A.NFreq(); // Only positive frequencies are stored in t
+    const unsigned int N = 2*(n-1);  // But this is how many there really are
+    const double df = A.F(1)-A.F(0);
+    // s1 s2* = (a1 + i b1) (a2 - i b2) = (a1 a2 + b1 b2) + i(b1 a2 - a1 b2)
+    // Only the non-negative frequencies are nonzero, so the result of
+    // the inverse transform is complex; this uses FFTW's complex
+    // transform, with a cached plan for this size.
+    for(unsigned int i=0; i<n; ++i) {
+      data[i] = complex<double>( (A.Re(i)*B.Re(i)+A.Im(i)*B.Im(i))*InversePSD[i],
+                                 (A.Im(i)*B.Re(i)-A.Re(i)*B.Im(i))*InversePSD[i] );
+    }
+    for(unsigned int i=n; i<N; ++i) {
+      data[i] = 0.0;
+    }
+    WU::idft(data);
+    // Compare squared magnitudes, and only take the root of the largest
+    unsigned int maxi=0;
+    double maxmag2 = std::norm(data[0]);
+    for(unsigned int i=1; i<N; ++i) {
+      const double mag2 = std::norm(data[i]);
+      if(mag2>maxmag2) { maxmag2 = mag2; maxi = i; }
+    }
+    const double maxmag = std::sqrt(maxmag2);
+    // note: assumes N is even
+    timeOffset = (maxi<N/2 ? double(maxi)/(N*df) : double(int(maxi)-int(N))/(N*df));
+    phaseOffset = atan2(data[maxi].imag(), data[maxi].real())/2.0;
+    // The return from ifft is just the bare FFT sum, so we multiply by
+    // df to get the continuum-analog FT.  This is correct because the
+    // input data (re,im) are the continuum-analog data, rather than
+    // just the return from the bare FFT sum.  See, e.g., Eq. (A.33)
+    // [as opposed to Eq. (A.35)] of my (Mike Boyle's) thesis:
+    // <http://thesis.library.caltech.edu/143>.
+    match = 4.0*df*maxmag;
+  }
+
+  // The body of `Matches`, taking pointers so that callers need not
+  // copy any WaveformAtAPointFT into a vector
+  void MatchesOfPointers(const vector<const GWFrames::WaveformAtAPointFT*>& As,
+                         const vector<GWFrames::WaveformAtAPointFT>& Bs,
+                         const vector<double>& InversePSD,
+                         vector<vector<double> >& timeOffsets,
+                         vector<vector<double> >& phaseOffsets,
+                         vector<vector<double> >& matches)
+  {
+    GWFrames_INSTRUMENT_SCOPE("Matches");
+    const unsigned int NA = As.size();
+    const unsigned int NB = Bs.size();
+    timeOffsets.assign(NA, vector<double>(NB, 0.0));
+    phaseOffsets.assign(NA, vector<double>(NB, 0.0));
+    matches.assign(NA, vector<double>(NB, 0.0));
+    if(NA==0 || NB==0) { return; }
+
+    // Check everything up front, since we can't throw from inside the
+    // parallel region.  Compatibility with As[0] and Bs[0] is enough,
+    // because the check is transitive (up to the tolerance on df).
+    bool Normalized = true;
+    for(unsigned int a=0; a<NA; ++a) {
+      CheckMatchCompatibility(*As[a], Bs[0], InversePSD);
+      Normalized = Normalized && As[a]->IsNormalized();
+    }
+    for(unsigned int b=0; b<NB; ++b) {
+      CheckMatchCompatibility(*As[0], Bs[b], InversePSD);
+      Normalized = Normalized && Bs[b].IsNormalized();
+    }
+    if(!Normalized) {
+      cerr << "\n\nWARNING!!! Matching non-normalized WaveformAtAPointFT objects. WARNING!!!\n" << endl;
+    }
+
+    const unsigned int N = 2*(As[0]->NFreq()-1);
+    const int NPairs = NA*NB;
+    #pragma omp parallel
+    {
+      WU::FFTWBuffer data(N);
+      #pragma omp for schedule(static)
+      for(int p=0; p<NPairs; ++p) {
+        const unsigned int a = p/NB;
+        const unsigned int b = p%NB;
+        MatchWithBuffer(*As[a], Bs[b], InversePSD, data, timeOffsets[a][b], phaseOffsets[a][b], matches[a][b]);
+      }
+    }
+    return;
+  }
+
+  // Evaluate the (unnormalized) correlation sum_k c_k exp(2 pi i k df
+  // t) at the time t, where c[j] is the coefficient for k=k0+j
+  complex<double> CorrelationAtTime(const vector<complex<double> >& c,
+                                    const unsigned int k0, const unsigned int M,
+                                    const double df, const double t)
+  {
+    const double TwoPi = 2*M_PI;
+    const complex<double> Step = std::polar(1.0, TwoPi*df*t);
+    complex<double> Phasor = std::polar(1.0, TwoPi*k0*df*t);
+    complex<double> z = 0.0;
+    for(unsigned int j=0; j<M; ++j) {
+      z += c[j]*Phasor;
+      Phasor *= Step;
+    }
+    return z;
+  }
+
   // // Unused:
   // double DoubleSidedF(const unsigned int i, const unsigned int N, const double df) {
   //   if(i<N/2) { return i*df; }
@@ -47,6 +182,7 @@ GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
                                                  const double DetectorResponsePhase)
 : mDt(Dt), mVartheta(Vartheta), mVarphi(Varphi), mNormalized(false)
 {
+  GWFrames_INSTRUMENT_SCOPE("WaveformAtAPointFT::WaveformAtAPointFT");
 
   // Interpolate to an even time spacing dt whose size is the next power of 2
   const unsigned int N1 = (unsigned int)(std::floor((W.T().back()-W.T(0))/Dt));
@@ -56,8 +192,9 @@ GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
     NewTimes[i] = W.T(0) + i*Dt;
   }
 
-  GWFrames::Waveform W2 = W.Interpolate(NewTimes, true);
-  const vector<complex<double> > ComplexHData = W2.EvaluateAtPoint(Vartheta, Varphi);
+  // Interpolate and project onto the sky point in chunks, so that the
+  // interpolated modes are never stored on the full set of times
+  const vector<complex<double> > ComplexHData = W.InterpolateAtPoint(NewTimes, Vartheta, Varphi, true);
 
   // Construct initial real,imag H as a function of time
   vector<double> InitRealT(ComplexHData.size());
@@ -115,17 +252,18 @@ GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
 
   // Construct real,imag H as a function of frequency
   // The return from realdft needs to be multiplied by dt to correspond to the continuum FT
-  WU::realdft(RealT);
-  if (mFreqs.size() != RealT.size()/2+1) {
+  vector<complex<double> > ComplexF;
+  WU::realdft(RealT, ComplexF);
+  if (mFreqs.size() != ComplexF.size()) {
     cerr << "Time and frequency data size mismatch: "
-         << mFreqs.size() << "," << RealT.size()/2+1 << endl;
+         << mFreqs.size() << "," << ComplexF.size() << endl;
     throw(GWFrames_VectorSizeMismatch);
   }
   mRealF.resize(mFreqs.size());
   mImagF.resize(mFreqs.size());
   for(unsigned int i=0; i<RealT.size()/2; ++i) {
-    mRealF[i] = Dt*RealT[2*i];
-    mImagF[i] = Dt*RealT[2*i+1];
+    mRealF[i] = Dt*ComplexF[i].real();
+    mImagF[i] = Dt*ComplexF[i].imag();
   }
   // Sort out some funky storage
   mRealF.back() = 0.0; // RealT[1]; // just ignore data at the Nyquist frequency
@@ -148,7 +286,7 @@ namespace GWFrames {
 
   WaveformAtAPointFT& WaveformAtAPointFT::Normalize(const std::string& Detector)
   {
-    return Normalize(WU::NoiseCurve(F(), Detector, true));
+    return Normalize(WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector));
   }
 
   WaveformAtAPointFT& WaveformAtAPointFT::ZeroAbove(const double Frequency)
@@ -184,7 +322,7 @@ namespace GWFrames {
 
   vector<double> WaveformAtAPointFT::InversePSD(const std::string& Detector) const
   {
-    return WU::NoiseCurve(F(), Detector, true);
+    return WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector);
   }
 
   double WaveformAtAPointFT::SNR(const std::vector<double>& InversePSD) const
@@ -205,7 +343,7 @@ namespace GWFrames {
   double WaveformAtAPointFT::SNR(const std::string& Detector) const
   {
     /// \param[in] Detector Noise spectrum from this detector
-    return SNR(WU::NoiseCurve(F(), Detector, true));
+    return SNR(WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector));
   }
 
   /// Compute the match between two WaveformAtAPointFT
@@ -219,48 +357,113 @@ namespace GWFrames {
     /// \param[out] timeOffset Time offset used between the waveforms
     /// \param[out] phaseOffset Phase offset used between the waveforms
     /// \param[out] match Match between the two waveforms
-    const unsigned int n = NFreq(); // Only positive frequencies are stored in t
-    const unsigned int N = 2*(n-1);  // But this is how many there really are
     if(!IsNormalized() || !B.IsNormalized()) {
       cerr << "\n\nWARNING!!! Matching non-normalized WaveformAtAPointFT objects. WARNING!!!\n" << endl;
     }
-    if(n != B.NFreq() || n != InversePSD.size()) {
-      cerr << "Waveform sizes, " << n << " and " << B.NFreq()
-           << ", are not compatible with InversePSD size, " << InversePSD.size() << "." << endl;
-      throw(GWFrames_VectorSizeMismatch);
+    CheckMatchCompatibility(*this, B, InversePSD);
+    WU::FFTWBuffer data(2*(NFreq()-1));
+    MatchWithBuffer(*this, B, InversePSD, data, timeOffset, phaseOffset, match);
+    return;
+  }
+
+  /// Compute the match between two WaveformAtAPointFT over a frequency band
+  void WaveformAtAPointFT::Match(const WaveformAtAPointFT& B,
+                                 const std::vector<double>& InversePSD,
+                                 const double FMin, const double FMax,
+                                 double& timeOffset, double& phaseOffset,
+                                 double& match) const
+  {
+    /// \param[in] B WaveformAtAPointFT to compute match with
+    /// \param[in] InversePSD Spectrum used to weight contributions by frequencies to match
+    /// \param[in] FMin Lowest frequency (in Hz) to include
+    /// \param[in] FMax Highest frequency (in Hz) to include
+    /// \param[out] timeOffset Time offset used between the waveforms
+    /// \param[out] phaseOffset Phase offset used between the waveforms
+    /// \param[out] match Match between the two waveforms
+    ///
+    /// Only the frequencies in [FMin, FMax] at which InversePSD is
+    /// finite and nonzero contribute, which is the same as the full
+    /// `Match` when the InversePSD vanishes outside that band (e.g.,
+    /// below the seismic wall).  If the band contains M bins, the
+    /// correlation is computed with an FFT of size 2*M (rounded up to
+    /// a power of 2) rather than the full size N, so it is sampled
+    /// more coarsely in time.  The peak is then refined by fitting a
+    /// parabola through the largest sample and its neighbors, and the
+    /// correlation is evaluated directly at the refined time to give
+    /// the match and phase offset.  The time offset is therefore not
+    /// quantized to the sample spacing 1/(N*df), as it is in the full
+    /// `Match`.
+    GWFrames_INSTRUMENT_SCOPE("WaveformAtAPointFT::Match (band)");
+    if(!IsNormalized() || !B.IsNormalized()) {
+      cerr << "\n\nWARNING!!! Matching non-normalized WaveformAtAPointFT objects. WARNING!!!\n" << endl;
     }
-    const double eps = 1e-8;
+    CheckMatchCompatibility(*this, B, InversePSD);
+    const unsigned int n = NFreq();
+    const unsigned int N = 2*(n-1);
     const double df = F(1)-F(0);
-    const double df_B = B.F(1)-B.F(0);
-    const double rel_diff_df = std::fabs(1 - df/df_B);
-    if(rel_diff_df > eps) {
-      cerr << "Waveform frequency steps, " << df << " and " << df_B
-           << ", are not compatible in Match: rel_diff="<< rel_diff_df << endl;
-      throw(GWFrames_VectorSizeMismatch);
+
+    // Find the band of useful frequencies
+    unsigned int k0=n, k1=0;
+    for(unsigned int k=0; k<n; ++k) {
+      if(F(k)>=FMin && F(k)<=FMax && InversePSD[k]!=0.0 && std::fabs(InversePSD[k])<=std::numeric_limits<double>::max()) {
+        if(k0==n) { k0 = k; }
+        k1 = k;
+      }
     }
-    // s1 s2* = (a1 + i b1) (a2 - i b2) = (a1 a2 + b1 b2) + i(b1 a2 - a1 b2)
-    WU::WrapVecDoub data(2*N);
-    for(unsigned int i=0; i<n; ++i) {
-      data.real(i) = (Re(i)*B.Re(i)+Im(i)*B.Im(i))*InversePSD[i];
-      data.imag(i) = (Im(i)*B.Re(i)-Re(i)*B.Im(i))*InversePSD[i];
+    if(k0==n) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": No frequencies in [" << FMin << ", " << FMax
+           << "] with nonzero, finite InversePSD." << endl;
+      throw(GWFrames_EmptyIntersection);
     }
-    idft(data);
+    const unsigned int M = k1-k0+1;
+    unsigned int NBand = 4;
+    while(NBand<2*M && NBand<N) { NBand *= 2; }
+
+    // Heterodyne the band down to zero frequency; this only changes the
+    // phase of the transform, which is recomputed directly below
+    vector<complex<double> > c(M);
+    for(unsigned int j=0; j<M; ++j) {
+      const unsigned int k = k0+j;
+      const double w = (InversePSD[k]!=0.0 && std::fabs(InversePSD[k])<=std::numeric_limits<double>::max()) ? InversePSD[k] : 0.0;
+      c[j] = complex<double>( (Re(k)*B.Re(k)+Im(k)*B.Im(k))*w,
+                              (Im(k)*B.Re(k)-Re(k)*B.Im(k))*w );
+    }
+    WU::FFTWBuffer data(NBand);
+    for(unsigned int i=0; i<NBand; ++i) {
+      data[i] = (i<M ? c[i] : 0.0);
+    }
+    WU::idft(data);
     unsigned int maxi=0;
-    double maxmag = std::sqrt(sqr(data.real(0)) + sqr(data.imag(0)));
-    for(unsigned int i=1; i<N; ++i) {
-      const double mag = std::sqrt(sqr(data.real(i)) + sqr(data.imag(i)));
-      if(mag>maxmag) { maxmag = mag; maxi = int(i); }
+    double maxmag2 = std::norm(data[0]);
+    for(unsigned int i=1; i<NBand; ++i) {
+      const double mag2 = std::norm(data[i]);
+      if(mag2>maxmag2) { maxmag2 = mag2; maxi = i; }
     }
-    // note: assumes N is even
-    timeOffset = (maxi<N/2 ? double(maxi)/(N*df) : double(maxi-int(N))/(N*df));
-    phaseOffset = atan2(data.imag(maxi), data.real(maxi))/2.0;
-    /// The return from ifft is just the bare FFT sum, so we multiply by
-    /// df to get the continuum-analog FT.  This is correct because the
-    /// input data (re,im) are the continuum-analog data, rather than
-    /// just the return from the bare FFT sum.  See, e.g., Eq. (A.33)
-    /// [as opposed to Eq. (A.35)] of my (Mike Boyle's) thesis:
-    /// <http://thesis.library.caltech.edu/143>.
-    match = 4.0*df*maxmag;
+
+    // Parabolic refinement of the peak of |z|, in units of samples
+    const double ym = std::abs(data[(maxi+NBand-1)%NBand]);
+    const double y0 = std::sqrt(maxmag2);
+    const double yp = std::abs(data[(maxi+1)%NBand]);
+    const double Curvature = ym - 2*y0 + yp;
+    double delta = (Curvature<0.0 ? 0.5*(ym-yp)/Curvature : 0.0);
+    if(delta>0.5) { delta = 0.5; }
+    if(delta<-0.5) { delta = -0.5; }
+
+    // Convert to times in (-1/(2*df), 1/(2*df)], and evaluate directly
+    const double Period = 1.0/df;
+    double tSample = double(maxi)/(NBand*df);
+    double tRefined = (double(maxi)+delta)/(NBand*df);
+    if(tSample>0.5*Period) { tSample -= Period; }
+    if(tRefined>0.5*Period) { tRefined -= Period; }
+    if(tRefined<=-0.5*Period) { tRefined += Period; }
+    complex<double> z = CorrelationAtTime(c, k0, M, df, tRefined);
+    timeOffset = tRefined;
+    if(std::abs(z)<y0) { // Refinement can only make things worse if the peak is poorly resolved
+      z = CorrelationAtTime(c, k0, M, df, tSample);
+      timeOffset = tSample;
+    }
+    phaseOffset = atan2(z.imag(), z.real())/2.0;
+    match = 4.0*df*std::abs(z);
     return;
   }
 
@@ -269,7 +472,7 @@ namespace GWFrames {
                                  double& phaseOffset, double& match,
                                  const std::string& Detector) const
   {
-    Match(B, WU::NoiseCurve(F(), Detector, true), timeOffset, phaseOffset, match);
+    Match(B, WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector), timeOffset, phaseOffset, match);
     return;
   }
 
@@ -286,7 +489,99 @@ namespace GWFrames {
   double WaveformAtAPointFT::Match(const WaveformAtAPointFT& B,
                                    const std::string& Detector) const
   {
-    return Match(B, WU::NoiseCurve(F(), Detector, true));
+    return Match(B, WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector));
+  }
+
+  /// Compute the matches between this and each of several WaveformAtAPointFT
+  void WaveformAtAPointFT::Match(const std::vector<WaveformAtAPointFT>& Bs,
+                                 const std::vector<double>& InversePSD,
+                                 std::vector<double>& timeOffsets,
+                                 std::vector<double>& phaseOffsets,
+                                 std::vector<double>& matches) const
+  {
+    /// \param[in] Bs WaveformAtAPointFT objects to compute matches with
+    /// \param[in] InversePSD Spectrum used to weight contributions by frequencies to match
+    /// \param[out] timeOffsets Time offsets used between this and each of `Bs`
+    /// \param[out] phaseOffsets Phase offsets used between this and each of `Bs`
+    /// \param[out] matches Matches between this and each of `Bs`
+    ///
+    /// This is equivalent to calling the single-waveform version of
+    /// `Match` for each element of `Bs`, but the pairs are distributed
+    /// over threads, each of which reuses a single buffer, and the
+    /// cached FFT plan is shared by all of them.
+    ///
+    /// \sa Matches
+    const vector<const WaveformAtAPointFT*> As(1, this);
+    vector<vector<double> > timeOffsetsGrid, phaseOffsetsGrid, matchesGrid;
+    MatchesOfPointers(As, Bs, InversePSD, timeOffsetsGrid, phaseOffsetsGrid, matchesGrid);
+    timeOffsets.swap(timeOffsetsGrid[0]);
+    phaseOffsets.swap(phaseOffsetsGrid[0]);
+    matches.swap(matchesGrid[0]);
+    return;
+  }
+
+  /// Compute the matches between this and each of several WaveformAtAPointFT
+  std::vector<double> WaveformAtAPointFT::Match(const std::vector<WaveformAtAPointFT>& Bs,
+                                                const std::vector<double>& InversePSD) const
+  {
+    vector<double> timeOffsets, phaseOffsets, matches;
+    Match(Bs, InversePSD, timeOffsets, phaseOffsets, matches);
+    return matches;
+  }
+
+  /// Compute the matches between this and each of several WaveformAtAPointFT
+  std::vector<double> WaveformAtAPointFT::Match(const std::vector<WaveformAtAPointFT>& Bs,
+                                                const std::string& Detector) const
+  {
+    return Match(Bs, WU::CachedInverseNoiseCurve(F(1)-F(0), NFreq(), Detector));
+  }
+
+  /// Compute the matches between every pair from two sets of WaveformAtAPointFT
+  void Matches(const std::vector<WaveformAtAPointFT>& As,
+               const std::vector<WaveformAtAPointFT>& Bs,
+               const std::vector<double>& InversePSD,
+               std::vector<std::vector<double> >& timeOffsets,
+               std::vector<std::vector<double> >& phaseOffsets,
+               std::vector<std::vector<double> >& matches)
+  {
+    /// \param[in] As First set of WaveformAtAPointFT objects
+    /// \param[in] Bs Second set of WaveformAtAPointFT objects
+    /// \param[in] InversePSD Spectrum used to weight contributions by frequencies to match
+    /// \param[out] timeOffsets Time offsets, indexed as `timeOffsets[a][b]`
+    /// \param[out] phaseOffsets Phase offsets, indexed as `phaseOffsets[a][b]`
+    /// \param[out] matches Matches, indexed as `matches[a][b]`
+    ///
+    /// The results for element `[a][b]` are identical to those of
+    /// `As[a].Match(Bs[b], InversePSD, ...)`.  All of the inputs are
+    /// checked for compatibility before any matches are computed.  The
+    /// pairs are then distributed over threads (if OpenMP is
+    /// available), each of which uses a single FFTW buffer for all of
+    /// its pairs.
+    vector<const WaveformAtAPointFT*> APointers(As.size());
+    for(unsigned int a=0; a<As.size(); ++a) {
+      APointers[a] = &As[a];
+    }
+    MatchesOfPointers(APointers, Bs, InversePSD, timeOffsets, phaseOffsets, matches);
+    return;
+  }
+
+  /// Compute the matches between every pair from two sets of WaveformAtAPointFT
+  std::vector<std::vector<double> > Matches(const std::vector<WaveformAtAPointFT>& As,
+                                            const std::vector<WaveformAtAPointFT>& Bs,
+                                            const std::vector<double>& InversePSD)
+  {
+    vector<vector<double> > timeOffsets, phaseOffsets, matches;
+    Matches(As, Bs, InversePSD, timeOffsets, phaseOffsets, matches);
+    return matches;
+  }
+
+  /// Compute the matches between every pair from two sets of WaveformAtAPointFT
+  std::vector<std::vector<double> > Matches(const std::vector<WaveformAtAPointFT>& As,
+                                            const std::vector<WaveformAtAPointFT>& Bs,
+                                            const std::string& Detector)
+  {
+    if(As.size()==0) { return vector<vector<double> >(0, vector<double>(Bs.size())); }
+    return Matches(As, Bs, WU::CachedInverseNoiseCurve(As[0].F(1)-As[0].F(0), As[0].NFreq(), Detector));
   }
 
 }
@@ -58,15 +58,41 @@ namespace GWFrames {
     void Match(const WaveformAtAPointFT& B,
                const std::vector<double>& InversePSD,
                double& timeOffset, double& phaseOffset, double& match) const;
+    void Match(const WaveformAtAPointFT& B,
+               const std::vector<double>& InversePSD,
+               const double FMin, const double FMax,
+               double& timeOffset, double& phaseOffset, double& match) const;
     void Match(const WaveformAtAPointFT& B, double& timeOffset,
                double& phaseOffset, double& match,
                const std::string& Detector="AdvLIGO_ZeroDet_HighP") const;
+    void Match(const std::vector<WaveformAtAPointFT>& Bs,
+               const std::vector<double>& InversePSD,
+               std::vector<double>& timeOffsets,
+               std::vector<double>& phaseOffsets,
+               std::vector<double>& matches) const;
+    std::vector<double> Match(const std::vector<WaveformAtAPointFT>& Bs,
+                              const std::vector<double>& InversePSD) const;
+    std::vector<double> Match(const std::vector<WaveformAtAPointFT>& Bs,
+                              const std::string& Detector="AdvLIGO_ZeroDet_HighP") const;
   public:
     WaveformAtAPointFT& Normalize(const std::vector<double>& InversePSD);
     WaveformAtAPointFT& Normalize(const std::string& Detector="AdvLIGO_ZeroDet_HighP");
     WaveformAtAPointFT& ZeroAbove(const double Frequency);
   }; // class
 
+  void Matches(const std::vector<WaveformAtAPointFT>& As,
+               const std::vector<WaveformAtAPointFT>& Bs,
+               const std::vector<double>& InversePSD,
+               std::vector<std::vector<double> >& timeOffsets,
+               std::vector<std::vector<double> >& phaseOffsets,
+               std::vector<std::vector<double> >& matches);
+  std::vector<std::vector<double> > Matches(const std::vector<WaveformAtAPointFT>& As,
+                                            const std::vector<WaveformAtAPointFT>& Bs,
+                                            const std::vector<double>& InversePSD);
+  std::vector<std::vector<double> > Matches(const std::vector<WaveformAtAPointFT>& As,
+                                            const std::vector<WaveformAtAPointFT>& Bs,
+                                            const std::string& Detector="AdvLIGO_ZeroDet_HighP");
+
 } // namespace GWFrames
 
 #endif // WAVEFORMATAPOINTFT_HPP
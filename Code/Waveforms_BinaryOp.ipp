@@ -1,6 +1,19 @@
+#ifndef DOXYGEN
+// Operations that can be done by coupling the modes directly
+template <typename Op> struct IsSpectralBinaryOp { static const bool value = false; };
+template <> struct IsSpectralBinaryOp<std::multiplies<std::complex<double> > > { static const bool value = true; };
+#endif // DOXYGEN
+
 /// Pointwise multiply this object by another Waveform object
 template <typename Op>
 GWFrames::Waveform GWFrames::Waveform::BinaryOp(const GWFrames::Waveform& B) const {
+  /// The result has modes up to the smaller of the two ellMax values.
+  /// Products with that ellMax at most `WaveformSpectralProductEllMax`
+  /// are found by coupling the modes directly, using Clebsch-Gordan
+  /// tables that are computed once for each combination of spins and
+  /// ellMax.  Other operations (and larger products) are done
+  /// pointwise on an equi-angular grid at each time step, reusing
+  /// one pooled spinsfast workspace for all of the transforms.
   const Waveform& A = *this;
 
   if(A.NTimes() != B.NTimes()) {
@@ -79,80 +92,68 @@ GWFrames::Waveform GWFrames::Waveform::BinaryOp(const GWFrames::Waveform& B) con
       }
     }
   }
+  C.IndexModes();
+
+  // Products with modest ellMax are done directly in spectral space
+  if(IsSpectralBinaryOp<Op>::value && lMax<=WaveformSpectralProductEllMax) {
+    C.SetSpectralProductData(A, B, lMax);
+    return C;
+  }
 
   // These numbers determine the equi-angular grid on which we will do
-  // the pointwise multiplication.  For best accuracy, have N_phi>
-  // 2*lMax and N_theta > 2*lMax; but for speed, don't make them much
-  // greater.
-  int N_phi = 2*lMax + 1;
-  int N_theta = 2*lMax + 1;
+  // the pointwise multiplication.  The product of two functions with
+  // ellMax=lMax has ellMax=2*lMax, so this grid resolves it exactly
+  // (for multiplication) before truncating back to lMax.
+  int N_phi = 4*lMax + 1;
+  int N_theta = 4*lMax + 1;
+
+  // Rows of A and B holding each (ell,m) in spinsfast order; modes
+  // that are missing (including those with ell<|s|) are zero
+  std::vector<int> RowA(Nlm, -1);
+  std::vector<int> RowB(Nlm, -1);
+  for(int i=0, l=0; l<=lMax; ++l) {
+    for(int m=-l; m<=l; ++m, ++i) {
+      const unsigned int iA = A.FindModeIndexWithoutError(l, m);
+      if(l>=lMinA && iA<A.NModes()) { RowA[i] = iA; }
+      const unsigned int iB = B.FindModeIndexWithoutError(l, m);
+      if(l>=lMinB && iB<B.NModes()) { RowB[i] = iB; }
+    }
+  }
 
   // These will be work arrays
-  // const std::complex<double> I(0.0,1.0);
   const std::complex<double> zero(0.0,0.0);
-  std::vector<std::complex<double> > almA(Nlm);
-  std::vector<std::complex<double> > almB(Nlm);
-  std::vector<std::complex<double> > almC(Nlm);
+  std::vector<std::complex<double> > almA(Nlm, zero);
+  std::vector<std::complex<double> > almB(Nlm, zero);
+  std::vector<std::complex<double> > almC(Nlm, zero);
+  std::vector<std::complex<double> > fA(N_phi*N_theta, zero);
+  std::vector<std::complex<double> > fB(N_phi*N_theta, zero);
+  std::vector<std::complex<double> > fC(N_phi*N_theta, zero);
+
+  // The spinsfast plans and tables are made (or taken from the pool)
+  // once, outside the loop
+  SpinsfastWorkspaceLease Transform(lMax, N_theta, N_phi);
 
   // Now, loop through each time step doing the work
   C.data.resize(C.lm.size(), C.t.size());
   for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
-    std::vector<std::complex<double> > fA(N_phi*N_theta, zero);
-    std::vector<std::complex<double> > fB(N_phi*N_theta, zero);
-    std::vector<std::complex<double> > fC(N_phi*N_theta, zero);
-
-    { // Set the a_lm coefficients of A
-      unsigned int i=0;
-      for(int l=0; l<lMinA; ++l) {
-        for(int m=-l; m<=-l; ++m) {
-          almA[i] = zero;
-          ++i;
-        }
-      }
-      for(int l=lMinA; l<=lMax; ++l) {
-        for(int m=-l; m<=-l; ++m) {
-          const unsigned int iA = A.FindModeIndexWithoutError(l, m);
-          almA[i] = A.Data(iA, i_t);
-          ++i;
-        }
-      }
-    }
 
-    { // Set the a_lm coefficients of B
-      unsigned int i=0;
-      for(int l=0; l<lMinB; ++l) {
-        for(int m=-l; m<=-l; ++m) {
-          almB[i] = zero;
-          ++i;
-        }
-      }
-      for(int l=lMinB; l<=lMax; ++l) {
-        for(int m=-l; m<=-l; ++m) {
-          const unsigned int iB = B.FindModeIndexWithoutError(l, m);
-          almB[i] = B.Data(iB, i_t);
-          ++i;
-        }
-      }
+    // Set the a_lm coefficients of A and B
+    for(int i=0; i<Nlm; ++i) {
+      almA[i] = (RowA[i]<0 ? zero : A.data[RowA[i]][i_t]);
+      almB[i] = (RowB[i]<0 ? zero : B.data[RowB[i]][i_t]);
     }
 
-    { // Transform each and multiply pointwise
-      spinsfast_salm2map(reinterpret_cast<fftw_complex*>(&almA[0]),
-                         reinterpret_cast<fftw_complex*>(&fA[0]),
-                         A.SpinWeight(), N_theta, N_phi, lMax);
-      spinsfast_salm2map(reinterpret_cast<fftw_complex*>(&almB[0]),
-                         reinterpret_cast<fftw_complex*>(&fB[0]),
-                         B.SpinWeight(), N_theta, N_phi, lMax);
-      for(int i=0; i<N_phi*N_theta; ++i) {
-        fC[i] = Op()(fA[i], fB[i]);
-      }
+    // Transform each, operate pointwise, and transform back
+    Transform.salm2map(&almA[0], &fA[0], A.SpinWeight());
+    Transform.salm2map(&almB[0], &fB[0], B.SpinWeight());
+    for(int i=0; i<N_phi*N_theta; ++i) {
+      fC[i] = Op()(fA[i], fB[i]);
     }
+    Transform.map2salm(&fC[0], &almC[0], C.SpinWeight());
 
-    // Transform back and record the new data in C
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&fC[0]),
-                       reinterpret_cast<fftw_complex*>(&almC[0]),
-                       C.SpinWeight(), N_theta, N_phi, lMax);
+    // Record the new data in C
     for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
-      C.SetData(i_m, i_t, almC[i_m+lMin*lMin]);
+      C.data[i_m][i_t] = almC[i_m+lMin*lMin];
     }
 
   } // Finish loop over time
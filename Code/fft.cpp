@@ -1,6 +1,11 @@
 #include "fft.hpp"
 
 #include "Utilities.hpp"
+#include "Errors.hpp"
+#include "Instrumentation.hpp"
+#include <map>
+#include <cstdlib>
+#include <fftw3.h>
 
 using namespace std;
 namespace WU = WaveformUtilities;
@@ -50,11 +55,13 @@ void WU::WrapVecDoub::validate() {
 void four1(vector<double>& data, const int isign);
 
 void WU::dft(vector<double>& data) {
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
   four1(data, -1);
   return;
 }
 
 void WU::idft(vector<double>& data) {
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
   four1(data, 1);
   return;
 }
@@ -62,6 +69,7 @@ void WU::idft(vector<double>& data) {
 void realft(vector<double> &Data, const int isign);
 
 void  WU::realdft(std::vector<double>& data) {
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
   realft(data, 1);
   for(unsigned int i=3; i<data.size(); ++i) {
     data[i++] *= -1.0;
@@ -70,6 +78,153 @@ void  WU::realdft(std::vector<double>& data) {
 }
 
 
+//// FFTW routines
+#ifndef DOXYGEN
+namespace {
+
+  // The `Unaligned` plans are executed directly on the storage of the
+  // caller's `std::vector`, which need not have the alignment FFTW
+  // would otherwise assume.
+  enum FFTWPlanType { RealForwardUnaligned, ComplexBackwardInPlaceUnaligned, ComplexBackwardInPlace };
+
+  // Cache of plans, keyed on (type, size).  Plans are only created or
+  // looked up inside the critical section, because the FFTW planner
+  // is not thread safe.  Executing a plan on new arrays is thread
+  // safe, so the plans may be used simultaneously by many threads.
+  std::map<std::pair<int, int>, fftw_plan> FFTWPlans;
+  bool FFTWWisdomImported = false;
+
+  const char* FFTWWisdomFile() {
+    return getenv("GWFRAMES_FFTW_WISDOM");
+  }
+
+  fftw_plan FFTWPlan(const FFTWPlanType Type, const int N) {
+    fftw_plan plan = 0;
+    #pragma omp critical(GWFrames_FFTWPlanner)
+    {
+      if(!FFTWWisdomImported) {
+        FFTWWisdomImported = true;
+        if(FFTWWisdomFile()) { fftw_import_wisdom_from_filename(FFTWWisdomFile()); }
+      }
+      const std::pair<int, int> Key(Type, N);
+      std::map<std::pair<int, int>, fftw_plan>::const_iterator it = FFTWPlans.find(Key);
+      if(it!=FFTWPlans.end()) {
+        plan = it->second;
+      } else {
+        // Plan on scratch arrays, since FFTW_MEASURE overwrites them;
+        // the plans are then used with the new-array execute functions
+        if(Type==RealForwardUnaligned) {
+          double* in = fftw_alloc_real(N);
+          fftw_complex* out = fftw_alloc_complex(N/2+1);
+          plan = fftw_plan_dft_r2c_1d(N, in, out, FFTW_MEASURE | FFTW_UNALIGNED);
+          fftw_free(in);
+          fftw_free(out);
+        } else if(Type==ComplexBackwardInPlaceUnaligned) {
+          fftw_complex* inout = fftw_alloc_complex(N);
+          plan = fftw_plan_dft_1d(N, inout, inout, FFTW_BACKWARD, FFTW_MEASURE | FFTW_UNALIGNED);
+          fftw_free(inout);
+        } else {
+          fftw_complex* inout = fftw_alloc_complex(N);
+          plan = fftw_plan_dft_1d(N, inout, inout, FFTW_BACKWARD, FFTW_MEASURE);
+          fftw_free(inout);
+        }
+        if(plan) {
+          FFTWPlans[Key] = plan;
+          if(FFTWWisdomFile()) { fftw_export_wisdom_to_filename(FFTWWisdomFile()); }
+        }
+      }
+    }
+    if(!plan) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": FFTW failed to create a plan of size N=" << N << endl;
+      throw(GWFrames_FailedSystemCall);
+    }
+    return plan;
+  }
+
+}
+#endif // DOXYGEN
+
+/// Forward FFT of real data using FFTW
+void WU::realdft(const std::vector<double>& data, std::vector<std::complex<double> >& transform) {
+  /// \param data Real input data (of any length N)
+  /// \param transform On output, the N/2+1 complex values of the transform at non-negative frequencies
+  ///
+  /// Unlike the Numerical-Recipes version above, the output is not
+  /// packed: the zero-frequency and Nyquist values are stored as
+  /// complex numbers with zero imaginary part.  The transform reads
+  /// `data` and writes `transform` directly, without copying through
+  /// aligned buffers.
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
+  const int N = data.size();
+  const fftw_plan plan = FFTWPlan(RealForwardUnaligned, N);
+  transform.resize(N/2+1);
+  // Out-of-place real transforms leave their input unchanged
+  fftw_execute_dft_r2c(plan, const_cast<double*>(&data[0]), reinterpret_cast<fftw_complex*>(&transform[0]));
+  return;
+}
+
+/// Inverse FFT of complex data using FFTW
+void WU::idft(std::vector<std::complex<double> >& data) {
+  /// \param data Complex data, which are replaced by their (unnormalized) inverse transform
+  ///
+  /// The data are transformed in place, without copying.
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
+  const int N = data.size();
+  const fftw_plan plan = FFTWPlan(ComplexBackwardInPlaceUnaligned, N);
+  fftw_complex* inout = reinterpret_cast<fftw_complex*>(&data[0]);
+  fftw_execute_dft(plan, inout, inout);
+  return;
+}
+
+/// Allocate an aligned buffer of N complex numbers
+WU::FFTWBuffer::FFTWBuffer(const int N)
+  : d(reinterpret_cast<std::complex<double>*>(fftw_alloc_complex(N))), n(N)
+{
+  if(!d && N>0) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": FFTW failed to allocate a buffer of size N=" << N << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+}
+
+WU::FFTWBuffer::~FFTWBuffer() {
+  fftw_free(d);
+}
+
+/// Inverse FFT of complex data in place, using FFTW
+void WU::idft(WU::FFTWBuffer& data) {
+  /// \param data Complex data, which are replaced by their (unnormalized) inverse transform
+  ///
+  /// This is the same as the `std::vector` version, but transforms
+  /// the aligned buffer in place, so nothing is allocated or copied.
+  GWFrames_INSTRUMENT_COUNT("FFTs", 1);
+  const int N = data.size();
+  const fftw_plan plan = FFTWPlan(ComplexBackwardInPlace, N);
+  fftw_complex* inout = reinterpret_cast<fftw_complex*>(&data[0]);
+  fftw_execute_dft(plan, inout, inout);
+  return;
+}
+
+/// Read FFTW wisdom from file, returning true on success
+bool WU::ImportFFTWWisdom(const std::string& FileName) {
+  int success = 0;
+  #pragma omp critical(GWFrames_FFTWPlanner)
+  {
+    success = fftw_import_wisdom_from_filename(FileName.c_str());
+  }
+  return (success!=0);
+}
+
+/// Write FFTW wisdom (including that for all cached plans) to file, returning true on success
+bool WU::ExportFFTWWisdom(const std::string& FileName) {
+  int success = 0;
+  #pragma omp critical(GWFrames_FFTWPlanner)
+  {
+    success = fftw_export_wisdom_to_filename(FileName.c_str());
+  }
+  return (success!=0);
+}
+
+
 //// Numerical Recipes routines
 template<class T>
 inline void SWAP(T &a, T &b) {T dum=a; a=b; b=dum;}
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <complex>
+#include <string>
 
 namespace WaveformUtilities {
   
@@ -34,6 +35,36 @@ namespace WaveformUtilities {
   void idft(std::vector<double>& data);
   void realdft(std::vector<double>& data);
   std::vector<double> convlv(const std::vector<double>& data, const std::vector<double>& respns, const int isign);
+
+  /// The following call FFTW, using plans that are created once for
+  /// each size and kept for the life of the process.  The sign
+  /// conventions match those of `realdft` and `idft` above, and again
+  /// there are no normalization constants.  If the environment
+  /// variable GWFRAMES_FFTW_WISDOM is set, FFTW wisdom is read from
+  /// that file before the first plan is made, and written back to it
+  /// whenever a new plan is made.
+  void realdft(const std::vector<double>& data, std::vector<std::complex<double> >& transform);
+  void idft(std::vector<std::complex<double> >& data);
+
+  /// Complex array with the alignment FFTW expects, which can be
+  /// transformed in place any number of times without further
+  /// allocation or copying.  Each thread should use its own.
+  class FFTWBuffer {
+  private:
+    std::complex<double>* d;
+    int n;
+    FFTWBuffer(const FFTWBuffer&);
+    FFTWBuffer& operator=(const FFTWBuffer&);
+  public:
+    FFTWBuffer(const int N);
+    ~FFTWBuffer();
+    inline int size() const { return n; }
+    inline std::complex<double>& operator[](const int i) { return d[i]; }
+    inline const std::complex<double>& operator[](const int i) const { return d[i]; }
+  };
+  void idft(FFTWBuffer& data);
+  bool ImportFFTWWisdom(const std::string& FileName);
+  bool ExportFFTWWisdom(const std::string& FileName);
   
 }
 
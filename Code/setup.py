@@ -125,6 +125,14 @@ if isdir('/opt/local/include'):
 if isdir('/opt/local/lib'):
     LibDirs += ['/opt/local/lib']
 
+## Use OpenMP for multi-threaded loops, unless asked not to (e.g., for
+## compilers that don't support it)
+CompileArgs = ['-Wno-deprecated', '-Wno-unused-variable', '-DUSE_GSL', '-O3', '-ffast-math', '-ftree-vectorize']
+LinkArgs = ['-fPIC',]
+if "GWFRAMES_NO_OPENMP" not in environ :
+    CompileArgs += ['-fopenmp']
+    LinkArgs += ['-fopenmp']
+
 ## Remove a compiler flag that doesn't belong there for C++
 import distutils.sysconfig as ds
 cfs=ds.get_config_vars()
@@ -200,6 +208,8 @@ setup(name="GWFrames",
                              'NoiseCurves.cpp',
                              'Interpolate.cpp',
                              'Scri.cpp',
+                             'SphericalTransforms.cpp',
+                             'Instrumentation.cpp',
                              'SWIG/GWFrames.i'],
                   depends = ['Quaternions/Quaternions.hpp',
                              'Quaternions/IntegrateAngularVelocity.hpp',
@@ -218,6 +228,8 @@ setup(name="GWFrames",
                              'NoiseCurves.hpp',
                              'Interpolate.hpp',
                              'Scri.hpp',
+                             'SphericalTransforms.hpp',
+                             'Instrumentation.hpp',
                              'Errors.hpp',
                              'GWFrames_Doc.i'],
                   include_dirs=IncDirs,
@@ -227,9 +239,9 @@ setup(name="GWFrames",
                   language='c++',
                   swig_opts=swig_opts,
                   extra_objects = glob.glob('spinsfast/build/temp/*/*.o'),
-                  extra_link_args = ['-fPIC',],
+                  extra_link_args = LinkArgs,
                   # extra_link_args=['-Wl,-undefined,error'], # `-undefined,error` is not defined on some platforms...
-                  extra_compile_args=['-Wno-deprecated', '-Wno-unused-variable', '-DUSE_GSL', '-O3', '-ffast-math', '-ftree-vectorize'],
+                  extra_compile_args=CompileArgs,
                   ),
         ],
       # classifiers = ,